@@ -2,7 +2,7 @@
 // CAIHelper.h (and CAIHelper.cpp)
 // Written by Daniel Schroeder
 // Created on October 19, 2007
-// Last Updated October 19, 2007
+// Last Updated October 17, 2026
 //-------------------------------------------------------------------
 //   The CAI class is used to control a CObject using Artificial Intelligence
 /////////////////////////////////////////////////////////////////////
@@ -12,10 +12,57 @@
 
 class CObject;			//#include "CObject.h"	// Including CObject causes a recursive definition problem
 #include "CTimer.h"
+#include "SObjectHandle.h"
 #include <Ogre.h>		// Include OGRE
 #include <list>
 using namespace std;
 
+// Maximum number of Neighbors an Object can hold
+const int GiMAX_NUMBER_OF_NEIGHBORS = 20;
+
+// Maximum number of Neighbor Candidates a Flocking Fish can hold (must not be more than GiMAX_SPATIAL_GRID_QUERY_NEIGHBORS)
+const int GiMAX_NUMBER_OF_NEIGHBOR_CANDIDATES = 32;
+
+// AI Levels of Detail (how much AI a Flocking Fish does, based on how close it is to the Player or Shark)
+const int GiAI_LEVEL_OF_DETAIL_NEAR	= 0;	// Full AI every update
+const int GiAI_LEVEL_OF_DETAIL_MID	= 1;	// Full AI every few updates
+const int GiAI_LEVEL_OF_DETAIL_FAR	= 2;	// Only wanders around (no Neighbors or Flocking)
+const int GiNUMBER_OF_AI_LEVELS_OF_DETAIL = 3;
+
+// Fraction of the AI Level Of Detail distances a Fish must move past them before it changes Level Of Detail
+const float GfAI_LEVEL_OF_DETAIL_HYSTERESIS = 0.1f;
+
+// Holds what an Object sensed about its surroundings this Step, so each sense is only worked out once
+//	(filled in by CGame's Perception stage before the AI uses it)
+struct SPerception
+{
+	bool bThereIsAPreditor;					// Tells if there are any Preditors (Sharks) at all
+	Ogre::Vector3 sClosestPreditorPosition;	// Position of the closest Preditor (if there is one)
+	float fClosestPreditorDistanceSquared;	// Squared distance to the closest Preditor (if there is one)
+	bool bCanSensePreditor;					// Tells if the closest Preditor is within the Sense Shark Range
+
+	float fPlayerDistanceSquared;			// Squared distance to the Player
+	bool bCanSensePlayer;					// Tells if the Player is within the Sense Submarine Range
+
+	CObject* cpClosestNeighbor;				// The closest Neighbor which still exists (NULL if there isn't one)
+	bool bCanSenseClosestNeighbor;			// Tells if the closest Neighbor is within the Sense Fish Range
+
+	// Default Constructor - nothing has been sensed
+	SPerception()
+	{
+		Purge();
+	}
+
+	// Forget everything that was sensed
+	void Purge()
+	{
+		bThereIsAPreditor = bCanSensePreditor = bCanSensePlayer = bCanSenseClosestNeighbor = false;
+		sClosestPreditorPosition = Ogre::Vector3::ZERO;
+		fClosestPreditorDistanceSquared = fPlayerDistanceSquared = 0.0f;
+		cpClosestNeighbor = NULL;
+	}
+};
+
 class CAIHelper
 {
 public:
@@ -34,92 +81,16 @@ public:
 
 	//---------- Set and Get Functions ----------
 
-	// Fish Functions
-
-	// Set/Get the Separation Coefficient
-	// NOTE: The Separation, Alignment, Cohesion, and PreditorAvoidance Coefficients should sum up to one
-	void SetSeparationCoefficient(float _fSeparationCoefficient);
-	float GetSeparationCoefficient() const;
-
-	// Set/Get the Alignment Coefficient
-	// NOTE: The Separation, Alignment, Cohesion, and PreditorAvoidance Coefficients should sum up to one
-	void SetAlignmentCoefficient(float _fAlignmentCoefficient);
-	float GetAlignmentCoefficient() const;
-
-	// Set/Get the Cohesion Coefficient
-	// NOTE: The Separation, Alignment, Cohesion, and PreditorAvoidance Coefficients should sum up to one
-	void SetCohesionCoefficient(float _fCohesionCoefficient);
-	float GetCohesionCoefficient() const;
-
-	// Set/Get the Preditor Avoidance Coefficient
-	// NOTE: The Separation, Alignment, Cohesion, and PreditorAvoidance Coefficients should sum up to one
-	void SetPreditorAvoidanceCoefficient(float _fPreditorAvoidanceCoefficient);
-	float GetPreditorAvoidanceCoefficient() const;
-
-	// Set/Get the Maximum Distance between 2 Object to consider them Neighbors
-	void SetSenseNeighborRange(float _fNeighborSenseRange);
-	float GetSenseNeighborRange() const;
+	// NOTE: The settings only some kinds of Objects use are kept in their Components instead (see SComponents.h)
 
 	// Set/Get the Maximum Number of Neighbors allowed
 	void SetMaxNumberOfNeighbors(int _iMaxNumberOfNeighbors);
 	int GetMaxNumberOfNeighbors() const;
 
-	// Set/Get the Age of the fish
-	void SetAge(float _fAge);
-	float GetAge() const;
-
-	// Set/Get the Age at which the fish will Spawn into two fish
-	void SetSpawnAge(float _fSpawnAge);
-	float GetSpawnAge() const;
-
-	// Set/Get if this Fish is a Flocking Fish or not
-	void SetIsAFlockingFish(bool _bIsAFlockingFish);
-	bool GetIsAFlockingFish() const;
-
-	// Set/Get the distance at which the Shark can be detected
-	void SetSenseSharkRange(float _fSenseSharkRange);
-	float GetSenseSharkRange() const;
-
-
-	// Shark Functions
-
-	// Set/Get Health at which Shark is considered Nourished
-	void SetNourishedHealth(int _iNourishedHealth);
-	int GetNourishedHealth() const;
-
-	// Set/Get Health at which Shark is considered Full
-	void SetFullHealth(int _iFullHealth);
-	int GetFullHealth() const;
-
-	// Set/Get the Range at which the Shark Senses the Submarine
+	// Set/Get the Range at which the Object Senses the Submarine
 	void SetSenseSubmarineRange(float _fSenseSubmarineRange);
 	float GetSenseSubmarineRange() const;
 
-	// Set/Get how close the Shark must be to eat a Fish
-	void SetFeedRange(float _fFeedRange);
-	float GetFeedRange() const;
-
-	// Set/Get how close Shark must be to Submarine to attack it
-	void SetAttackRange(float _fAttackRange);
-	float GetAttackRange() const;
-
-	// Set/Get how long the Shark should swim away from the Submarine for after attacking it
-	// NOTE: Time should be in milliseconds (1000ms = 1s)
-	void SetHitDelay(unsigned long _ulHitDelay);
-	unsigned long GetHitDelay() const;
-
-	// Set/Get how often the Sharks Health should degrade by a point
-	// NOTE: Time should be in milliseconds (1000ms = 1s)
-	void SetHealthDegradeDelay(unsigned long _ulHealthDegradeDelay);
-	unsigned long GetHealthDegradeDelay() const;
-
-	// Set/Get the Velocity Coefficient
-	void SetVelocityCoefficient(float _fVelocityCoefficient);
-	float GetVelocityCoefficient() const;
-
-	
-	// General Functions
-
 	// Set/Get the Range at which the Fish senses the Shark, and vica-versa
 	void SetSenseFishRange(float _fSenseFishRange);
 	float GetSenseFishRange() const;
@@ -131,41 +102,21 @@ public:
 
 	//---------- Public Data ---------
 
-	list<CObject*> mcNeighborList;		// Holds a list of this Objects Neighbors
+	SObjectHandle msaNeighbors[GiMAX_NUMBER_OF_NEIGHBORS];	// Holds Handles to this Objects Neighbors (sorted closest to farthest)
+	int miNumberOfNeighbors;			// How many Neighbors are being held
 	list<CObject*> mcPreditorList;		// Holds a list of Preditors which may harm this Object
 
-	CTimer mcUpdateTimer;				// Timer to be used for periodic updates
-	CTimer mcHitDelayTimer;				// Timer used to keep track of how long ago Shark attacked Player
-	CTimer mcDegradationTimer;			// Timer used to keep track of the last time Shark lost Health from moving, and the last time a Flocking Fish aged
-
-private:
+	int miCollisionGridHandle;			// Handle to this Object in the Collision Grid (-1 if not in it)
+	int miAISchedulerHandle;			// Handle to this Object in the AI Scheduler (-1 if not in it)
+	bool mbScheduledUpdateDue;			// Tells if the AI Scheduler selected this Object for its periodic Update this Step
+	SPerception msPerception;			// What this Object sensed about its surroundings this Step
 
-	// Fish Specific Data
-	float mfSeparationCoefficient;		// Separation Coefficient
-	float mfAlignmentCoefficient;		// Alignment Coefficient
-	float mfCohesionCoefficient;		// Cohesion Coefficient
-	float mfPreditorAvoidanceCoefficient;	// Preditor Avoidance Coefficient
+	SEventHandle msDegradationEvent;	// Handle to the Scheduled Event which makes the Shark lose Health, or a Flocking Fish age
 
-	float mfSenseNeighborRange;			// Maximum distance between 2 Objects to consider them Neighbors
-	int miMaxNumberOfNeighbors;			// Maximum number of Neighbors a fish can have
-	
-	float mfAge;						// The age of the fish
-	float mfSpawnAge;					// The age at which the fish will spawn into two fish
-
-	bool mbIsFlockingFish;				// Tells if this fish is a Flocking Fish or not
-	float mfSenseSharkRange;			// The distance at which the Shark can be detected
+private:
 
-	// Shark Specific Data
-	int miNourishedHealth;				// How much Health the Shark must have to be considered Nourished
-	int miFullHealth;					// How much Health the Shark must have to be considered Full
+	int miMaxNumberOfNeighbors;			// Maximum number of Neighbors the Object can have
 	float mfSenseSubmarineRange;		// The distance at which the Submarine can be detected
-	float mfFeedRange;					// How close Shark must be to fish to eat it
-	float mfAttackRange;				// How close Shark must be to submarine to attack it
-	unsigned long mulHitDelay;			// How long the Shark should continue swimming away from the Submarine after attacking it
-	unsigned long mulHealthDegradeDelay;// How often the Shark should lose a Health point
-	float mfVelocityCoefficient;		// Used to help determine the Sharks Velocity (Health * VelocityCoefficient)
-
-	// General Data
 	float mfSenseFishRange;				// How close a Fish must be before the Object detects them, and vica-versa
 	unsigned long mulUpdateTimeInterval;// How often this Objects AI should be updated
 };
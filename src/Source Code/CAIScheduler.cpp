@@ -0,0 +1,299 @@
+#include "CAIScheduler.h"
+#include <cstdlib>		// Needed for rand() function
+
+//---------- Contructors and Setup Functions ----------
+
+// Default Constructor
+CAIScheduler::CAIScheduler()
+{
+	// Start with no limit until a Budget is given, and no estimate of how long an Update takes
+	mfBudget = 0.0f;
+	mfEstimatedUpdateCost = 0.0f;
+
+	Purge();
+}
+
+// Destructor
+CAIScheduler::~CAIScheduler()
+{
+	Purge();
+}
+
+// Removes all Objects from the Scheduler and resets the Statistics
+void CAIScheduler::Purge()
+{
+	// Remove all Entries (the Budget and estimated Update Cost are kept)
+	mcEntryList.clear();
+	mcFreeEntryList.clear();
+	miNumberOfObjects = 0;
+	mcUpdateQueue.clear();
+	mulNextOrder = 0;
+
+	ResetStatistics();
+}
+
+// Sets how many microseconds of Updates may be done each Step (0 means there is no limit)
+void CAIScheduler::SetBudget(float _fBudgetInMicroseconds)
+{
+	mfBudget = (_fBudgetInMicroseconds > 0.0f) ? _fBudgetInMicroseconds : 0.0f;
+}
+
+// Returns how many microseconds of Updates may be done each Step
+float CAIScheduler::GetBudget() const
+{
+	return mfBudget;
+}
+
+
+
+//---------- Object Functions ----------
+
+// Inserts the Object so it is Updated every _ulUpdateInterval milliseconds, and returns its Handle
+int CAIScheduler::InsertObject(CObject* _cpObject, unsigned long _ulUpdateInterval, unsigned long _ulCurrentTime)
+{
+	int iHandle = 0;
+
+	// If there is a free Entry, reuse it
+	if (!mcFreeEntryList.empty())
+	{
+		iHandle = mcFreeEntryList.back();
+		mcFreeEntryList.pop_back();
+	}
+	// Else add a new Entry
+	else
+	{
+		iHandle = (int)mcEntryList.size();
+		mcEntryList.push_back(SScheduleEntry());
+		mcEntryList[iHandle].uiGeneration = 0;
+	}
+
+	// Fill in the Entry
+	SScheduleEntry& sEntry = mcEntryList[iHandle];
+	sEntry.cpObject = _cpObject;
+	sEntry.ulUpdateInterval = _ulUpdateInterval;
+	sEntry.bInUse = true;
+	miNumberOfObjects++;
+
+	// Queue its first Update at a random time within the first Interval
+	QueueUpdate(iHandle, _ulCurrentTime + ((_ulUpdateInterval > 0) ? ((unsigned long)rand() % (_ulUpdateInterval + 1)) : 0));
+
+	return iHandle;
+}
+
+// Removes the Object with the given Handle from the Scheduler
+void CAIScheduler::RemoveObject(int _iHandle)
+{
+	// If this is not a valid Handle
+	if (_iHandle < 0 || _iHandle >= (int)mcEntryList.size() || !mcEntryList[_iHandle].bInUse)
+	{
+		return;
+	}
+
+	// Mark the Entry as free (its Queue Entry is skipped when it comes due)
+	mcEntryList[_iHandle].bInUse = false;
+	mcEntryList[_iHandle].cpObject = NULL;
+	mcEntryList[_iHandle].uiGeneration++;
+	mcFreeEntryList.push_back(_iHandle);
+	miNumberOfObjects--;
+}
+
+// Returns how many Objects are in the Scheduler
+int CAIScheduler::ReturnNumberOfObjects() const
+{
+	return miNumberOfObjects;
+}
+
+
+
+//---------- Update Functions ----------
+
+// Fills _cDueObjectList with the Objects whose Update is due, up to as many as fit in the Budget
+int CAIScheduler::SelectDueUpdates(unsigned long _ulCurrentTime, vector<CObject*>& _cDueObjectList)
+{
+	int iNumberOfUpdatesDeferred = 0;
+
+	_cDueObjectList.clear();
+
+	// Find how many Updates fit in the Budget (at least one is always done so the Objects keep getting Updated)
+	int iMaxNumberOfUpdates = -1;
+	if (mfBudget > 0.0f && mfEstimatedUpdateCost > 0.0f)
+	{
+		iMaxNumberOfUpdates = (int)(mfBudget / mfEstimatedUpdateCost);
+		if (iMaxNumberOfUpdates < 1)
+		{
+			iMaxNumberOfUpdates = 1;
+		}
+	}
+
+	// Take the due Updates off the top of the Queue, most overdue first (compared this way so the Time can wrap around)
+	while (!mcUpdateQueue.empty() && (long)(_ulCurrentTime - mcUpdateQueue.front().ulUpdateTime) >= 0)
+	{
+		SQueueEntry sQueueEntry = mcUpdateQueue.front();
+
+		// If the Object has been Removed, throw away its Queue Entry
+		if (!ReturnIfQueueEntryIsValid(sQueueEntry))
+		{
+			pop_heap(mcUpdateQueue.begin(), mcUpdateQueue.end());
+			mcUpdateQueue.pop_back();
+			continue;
+		}
+
+		// If the Budget has been used up
+		if (iMaxNumberOfUpdates != -1 && (int)_cDueObjectList.size() >= iMaxNumberOfUpdates)
+		{
+			// Leave the rest of the due Updates on the Queue (they are the most overdue, so they are done first next Step)
+			iNumberOfUpdatesDeferred = ReturnNumberOfDueUpdates(_ulCurrentTime);
+			break;
+		}
+
+		// Select this Object to be Updated and Queue its next Update
+		pop_heap(mcUpdateQueue.begin(), mcUpdateQueue.end());
+		mcUpdateQueue.pop_back();
+		_cDueObjectList.push_back(mcEntryList[sQueueEntry.iHandle].cpObject);
+		QueueUpdate(sQueueEntry.iHandle, _ulCurrentTime + mcEntryList[sQueueEntry.iHandle].ulUpdateInterval);
+	}
+
+	// Record the Statistics
+	mulNumberOfUpdates += (unsigned long)_cDueObjectList.size();
+	if (iNumberOfUpdatesDeferred > 0)
+	{
+		mulNumberOfDeferredUpdates += iNumberOfUpdatesDeferred;
+		mulNumberOfStepsOverBudget++;
+		if (iNumberOfUpdatesDeferred > miMostUpdatesDeferredInAStep)
+		{
+			miMostUpdatesDeferredInAStep = iNumberOfUpdatesDeferred;
+		}
+	}
+
+	return iNumberOfUpdatesDeferred;
+}
+
+// Records how long the Updates selected took, so the Scheduler can estimate how many fit in the Budget
+void CAIScheduler::RecordUpdateCost(float _fMicroseconds, int _iNumberOfUpdates)
+{
+	// If there is nothing to learn from
+	if (_iNumberOfUpdates <= 0 || _fMicroseconds < 0.0f)
+	{
+		return;
+	}
+
+	float fUpdateCost = _fMicroseconds / _iNumberOfUpdates;
+
+	// Use the first Cost Recorded as is, then smooth the estimate so a single slow Step doesn't throw it off
+	if (mfEstimatedUpdateCost <= 0.0f)
+	{
+		mfEstimatedUpdateCost = fUpdateCost;
+	}
+	else
+	{
+		mfEstimatedUpdateCost += (fUpdateCost - mfEstimatedUpdateCost) * 0.1f;
+	}
+}
+
+// Returns how long an Update is estimated to take (in microseconds)
+float CAIScheduler::ReturnEstimatedUpdateCost() const
+{
+	return mfEstimatedUpdateCost;
+}
+
+
+
+//---------- Statistics Functions ----------
+
+// Returns how many Updates have been selected since the last Reset
+unsigned long CAIScheduler::ReturnNumberOfUpdates() const
+{
+	return mulNumberOfUpdates;
+}
+
+// Returns how many due Updates have been Deferred since the last Reset
+unsigned long CAIScheduler::ReturnNumberOfDeferredUpdates() const
+{
+	return mulNumberOfDeferredUpdates;
+}
+
+// Returns how many Steps Deferred Updates since the last Reset
+unsigned long CAIScheduler::ReturnNumberOfStepsOverBudget() const
+{
+	return mulNumberOfStepsOverBudget;
+}
+
+// Returns the most Updates Deferred in a single Step since the last Reset
+int CAIScheduler::ReturnMostUpdatesDeferredInAStep() const
+{
+	return miMostUpdatesDeferredInAStep;
+}
+
+// Resets the Statistics
+void CAIScheduler::ResetStatistics()
+{
+	mulNumberOfUpdates = 0;
+	mulNumberOfDeferredUpdates = 0;
+	mulNumberOfStepsOverBudget = 0;
+	miMostUpdatesDeferredInAStep = 0;
+}
+
+
+
+//---------- Private Functions ----------
+
+// Adds the Objects next Update to the Queue
+void CAIScheduler::QueueUpdate(int _iHandle, unsigned long _ulUpdateTime)
+{
+	SQueueEntry sQueueEntry;
+	sQueueEntry.ulUpdateTime = _ulUpdateTime;
+	sQueueEntry.ulOrder = mulNextOrder++;
+	sQueueEntry.iHandle = _iHandle;
+	sQueueEntry.uiGeneration = mcEntryList[_iHandle].uiGeneration;
+
+	mcUpdateQueue.push_back(sQueueEntry);
+	push_heap(mcUpdateQueue.begin(), mcUpdateQueue.end());
+}
+
+// Returns if the Queue Entry is for an Object which is still in the Scheduler
+bool CAIScheduler::ReturnIfQueueEntryIsValid(SQueueEntry const& _sQueueEntry) const
+{
+	SScheduleEntry const& sEntry = mcEntryList[_sQueueEntry.iHandle];
+	return (sEntry.bInUse && sEntry.uiGeneration == _sQueueEntry.uiGeneration);
+}
+
+// Returns how many valid Queue Entries are due at the given Time (without taking them off the Queue)
+int CAIScheduler::ReturnNumberOfDueUpdates(unsigned long _ulCurrentTime) const
+{
+	int iNumberOfDueUpdates = 0;
+	vector<int> cIndexesToCheck;
+
+	// Walk down the heap from the top, only going below Entries which are due (the Entries below one which
+	//	is not due are not due either), so only the due Entries are looked at
+	if (!mcUpdateQueue.empty())
+	{
+		cIndexesToCheck.push_back(0);
+	}
+	while (!cIndexesToCheck.empty())
+	{
+		int iIndex = cIndexesToCheck.back();
+		cIndexesToCheck.pop_back();
+
+		// If this Entry is not due yet
+		if ((long)(_ulCurrentTime - mcUpdateQueue[iIndex].ulUpdateTime) < 0)
+		{
+			continue;
+		}
+
+		// Count it if its Object is still in the Scheduler, and check the Entries below it
+		if (ReturnIfQueueEntryIsValid(mcUpdateQueue[iIndex]))
+		{
+			iNumberOfDueUpdates++;
+		}
+		if (((iIndex * 2) + 1) < (int)mcUpdateQueue.size())
+		{
+			cIndexesToCheck.push_back((iIndex * 2) + 1);
+		}
+		if (((iIndex * 2) + 2) < (int)mcUpdateQueue.size())
+		{
+			cIndexesToCheck.push_back((iIndex * 2) + 2);
+		}
+	}
+
+	return iNumberOfDueUpdates;
+}
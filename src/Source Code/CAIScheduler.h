@@ -0,0 +1,142 @@
+/////////////////////////////////////////////////////////////////////
+// CAIScheduler.h (and CAIScheduler.cpp)
+// Written by Daniel Schroeder
+// Created on October 17, 2026
+// Last Updated October 17, 2026
+//-------------------------------------------------------------------
+//   The CAIScheduler class decides when each Object gets its periodic
+// AI Update (e.g. looking further away for Fish to swim towards). Each
+// Object is Inserted with how often it should be Updated, and every Step
+// SelectDueUpdates() returns the Objects whose Update is due.
+//   So that many Objects coming due at once (e.g. all the Fish created
+// when a Level is loaded) don't cause a frame spike, only as many
+// Updates as fit in the Budget are returned each Step. How long an
+// Update takes is learned from RecordUpdateCost(). Due Objects which
+// don't fit are Deferred until the next Step.
+//   The Objects are kept in a heap ordered by when their next Update is
+// due, so each Step only the Objects whose Update is due are looked at
+// (instead of checking every Object to find out nothing is due yet), and
+// the most overdue Objects are always Updated first so Deferred Objects
+// get their turn.
+//   Example:
+//		cAIScheduler.SelectDueUpdates(ulCurrentTime, cDueObjectList);
+//		... Update the Objects in cDueObjectList, timing how long it takes ...
+//		cAIScheduler.RecordUpdateCost(fMicrosecondsTaken, (int)cDueObjectList.size());
+/////////////////////////////////////////////////////////////////////
+
+#ifndef CAI_SCHEDULER_H
+#define CAI_SCHEDULER_H
+
+class CObject;			// Only pointers to Objects are stored
+#include <vector>
+#include <algorithm>	// Used for the heap functions the Objects are ordered with
+using namespace std;
+
+class CAIScheduler
+{
+public:
+
+	//---------- Contructors and Setup Functions ----------
+
+	CAIScheduler();										// Default Constructor
+	~CAIScheduler();									// Destructor
+
+	// Removes all Objects from the Scheduler and resets the Statistics
+	void Purge();
+
+	// Set/Get how many microseconds of Updates may be done each Step (0 means there is no limit)
+	void SetBudget(float _fBudgetInMicroseconds);
+	float GetBudget() const;
+
+
+	//---------- Object Functions ----------
+
+	// Inserts the Object so it is Updated every _ulUpdateInterval milliseconds, and returns its Handle (used to Remove it later)
+	// NOTE: The first Update is at a random time within the first Interval, so Objects Inserted together are spread out
+	int InsertObject(CObject* _cpObject, unsigned long _ulUpdateInterval, unsigned long _ulCurrentTime);
+
+	// Removes the Object with the given Handle from the Scheduler
+	void RemoveObject(int _iHandle);
+
+	// Returns how many Objects are in the Scheduler
+	int ReturnNumberOfObjects() const;
+
+
+	//---------- Update Functions ----------
+
+	// Empties _cDueObjectList and fills it with the Objects whose Update is due, up to as many as fit in the Budget
+	// Returns how many due Objects were Deferred to the next Step because they did not fit
+	// NOTE: Each Object returned is assumed to be Updated, so its next Update is scheduled one Interval from now
+	int SelectDueUpdates(unsigned long _ulCurrentTime, vector<CObject*>& _cDueObjectList);
+
+	// Records how long the Updates selected took, so the Scheduler can estimate how many fit in the Budget
+	void RecordUpdateCost(float _fMicroseconds, int _iNumberOfUpdates);
+
+	// Returns how long an Update is estimated to take (in microseconds)
+	float ReturnEstimatedUpdateCost() const;
+
+
+	//---------- Statistics Functions ----------
+
+	// Returns how many Updates have been selected, and how many due Updates have been Deferred, since the last Reset
+	unsigned long ReturnNumberOfUpdates() const;
+	unsigned long ReturnNumberOfDeferredUpdates() const;
+
+	// Returns how many Steps Deferred Updates, and the most Updates Deferred in a single Step, since the last Reset
+	unsigned long ReturnNumberOfStepsOverBudget() const;
+	int ReturnMostUpdatesDeferredInAStep() const;
+
+	// Resets the Statistics
+	void ResetStatistics();
+
+private:
+
+	// Holds one Object in the Scheduler
+	struct SScheduleEntry
+	{
+		CObject* cpObject;				// The Object
+		unsigned long ulUpdateInterval;	// How often the Object should be Updated
+		unsigned int uiGeneration;		// Changed every time the Entry is freed, so the Object's old Queue Entry is skipped
+		bool bInUse;					// Tells if this Entry holds an Object or is free
+	};
+
+	// Used to order the Objects by when their next Update is due
+	struct SQueueEntry
+	{
+		unsigned long ulUpdateTime;		// When the Objects next Update is due
+		unsigned long ulOrder;			// Order the Entry was added in (Updates due at the same time are done in the order they were Queued)
+		int iHandle;					// Handle of the Object's Entry
+		unsigned int uiGeneration;		// Generation of the Entry when this was Queued (it is skipped if the Object has been Removed)
+
+		// Overload the < operator so the STL heap functions (which keep the largest Entry on top) keep the Update which is due first on top
+		bool operator<(SQueueEntry const& _sEntry) const
+		{
+			return (ulUpdateTime > _sEntry.ulUpdateTime || (ulUpdateTime == _sEntry.ulUpdateTime && ulOrder > _sEntry.ulOrder));
+		}
+	};
+
+	// Adds the Objects next Update to the Queue
+	void QueueUpdate(int _iHandle, unsigned long _ulUpdateTime);
+
+	// Returns if the Queue Entry is for an Object which is still in the Scheduler
+	bool ReturnIfQueueEntryIsValid(SQueueEntry const& _sQueueEntry) const;
+
+	// Returns how many valid Queue Entries are due at the given Time (without taking them off the Queue)
+	int ReturnNumberOfDueUpdates(unsigned long _ulCurrentTime) const;
+
+	vector<SScheduleEntry> mcEntryList;	// Holds the Objects
+	vector<int> mcFreeEntryList;		// Entries which don't hold an Object and can be reused
+	int miNumberOfObjects;				// How many Objects are in the Scheduler
+	vector<SQueueEntry> mcUpdateQueue;	// Heap of the Objects' next Updates, ordered by when they are due
+	unsigned long mulNextOrder;			// Order to give the next Queue Entry
+
+	float mfBudget;						// How many microseconds of Updates may be done each Step (0 for no limit)
+	float mfEstimatedUpdateCost;		// How long an Update is estimated to take (in microseconds, 0 until one is Recorded)
+
+	unsigned long mulNumberOfUpdates;			// Updates selected since the last Reset
+	unsigned long mulNumberOfDeferredUpdates;	// Due Updates Deferred since the last Reset
+	unsigned long mulNumberOfStepsOverBudget;	// Steps which Deferred Updates since the last Reset
+	int miMostUpdatesDeferredInAStep;			// Most Updates Deferred in a single Step since the last Reset
+};
+
+#endif
@@ -0,0 +1,102 @@
+#include "CBoundaryField.h"
+#include <cmath>		// Needed for floorf() and ceilf() functions
+
+//---------- Contructors and Setup Functions ----------
+
+// Default Constructor
+CBoundaryField::CBoundaryField()
+{
+	msMinimum = Ogre::Vector3::ZERO;
+	mfCellSize = 1.0f;
+	mfInverseCellSize = 1.0f;
+}
+
+// Destructor
+CBoundaryField::~CBoundaryField()
+{
+	mcSteeringXList.clear();
+	mcSteeringYList.clear();
+	mcSteeringZList.clear();
+}
+
+// Builds the field for the box, so Positions within _fAvoidDistance of its sides steer back inside
+void CBoundaryField::BuildField(Ogre::Vector3 _sMinimum, Ogre::Vector3 _sMaximum, float _fAvoidDistance, float _fCellSize)
+{
+	// Make sure the Cell Size is valid
+	if (_fCellSize <= 0.0f)
+	{
+		return;
+	}
+
+	msMinimum = _sMinimum;
+	mfCellSize = _fCellSize;
+	mfInverseCellSize = 1.0f / mfCellSize;
+
+	// Fill in each axis
+	BuildAxis(mcSteeringXList, _sMinimum.x, _sMaximum.x, _fAvoidDistance);
+	BuildAxis(mcSteeringYList, _sMinimum.y, _sMaximum.y, _fAvoidDistance);
+	BuildAxis(mcSteeringZList, _sMinimum.z, _sMaximum.z, _fAvoidDistance);
+}
+
+
+
+//---------- Query Functions ----------
+
+// Returns which way the Position should steer to get away from the Boundaries it is near
+Ogre::Vector3 CBoundaryField::ReturnSteering(Ogre::Vector3 const& _sPosition) const
+{
+	return Ogre::Vector3(ReturnAxisSteering(mcSteeringXList, msMinimum.x, _sPosition.x),
+						 ReturnAxisSteering(mcSteeringYList, msMinimum.y, _sPosition.y),
+						 ReturnAxisSteering(mcSteeringZList, msMinimum.z, _sPosition.z));
+}
+
+
+
+//---------- Private Functions ----------
+
+// Fills in the table for one axis
+void CBoundaryField::BuildAxis(vector<float>& _cSteeringList, float _fMinimum, float _fMaximum, float _fAvoidDistance)
+{
+	// Find how many Cells are needed to cover the axis (at least one)
+	int iNumberOfCells = (int)ceilf((_fMaximum - _fMinimum) * mfInverseCellSize);
+	iNumberOfCells = (iNumberOfCells > 0) ? iNumberOfCells : 1;
+	_cSteeringList.assign(iNumberOfCells, 0.0f);
+
+	// Loop through the Cells
+	for (int iCell = 0; iCell < iNumberOfCells; iCell++)
+	{
+		// Find where the Cell starts and ends
+		float fCellStart = _fMinimum + (iCell * mfCellSize);
+		float fCellEnd = fCellStart + mfCellSize;
+
+		// If the Cell is within the Avoid Distance of the low Boundary, steer up the axis
+		if (fCellStart < (_fMinimum + _fAvoidDistance))
+		{
+			_cSteeringList[iCell] += 1.0f;
+		}
+
+		// If the Cell is within the Avoid Distance of the high Boundary, steer down the axis
+		// NOTE: If the box is narrower than twice the Avoid Distance a Cell can be near both, and doesn't steer either way
+		if (fCellEnd > (_fMaximum - _fAvoidDistance))
+		{
+			_cSteeringList[iCell] -= 1.0f;
+		}
+	}
+}
+
+// Returns the Steering along one axis
+float CBoundaryField::ReturnAxisSteering(vector<float> const& _cSteeringList, float _fMinimum, float _fPosition) const
+{
+	// If the field has not been built
+	if (_cSteeringList.empty())
+	{
+		return 0.0f;
+	}
+
+	// Find the Cell the Position is in, using the closest Cell if it is outside of the box
+	int iCell = (int)floorf((_fPosition - _fMinimum) * mfInverseCellSize);
+	int iLastCell = (int)_cSteeringList.size() - 1;
+	iCell = (iCell < 0) ? 0 : ((iCell > iLastCell) ? iLastCell : iCell);
+
+	return _cSteeringList[iCell];
+}
@@ -0,0 +1,63 @@
+/////////////////////////////////////////////////////////////////////
+// CBoundaryField.h (and CBoundaryField.cpp)
+// Written by Daniel Schroeder
+// Created on October 17, 2026
+// Last Updated October 17, 2026
+//-------------------------------------------------------------------
+//   The CBoundaryField class holds which way Objects near the edges of
+// the Level should steer to get back into the middle of the ocean. It is
+// built once when the Level is loaded, so finding the Steering for a
+// Position is just a lookup instead of testing it against every Boundary.
+//   Each component of the Steering is -1, 0, or 1: 1 along an axis means
+// the Position is within the Avoid Distance of the low Boundary on that
+// axis (so it should steer up the axis), -1 means it is near the high
+// Boundary, and 0 means it is not near either.
+//   The Boundaries of the ocean are axis-aligned planes, so the field is
+// stored as one table per axis (the Steering is made from one entry of
+// each) which keeps a fine resolution without a huge 3D table. Obstacles
+// which are not axis-aligned (e.g. rocks) would need a 3D table added.
+/////////////////////////////////////////////////////////////////////
+
+#ifndef CBOUNDARY_FIELD_H
+#define CBOUNDARY_FIELD_H
+
+#include <Ogre.h>		// Include OGRE
+#include <vector>
+using namespace std;
+
+class CBoundaryField
+{
+public:
+
+	//---------- Contructors and Setup Functions ----------
+
+	CBoundaryField();									// Default Constructor
+	~CBoundaryField();									// Destructor
+
+	// Builds the field for the box, so Positions within _fAvoidDistance of its sides steer back inside
+	// NOTE: _fCellSize is the resolution of the field (the Avoid Distance should be a multiple of it)
+	void BuildField(Ogre::Vector3 _sMinimum, Ogre::Vector3 _sMaximum, float _fAvoidDistance, float _fCellSize);
+
+
+	//---------- Query Functions ----------
+
+	// Returns which way the Position should steer to get away from the Boundaries it is near (zero if it is not near any)
+	Ogre::Vector3 ReturnSteering(Ogre::Vector3 const& _sPosition) const;
+
+private:
+
+	// Fills in the table for one axis
+	void BuildAxis(vector<float>& _cSteeringList, float _fMinimum, float _fMaximum, float _fAvoidDistance);
+
+	// Returns the Steering along one axis
+	float ReturnAxisSteering(vector<float> const& _cSteeringList, float _fMinimum, float _fPosition) const;
+
+	vector<float> mcSteeringXList;			// Steering along each axis (one entry per Cell)
+	vector<float> mcSteeringYList;
+	vector<float> mcSteeringZList;
+	Ogre::Vector3 msMinimum;				// Smallest corner of the box
+	float mfCellSize;						// Size of each Cell
+	float mfInverseCellSize;				// 1 / Cell Size
+};
+
+#endif
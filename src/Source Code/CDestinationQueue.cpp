@@ -0,0 +1,151 @@
+#include "CDestinationQueue.h"
+#include "CObject.h"
+#include <cassert>		// Used to catch the queue overflowing in Debug builds
+
+//---------- SDestination Functions ----------
+
+// Default Constructor - creates an empty Destination
+SDestination::SDestination()
+{
+	iType = GiDESTINATION_TYPE_NONE;
+	sPoint = Ogre::Vector3::ZERO;
+	cpObject = NULL;
+}
+
+// Explicit Constructor - track a point in space
+SDestination::SDestination(Ogre::Vector3 _sPointInWorldCoordinatesToTrack)
+{
+	iType = GiDESTINATION_TYPE_POINT;
+	sPoint = _sPointInWorldCoordinatesToTrack;
+	cpObject = NULL;
+}
+
+// Explicit Constructor - track another Object
+SDestination::SDestination(CObject* _cpObjectToTrack)
+{
+	sPoint = Ogre::Vector3::ZERO;
+	cpObject = _cpObjectToTrack;
+
+	// If no Object was given, this Destination is empty
+	if (cpObject == NULL)
+	{
+		iType = GiDESTINATION_TYPE_NONE;
+	}
+	else
+	{
+		iType = GiDESTINATION_TYPE_OBJECT;
+		sObjectHandle = cpObject->msHandle;
+	}
+}
+
+// Returns if this Destination can still be used (it is a Point, or it is an Object which still exists)
+bool SDestination::ReturnIfValid() const
+{
+	switch (iType)
+	{
+		case GiDESTINATION_TYPE_POINT:
+			return true;
+		break;
+
+		case GiDESTINATION_TYPE_OBJECT:
+			// Objects in the Object Pool never move, so if the Object was Removed (or its Slot reused) its Handle's Generation will have changed
+			// NOTE: Only the Handle is checked, so the Destination is just as valid when running Headless (with no Scene Nodes)
+			return (cpObject->msHandle == sObjectHandle);
+		break;
+
+		default:
+		case GiDESTINATION_TYPE_NONE:
+			return false;
+		break;
+	}
+}
+
+
+
+//---------- Contructors and Setup Functions ----------
+
+// Default Constructor
+CDestinationQueue::CDestinationQueue()
+{
+	Purge();
+}
+
+// Destructor
+CDestinationQueue::~CDestinationQueue()
+{
+	Purge();
+}
+
+// Removes all Destinations from the queue
+void CDestinationQueue::Purge()
+{
+	miFrontIndex = 0;
+	miNumberOfDestinations = 0;
+}
+
+
+
+//---------- Destination Functions ----------
+
+// Adds the Destination to the front of the queue (so it is the next one gone to)
+void CDestinationQueue::PushFront(SDestination const& _sDestination)
+{
+	// The queue should never be full, since every caller Purges it (or only adds to it when it is empty) before adding a Destination
+	assert(miNumberOfDestinations < GiMAX_NUMBER_OF_DESTINATIONS && "CDestinationQueue::PushFront() - queue overflowed, GiMAX_NUMBER_OF_DESTINATIONS is too small");
+
+	// If the queue is full anyways (i.e. a Release build), drop the Destination at the back to make room
+	if (miNumberOfDestinations == GiMAX_NUMBER_OF_DESTINATIONS)
+	{
+		miNumberOfDestinations--;
+	}
+
+	// Move the front of the queue back one spot (wrapping around) and store the Destination there
+	miFrontIndex = (miFrontIndex + GiMAX_NUMBER_OF_DESTINATIONS - 1) % GiMAX_NUMBER_OF_DESTINATIONS;
+	msaDestinations[miFrontIndex] = _sDestination;
+	miNumberOfDestinations++;
+}
+
+// Adds the Destination to the back of the queue (so it is the last one gone to)
+bool CDestinationQueue::PushBack(SDestination const& _sDestination)
+{
+	// If the queue is full
+	if (miNumberOfDestinations == GiMAX_NUMBER_OF_DESTINATIONS)
+	{
+		return false;
+	}
+
+	// Store the Destination after the current back of the queue
+	msaDestinations[(miFrontIndex + miNumberOfDestinations) % GiMAX_NUMBER_OF_DESTINATIONS] = _sDestination;
+	miNumberOfDestinations++;
+
+	return true;
+}
+
+// Removes the Destination at the front of the queue and copies it into _sDestination
+bool CDestinationQueue::PopFront(SDestination& _sDestination)
+{
+	// If there are no Destinations to remove
+	if (miNumberOfDestinations == 0)
+	{
+		return false;
+	}
+
+	// Copy out the front Destination and move the front of the queue forward
+	_sDestination = msaDestinations[miFrontIndex];
+	miFrontIndex = (miFrontIndex + 1) % GiMAX_NUMBER_OF_DESTINATIONS;
+	miNumberOfDestinations--;
+
+	return true;
+}
+
+// Returns if there are no Destinations in the queue
+bool CDestinationQueue::ReturnIfEmpty() const
+{
+	return (miNumberOfDestinations == 0);
+}
+
+// Returns how many Destinations are in the queue
+int CDestinationQueue::ReturnNumberOfDestinations() const
+{
+	return miNumberOfDestinations;
+}
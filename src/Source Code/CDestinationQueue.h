@@ -0,0 +1,93 @@
+/////////////////////////////////////////////////////////////////////
+// CDestinationQueue.h (and CDestinationQueue.cpp)
+// Written by Daniel Schroeder
+// Created on October 17, 2026
+// Last Updated October 17, 2026
+//-------------------------------------------------------------------
+//   The CDestinationQueue class holds the Destinations an Object should
+// go to, in order. The Destinations are held by value in a fixed size
+// ring inside the queue itself, so adding and removing Destinations
+// never allocates or frees any memory, and copying an Object copies its
+// Destinations along with it.
+//   A Destination is either a point in the world or another Object to
+// track. Tracked Objects are held by both a pointer and a Handle, so if
+// the tracked Object is Removed from the Object Pool the Destination
+// knows it is no longer valid instead of pointing at a dead Object.
+/////////////////////////////////////////////////////////////////////
+
+#ifndef CDESTINATION_QUEUE_H
+#define CDESTINATION_QUEUE_H
+
+class CObject;			//#include "CObject.h"	// Including CObject causes a recursive definition problem
+#include "SObjectHandle.h"
+#include <Ogre.h>		// Include OGRE
+
+// Maximum number of Destinations an Object can have queued up
+const int GiMAX_NUMBER_OF_DESTINATIONS = 8;
+
+// Destination types
+const int GiDESTINATION_TYPE_NONE	= 0;
+const int GiDESTINATION_TYPE_POINT	= 1;
+const int GiDESTINATION_TYPE_OBJECT	= 2;
+
+// Structure to hold a Destination to automatically track
+struct SDestination
+{
+public:
+	int iType;						// Tells if this is a Point or an Object to track (or None)
+	Ogre::Vector3 sPoint;			// If we are tracking a point in space, it holds the point to track
+	CObject* cpObject;				// If we are tracking an Object, it holds the Object to track
+	SObjectHandle sObjectHandle;	// If we are tracking an Object, it holds the Objects Handle so we know if it still exists
+
+	// Default Constructor - creates an empty Destination
+	SDestination();
+
+	// Explicit Constructors - track a point in space, or another Object
+	SDestination(Ogre::Vector3 _sPointInWorldCoordinatesToTrack);
+	SDestination(CObject* _cpObjectToTrack);
+
+	// Returns if this Destination can still be used (it is a Point, or it is an Object which still exists)
+	bool ReturnIfValid() const;
+};
+
+class CDestinationQueue
+{
+public:
+
+	//---------- Contructors and Setup Functions ----------
+
+	CDestinationQueue();								// Default Constructor
+	~CDestinationQueue();								// Destructor
+
+	// Removes all Destinations from the queue
+	void Purge();
+
+
+	//---------- Destination Functions ----------
+
+	// Adds the Destination to the front of the queue (so it is the next one gone to)
+	// NOTE: The queue should never be full (this asserts in Debug builds), but if it is the Destination at the back of the queue is dropped to make room
+	void PushFront(SDestination const& _sDestination);
+
+	// Adds the Destination to the back of the queue (so it is the last one gone to)
+	// Returns false if the queue is full and the Destination could not be added
+	bool PushBack(SDestination const& _sDestination);
+
+	// Removes the Destination at the front of the queue and copies it into _sDestination
+	// Returns false if the queue is empty
+	bool PopFront(SDestination& _sDestination);
+
+	// Returns if there are no Destinations in the queue
+	bool ReturnIfEmpty() const;
+
+	// Returns how many Destinations are in the queue
+	int ReturnNumberOfDestinations() const;
+
+private:
+
+	SDestination msaDestinations[GiMAX_NUMBER_OF_DESTINATIONS];	// Ring holding the Destinations
+	int miFrontIndex;											// Index of the Destination at the front of the queue
+	int miNumberOfDestinations;									// How many Destinations are in the queue
+};
+
+#endif
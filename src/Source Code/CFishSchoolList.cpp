@@ -0,0 +1,339 @@
+#include "CFishSchoolList.h"
+#include "CObject.h"
+#include "CObjectPool.h"
+
+//---------- Contructors and Setup Functions ----------
+
+// Default Constructor
+CFishSchoolList::CFishSchoolList()
+{
+	msLevelMinimum = Ogre::Vector3::ZERO;
+	msLevelMaximum = Ogre::Vector3::ZERO;
+
+	Purge();
+}
+
+// Destructor
+CFishSchoolList::~CFishSchoolList()
+{
+	Purge();
+}
+
+// Removes all Schools
+void CFishSchoolList::Purge()
+{
+	mcSchoolList.clear();
+	mcFreeSchoolList.clear();
+	miNumberOfSchools = 0;
+	miNumberOfFishInSchools = 0;
+}
+
+// Sets the box the School Centres must stay within
+void CFishSchoolList::SetLevelBounds(Ogre::Vector3 _sMinimum, Ogre::Vector3 _sMaximum)
+{
+	msLevelMinimum = _sMinimum;
+	msLevelMaximum = _sMaximum;
+}
+
+
+
+//---------- School Functions ----------
+
+// Creates a School from the Fish and returns its Index
+int CFishSchoolList::CreateSchool(vector<CObject*> const& _cFishList)
+{
+	int iSchoolIndex = 0;
+	int iFish = 0;
+
+	// If there is a free slot, reuse it
+	if (!mcFreeSchoolList.empty())
+	{
+		iSchoolIndex = mcFreeSchoolList.back();
+		mcFreeSchoolList.pop_back();
+	}
+	// Else add a new slot
+	else
+	{
+		iSchoolIndex = (int)mcSchoolList.size();
+		mcSchoolList.push_back(SFishSchool());
+	}
+
+	SFishSchool& sSchool = mcSchoolList[iSchoolIndex];
+	sSchool.sCentre = Ogre::Vector3::ZERO;
+	sSchool.sDirection = Ogre::Vector3::ZERO;
+	sSchool.fSpeed = 0.0f;
+	sSchool.fSpread = 0.0f;
+	sSchool.iSpecificType = _cFishList.empty() ? -1 : _cFishList[0]->GetSpecificObjectType();
+	sSchool.cMemberList.clear();
+	sSchool.bInUse = true;
+	miNumberOfSchools++;
+
+	// The School swims at the Fish's average Position, Direction, and Speed
+	for (iFish = 0; iFish < (int)_cFishList.size(); iFish++)
+	{
+		sSchool.sCentre += _cFishList[iFish]->GetPosition();
+		sSchool.sDirection += _cFishList[iFish]->GetVelocityDirection();
+		sSchool.fSpeed += _cFishList[iFish]->GetVelocitySpeed();
+	}
+	if (!_cFishList.empty())
+	{
+		sSchool.sCentre /= (float)_cFishList.size();
+		sSchool.fSpeed /= (float)_cFishList.size();
+	}
+
+	// If the Fish were swimming in every direction, just pick one
+	if (sSchool.sDirection.normalise() < 0.0001f)
+	{
+		sSchool.sDirection = Ogre::Vector3::UNIT_Z;
+	}
+
+	// Give the School somewhere to go
+	PickNewDestination(sSchool);
+
+	// Add the Fish to the School, keeping where they are around the Centre
+	for (iFish = 0; iFish < (int)_cFishList.size(); iFish++)
+	{
+		AddMember(iSchoolIndex, _cFishList[iFish]);
+	}
+
+	return iSchoolIndex;
+}
+
+// Adds the Fish to the School, keeping its current Offset from the Centre
+void CFishSchoolList::AddMember(int _iSchoolIndex, CObject* _cpFish)
+{
+	SFishSchool& sSchool = mcSchoolList[_iSchoolIndex];
+
+	// Store which School the Fish is in and where it is in the School
+	_cpFish->mspFlocking->iSchoolIndex = _iSchoolIndex;
+	_cpFish->mspFlocking->sSchoolOffset = _cpFish->GetPosition() - sSchool.sCentre;
+	sSchool.cMemberList.push_back(_cpFish->msHandle);
+	miNumberOfFishInSchools++;
+
+	// If this is now the farthest Member from the Centre, the School has spread out
+	float fDistance = _cpFish->mspFlocking->sSchoolOffset.length();
+	if (fDistance > sSchool.fSpread)
+	{
+		sSchool.fSpread = fDistance;
+	}
+}
+
+// Removes the Fish from its School
+void CFishSchoolList::RemoveMember(CObject* _cpFish)
+{
+	int iSchoolIndex = _cpFish->mspFlocking->iSchoolIndex;
+
+	// If the Fish is not in a School
+	if (iSchoolIndex < 0 || iSchoolIndex >= (int)mcSchoolList.size() || !mcSchoolList[iSchoolIndex].bInUse)
+	{
+		return;
+	}
+
+	SFishSchool& sSchool = mcSchoolList[iSchoolIndex];
+
+	// Find the Fish in the School and replace it with the last Member
+	for (int iMember = 0; iMember < (int)sSchool.cMemberList.size(); iMember++)
+	{
+		if (sSchool.cMemberList[iMember] == _cpFish->msHandle)
+		{
+			sSchool.cMemberList[iMember] = sSchool.cMemberList.back();
+			sSchool.cMemberList.pop_back();
+			miNumberOfFishInSchools--;
+			break;
+		}
+	}
+
+	// The Fish is no longer in a School
+	_cpFish->mspFlocking->iSchoolIndex = -1;
+
+	// If the School has no Members left, Remove it
+	if (sSchool.cMemberList.empty())
+	{
+		RemoveSchool(iSchoolIndex);
+	}
+}
+
+// Turns every Member of the School back into an individual Fish and Removes the School
+void CFishSchoolList::ExpandSchool(int _iSchoolIndex, CObjectPool const& _cObjectPool)
+{
+	// If this is not a valid School
+	if (_iSchoolIndex < 0 || _iSchoolIndex >= (int)mcSchoolList.size() || !mcSchoolList[_iSchoolIndex].bInUse)
+	{
+		return;
+	}
+
+	SFishSchool& sSchool = mcSchoolList[_iSchoolIndex];
+
+	// Loop through the Members
+	for (int iMember = 0; iMember < (int)sSchool.cMemberList.size(); iMember++)
+	{
+		// If this Member has been Removed, skip it
+		CObject* cpFish = _cObjectPool.ReturnObject(sSchool.cMemberList[iMember]);
+		if (cpFish == NULL)
+		{
+			continue;
+		}
+
+		// Place the Fish where it is in the School, swimming in the School's Direction
+		cpFish->SetPosition(sSchool.sCentre + cpFish->mspFlocking->sSchoolOffset);
+		cpFish->PointObjectInDirection(sSchool.sDirection, true);
+		cpFish->SetVelocity(sSchool.sDirection, sSchool.fSpeed);
+
+		// Have the Fish carry on to the School's Destination (keeping its place in the School) until its own AI takes over
+		cpFish->mcDestinationList.Purge();
+		cpFish->mcDestinationList.PushFront(SDestination(sSchool.sDestination + cpFish->mspFlocking->sSchoolOffset));
+		cpFish->GetNextDestination();
+		cpFish->SetIfObjectShouldMoveToDestinationAutomatically(true, true);
+		cpFish->SetState(GiOBJECT_STATE_EXPLORING);
+
+		// The Fish is no longer in a School
+		cpFish->mspFlocking->iSchoolIndex = -1;
+		cpFish->mspFlocking->sSchoolOffset = Ogre::Vector3::ZERO;
+	}
+
+	// Remove the School
+	miNumberOfFishInSchools -= (int)sSchool.cMemberList.size();
+	RemoveSchool(_iSchoolIndex);
+}
+
+// Returns the Index of the closest School of the given Specific Type the Position is within _fJoinDistance of the edge of
+int CFishSchoolList::ReturnSchoolToJoin(Ogre::Vector3 _sPosition, int _iSpecificType, float _fJoinDistance) const
+{
+	int iClosestSchool = -1;
+	float fClosestDistance = 0.0f;
+
+	// Loop through the Schools
+	for (int iSchool = 0; iSchool < (int)mcSchoolList.size(); iSchool++)
+	{
+		const SFishSchool& sSchool = mcSchoolList[iSchool];
+
+		// If this slot is free, or the School is of a different type
+		if (!sSchool.bInUse || (_iSpecificType != -1 && sSchool.iSpecificType != _iSpecificType))
+		{
+			continue;
+		}
+
+		// If the Position is close enough to the School, and closer than any other School found
+		float fDistance = _sPosition.distance(sSchool.sCentre) - sSchool.fSpread;
+		if (fDistance < _fJoinDistance && (iClosestSchool == -1 || fDistance < fClosestDistance))
+		{
+			iClosestSchool = iSchool;
+			fClosestDistance = fDistance;
+		}
+	}
+
+	return iClosestSchool;
+}
+
+// Moves every School's Centre forward by the Time Step
+void CFishSchoolList::UpdateSchools(float _fTimeStep)
+{
+	// Loop through the Schools
+	for (int iSchool = 0; iSchool < (int)mcSchoolList.size(); iSchool++)
+	{
+		SFishSchool& sSchool = mcSchoolList[iSchool];
+
+		// If this slot is free
+		if (!sSchool.bInUse)
+		{
+			continue;
+		}
+
+		// If the School has reached its Destination, give it a new one
+		Ogre::Vector3 sToDestination = sSchool.sDestination - sSchool.sCentre;
+		float fDistanceToDestination = sToDestination.normalise();
+		if (fDistanceToDestination < (sSchool.fSpeed + 1.0f))
+		{
+			PickNewDestination(sSchool);
+			sToDestination = sSchool.sDestination - sSchool.sCentre;
+			sToDestination.normalise();
+		}
+
+		// Turn the School gradually towards its Destination (about half way each second)
+		float fTurnAmount = _fTimeStep * 0.5f;
+		fTurnAmount = (fTurnAmount > 1.0f) ? 1.0f : fTurnAmount;
+		sSchool.sDirection += (sToDestination - sSchool.sDirection) * fTurnAmount;
+		if (sSchool.sDirection.normalise() < 0.0001f)
+		{
+			sSchool.sDirection = sToDestination;
+		}
+
+		// Move the School forward, keeping all of its Members inside the Level Bounds
+		sSchool.sCentre += sSchool.sDirection * (sSchool.fSpeed * _fTimeStep);
+		sSchool.sCentre.makeCeil(msLevelMinimum + Ogre::Vector3(sSchool.fSpread));
+		sSchool.sCentre.makeFloor(msLevelMaximum - Ogre::Vector3(sSchool.fSpread));
+	}
+}
+
+// Returns where the Member should be placed (the School's Centre plus its Offset)
+Ogre::Vector3 CFishSchoolList::ReturnMemberPosition(CObject const* _cpFish) const
+{
+	return mcSchoolList[_cpFish->mspFlocking->iSchoolIndex].sCentre + _cpFish->mspFlocking->sSchoolOffset;
+}
+
+// Returns the Direction the School is swimming in
+Ogre::Vector3 CFishSchoolList::ReturnSchoolDirection(int _iSchoolIndex) const
+{
+	return mcSchoolList[_iSchoolIndex].sDirection;
+}
+
+
+
+//---------- Query Functions ----------
+
+// Returns how many School slots there are (some may be free)
+int CFishSchoolList::ReturnNumberOfSchoolSlots() const
+{
+	return (int)mcSchoolList.size();
+}
+
+// Returns if the School slot holds a School
+bool CFishSchoolList::ReturnIfSchoolIsInUse(int _iSchoolIndex) const
+{
+	return (_iSchoolIndex >= 0 && _iSchoolIndex < (int)mcSchoolList.size() && mcSchoolList[_iSchoolIndex].bInUse);
+}
+
+// Returns the School's Centre
+Ogre::Vector3 CFishSchoolList::ReturnSchoolCentre(int _iSchoolIndex) const
+{
+	return mcSchoolList[_iSchoolIndex].sCentre;
+}
+
+// Returns the distance from the School's Centre to its farthest Member
+float CFishSchoolList::ReturnSchoolSpread(int _iSchoolIndex) const
+{
+	return mcSchoolList[_iSchoolIndex].fSpread;
+}
+
+// Returns how many Schools there are
+int CFishSchoolList::ReturnNumberOfSchools() const
+{
+	return miNumberOfSchools;
+}
+
+// Returns how many Fish are in the Schools
+int CFishSchoolList::ReturnNumberOfFishInSchools() const
+{
+	return miNumberOfFishInSchools;
+}
+
+// Gives the School a new random Destination inside of the Level Bounds
+void CFishSchoolList::PickNewDestination(SFishSchool& _sSchool)
+{
+	// Keep the whole School inside of the Level Bounds
+	Ogre::Vector3 sMinimum = msLevelMinimum + Ogre::Vector3(_sSchool.fSpread);
+	Ogre::Vector3 sMaximum = msLevelMaximum - Ogre::Vector3(_sSchool.fSpread);
+
+	_sSchool.sDestination.x = Ogre::Math::RangeRandom(sMinimum.x, sMaximum.x);
+	_sSchool.sDestination.y = Ogre::Math::RangeRandom(sMinimum.y, sMaximum.y);
+	_sSchool.sDestination.z = Ogre::Math::RangeRandom(sMinimum.z, sMaximum.z);
+}
+
+// Frees the School's slot so it can be reused
+void CFishSchoolList::RemoveSchool(int _iSchoolIndex)
+{
+	mcSchoolList[_iSchoolIndex].bInUse = false;
+	mcSchoolList[_iSchoolIndex].cMemberList.clear();
+	mcFreeSchoolList.push_back(_iSchoolIndex);
+	miNumberOfSchools--;
+}
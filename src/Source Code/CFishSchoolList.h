@@ -0,0 +1,126 @@
+/////////////////////////////////////////////////////////////////////
+// CFishSchoolList.h (and CFishSchoolList.cpp)
+// Written by Daniel Schroeder
+// Created on October 17, 2026
+// Last Updated October 17, 2026
+//-------------------------------------------------------------------
+//   The CFishSchoolList class holds Schools of Flocking Fish which are
+// being simulated as a single agent. A School is Created from Fish which
+// are close together (and far from the Player and Shark); from then on
+// only the School's Centre moves (wandering between random Destinations
+// at the Fish's average Speed), and each Member just keeps the Offset it
+// had from the Centre when it joined. This keeps the shape (spread) of
+// the School while costing nothing per Fish except placing it.
+//   When the Player or Shark comes close, ExpandSchool() turns the
+// Members back into individual Fish, swimming in the School's Direction
+// towards its Destination, so the Flocking AI can take over from there.
+//   Each Member's School Index and Offset are kept in its AI Helper, and
+// ReturnMemberPosition() gives where a Member should be placed.
+/////////////////////////////////////////////////////////////////////
+
+#ifndef CFISH_SCHOOL_LIST_H
+#define CFISH_SCHOOL_LIST_H
+
+class CObject;
+class CObjectPool;
+#include "SObjectHandle.h"
+#include <Ogre.h>		// Include OGRE
+#include <vector>
+using namespace std;
+
+// Fewest Fish which can form a School (fewer are left as individual Fish)
+const int GiMIN_NUMBER_OF_FISH_IN_SCHOOL = 4;
+
+class CFishSchoolList
+{
+public:
+
+	//---------- Contructors and Setup Functions ----------
+
+	CFishSchoolList();									// Default Constructor
+	~CFishSchoolList();									// Destructor
+
+	// Removes all Schools (without touching their Members, so only use this when the Fish are being Removed too)
+	void Purge();
+
+	// Sets the box the School Centres must stay within
+	void SetLevelBounds(Ogre::Vector3 _sMinimum, Ogre::Vector3 _sMaximum);
+
+
+	//---------- School Functions ----------
+
+	// Creates a School from the Fish (which must not already be in a School) and returns its Index
+	// NOTE: The Fish's current Positions become the shape of the School
+	int CreateSchool(vector<CObject*> const& _cFishList);
+
+	// Adds the Fish (which must not already be in a School) to the School, keeping its current Offset from the Centre
+	void AddMember(int _iSchoolIndex, CObject* _cpFish);
+
+	// Removes the Fish from its School (the School is Removed if it has no Members left)
+	void RemoveMember(CObject* _cpFish);
+
+	// Turns every Member of the School back into an individual Fish and Removes the School
+	// _cObjectPool is used to find the Members (any which have been Removed are skipped)
+	void ExpandSchool(int _iSchoolIndex, CObjectPool const& _cObjectPool);
+
+	// Returns the Index of the closest School of the given Specific Type (-1 for any type) the Position is within
+	//	_fJoinDistance of the edge of, or -1 if there are none
+	int ReturnSchoolToJoin(Ogre::Vector3 _sPosition, int _iSpecificType, float _fJoinDistance) const;
+
+	// Moves every School's Centre forward by the Time Step (in seconds)
+	void UpdateSchools(float _fTimeStep);
+
+	// Returns where the Member should be placed (the School's Centre plus its Offset)
+	Ogre::Vector3 ReturnMemberPosition(CObject const* _cpFish) const;
+
+	// Returns the Direction the School is swimming in
+	Ogre::Vector3 ReturnSchoolDirection(int _iSchoolIndex) const;
+
+
+	//---------- Query Functions ----------
+
+	// Returns how many School slots there are (some may be free)
+	int ReturnNumberOfSchoolSlots() const;
+
+	// Returns if the School slot holds a School
+	bool ReturnIfSchoolIsInUse(int _iSchoolIndex) const;
+
+	// Returns the School's Centre, and the distance from it to its farthest Member
+	Ogre::Vector3 ReturnSchoolCentre(int _iSchoolIndex) const;
+	float ReturnSchoolSpread(int _iSchoolIndex) const;
+
+	// Returns how many Schools there are, and how many Fish are in them
+	int ReturnNumberOfSchools() const;
+	int ReturnNumberOfFishInSchools() const;
+
+private:
+
+	// Holds one School
+	struct SFishSchool
+	{
+		Ogre::Vector3 sCentre;				// Centre of the School
+		Ogre::Vector3 sDirection;			// Direction the School is swimming in (normalised)
+		Ogre::Vector3 sDestination;			// Where the School is swimming to
+		float fSpeed;						// How fast the School swims
+		float fSpread;						// Distance from the Centre to the farthest Member
+		int iSpecificType;					// Specific Type of the Fish in the School
+		vector<SObjectHandle> cMemberList;	// The Fish in the School
+		bool bInUse;						// Tells if this slot holds a School or is free
+	};
+
+	// Gives the School a new random Destination inside of the Level Bounds
+	void PickNewDestination(SFishSchool& _sSchool);
+
+	// Frees the School's slot so it can be reused
+	void RemoveSchool(int _iSchoolIndex);
+
+	vector<SFishSchool> mcSchoolList;		// Holds the Schools
+	vector<int> mcFreeSchoolList;			// School slots which can be reused
+	int miNumberOfSchools;					// How many Schools there are
+	int miNumberOfFishInSchools;			// How many Fish are in the Schools
+
+	Ogre::Vector3 msLevelMinimum;			// Smallest corner of the box the School Centres must stay within
+	Ogre::Vector3 msLevelMaximum;			// Largest corner of the box the School Centres must stay within
+};
+
+#endif
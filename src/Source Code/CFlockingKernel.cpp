@@ -0,0 +1,605 @@
+#include "CFlockingKernel.h"
+#include "CObject.h"
+#include <cmath>			// Needed for sqrtf() function
+
+#ifdef FLOCKING_KERNEL_USE_SSE
+	#include <xmmintrin.h>	// Needed for SSE intrinsics
+#endif
+
+// Vectors shorter than this are not normalised (same as Ogre's Vector3::normalise())
+const float GfMINIMUM_LENGTH_TO_NORMALISE = 1e-08f;
+
+
+/////////////////////////////////////////////////////////////////////
+// Local Helper Functions
+
+// Normalises the given Vector and returns its original Length
+static float NormaliseScalar(float& _fX, float& _fY, float& _fZ)
+{
+	float fLength = sqrtf((_fX * _fX) + (_fY * _fY) + (_fZ * _fZ));
+
+	// Only normalise if the Vector is long enough
+	if (fLength > GfMINIMUM_LENGTH_TO_NORMALISE)
+	{
+		float fInverseLength = 1.0f / fLength;
+		_fX *= fInverseLength;
+		_fY *= fInverseLength;
+		_fZ *= fInverseLength;
+	}
+
+	return fLength;
+}
+
+#ifdef FLOCKING_KERNEL_USE_SSE
+// Returns _sIfTrue in the lanes where the Mask is set, and _sIfFalse in the others
+static inline __m128 SelectSSE(__m128 _sMask, __m128 _sIfTrue, __m128 _sIfFalse)
+{
+	return _mm_or_ps(_mm_and_ps(_sMask, _sIfTrue), _mm_andnot_ps(_sMask, _sIfFalse));
+}
+
+// Normalises the 4 given Vectors and returns their original Lengths
+static inline __m128 NormaliseSSE(__m128& _sX, __m128& _sY, __m128& _sZ)
+{
+	__m128 sLength = _mm_sqrt_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(_sX, _sX), _mm_mul_ps(_sY, _sY)), _mm_mul_ps(_sZ, _sZ)));
+
+	// Only normalise the Vectors which are long enough
+	__m128 sMask = _mm_cmpgt_ps(sLength, _mm_set1_ps(GfMINIMUM_LENGTH_TO_NORMALISE));
+	__m128 sInverseLength = _mm_div_ps(_mm_set1_ps(1.0f), sLength);
+	_sX = SelectSSE(sMask, _mm_mul_ps(_sX, sInverseLength), _sX);
+	_sY = SelectSSE(sMask, _mm_mul_ps(_sY, sInverseLength), _sY);
+	_sZ = SelectSSE(sMask, _mm_mul_ps(_sZ, sInverseLength), _sZ);
+
+	return sLength;
+}
+#endif
+
+
+
+//---------- Contructors and Setup Functions ----------
+
+// Default Constructor
+CFlockingKernel::CFlockingKernel()
+{
+	// Use SSE by default
+	mbUseSIMD = true;
+
+	Purge();
+}
+
+// Destructor
+CFlockingKernel::~CFlockingKernel()
+{
+	Purge();
+}
+
+// Removes all Fish from the Kernel (the arrays keep their memory so they do not need to be reallocated next frame)
+void CFlockingKernel::Purge()
+{
+	mcPositionXList.clear(); mcPositionYList.clear(); mcPositionZList.clear();
+	mcHeadingXList.clear(); mcHeadingYList.clear(); mcHeadingZList.clear();
+	mcSpeedList.clear();
+	mcSharkXList.clear(); mcSharkYList.clear(); mcSharkZList.clear();
+	mcBoundaryXList.clear(); mcBoundaryYList.clear(); mcBoundaryZList.clear();
+	mcSenseNeighborRangeList.clear();
+	mcSenseNeighborRangeSquaredList.clear();
+	mcSenseSharkRangeSquaredList.clear();
+	mcSenseSubmarineRangeSquaredList.clear();
+	mcAlignmentCoefficientList.clear();
+	mcCohesionCoefficientList.clear();
+	mcSeparationCoefficientList.clear();
+	mcPreditorAvoidanceCoefficientList.clear();
+
+	mcNeighborIndexList.clear();
+	mcNumberOfNeighborsList.clear();
+
+	mcNewDirectionXList.clear(); mcNewDirectionYList.clear(); mcNewDirectionZList.clear();
+	mcNewSpeedList.clear();
+	mcIsFlockingList.clear();
+
+	miNumberOfFish = 0;
+
+	msSubmarinePosition = Ogre::Vector3::ZERO;
+}
+
+// Set if SSE should be used to calculate the Flocking
+void CFlockingKernel::SetIfSIMDShouldBeUsed(bool _bUseSIMD)
+{
+	mbUseSIMD = _bUseSIMD;
+}
+
+// Return if SSE is being used to calculate the Flocking
+bool CFlockingKernel::ReturnIfSIMDIsBeingUsed() const
+{
+#ifdef FLOCKING_KERNEL_USE_SSE
+	return mbUseSIMD;
+#else
+	return false;
+#endif
+}
+
+
+
+//---------- Fish Functions ----------
+
+// Copies the Fish's Position, Direction, Speed, and Flocking values into the Kernel and returns its Index
+int CFlockingKernel::AddFish(CObject* _cpFish, SFlocking const& _sFlocking, Ogre::Vector3 _sSharkPosition, bool _bThereIsAShark, Ogre::Vector3 _sBoundarySteering)
+{
+	Ogre::Vector3 sPosition = _cpFish->GetPosition();
+	Ogre::Vector3 sHeading = _cpFish->GetDirectionObjectIsFacing();
+	float fSenseNeighborRange = _sFlocking.fSenseNeighborRange;
+	float fSenseSharkRange = _cpFish->mspFishBrain->fSenseSharkRange;
+	float fSenseSubmarineRange = _cpFish->mcAIHelper.GetSenseSubmarineRange();
+
+	// Store the Fish's values
+	mcPositionXList.push_back(sPosition.x);
+	mcPositionYList.push_back(sPosition.y);
+	mcPositionZList.push_back(sPosition.z);
+	mcHeadingXList.push_back(sHeading.x);
+	mcHeadingYList.push_back(sHeading.y);
+	mcHeadingZList.push_back(sHeading.z);
+	mcSpeedList.push_back(_cpFish->GetVelocitySpeed());
+	mcSharkXList.push_back(_sSharkPosition.x);
+	mcSharkYList.push_back(_sSharkPosition.y);
+	mcSharkZList.push_back(_sSharkPosition.z);
+	mcBoundaryXList.push_back(_sBoundarySteering.x);
+	mcBoundaryYList.push_back(_sBoundarySteering.y);
+	mcBoundaryZList.push_back(_sBoundarySteering.z);
+	mcSenseNeighborRangeList.push_back(fSenseNeighborRange);
+	mcSenseNeighborRangeSquaredList.push_back(fSenseNeighborRange * fSenseNeighborRange);
+
+	// If there are no Sharks, use a negative Range so the Fish never senses one
+	mcSenseSharkRangeSquaredList.push_back(_bThereIsAShark ? (fSenseSharkRange * fSenseSharkRange) : -1.0f);
+	mcSenseSubmarineRangeSquaredList.push_back(fSenseSubmarineRange * fSenseSubmarineRange);
+	mcAlignmentCoefficientList.push_back(_sFlocking.fAlignmentCoefficient);
+	mcCohesionCoefficientList.push_back(_sFlocking.fCohesionCoefficient);
+	mcSeparationCoefficientList.push_back(_sFlocking.fSeparationCoefficient);
+	mcPreditorAvoidanceCoefficientList.push_back(_sFlocking.fPreditorAvoidanceCoefficient);
+
+	// Make room for the Fish's Neighbors
+	mcNeighborIndexList.resize(mcNeighborIndexList.size() + GiMAX_NUMBER_OF_NEIGHBORS, 0);
+	mcNumberOfNeighborsList.push_back(0);
+
+	return miNumberOfFish++;
+}
+
+// Adds the Neighbor to the Fish's Neighbors (Neighbors should be added from closest to farthest)
+void CFlockingKernel::AddNeighbor(int _iFishIndex, int _iNeighborIndex)
+{
+	int& iNumberOfNeighbors = mcNumberOfNeighborsList[_iFishIndex];
+
+	// If the Fish already has as many Neighbors as it can hold
+	if (iNumberOfNeighbors >= GiMAX_NUMBER_OF_NEIGHBORS)
+	{
+		return;
+	}
+
+	mcNeighborIndexList[(_iFishIndex * GiMAX_NUMBER_OF_NEIGHBORS) + iNumberOfNeighbors] = _iNeighborIndex;
+	iNumberOfNeighbors++;
+}
+
+// Sets where the Submarine is so the Fish can avoid it
+void CFlockingKernel::SetSubmarinePosition(Ogre::Vector3 _sSubmarinePosition)
+{
+	msSubmarinePosition = _sSubmarinePosition;
+}
+
+// Returns how many Fish are in the Kernel
+int CFlockingKernel::ReturnNumberOfFish() const
+{
+	return miNumberOfFish;
+}
+
+
+
+//---------- Calculation Functions ----------
+
+// Calculates the new Direction and Speed of every Fish in the Kernel
+void CFlockingKernel::CalculateFlocking()
+{
+	int iIndex = 0;
+
+	// Make room for the Results
+	mcNewDirectionXList.resize(miNumberOfFish);
+	mcNewDirectionYList.resize(miNumberOfFish);
+	mcNewDirectionZList.resize(miNumberOfFish);
+	mcNewSpeedList.resize(miNumberOfFish);
+	mcIsFlockingList.resize(miNumberOfFish);
+
+#ifdef FLOCKING_KERNEL_USE_SSE
+	// If SSE should be used
+	if (mbUseSIMD)
+	{
+		// Pad the arrays so every group of 4 Fish is complete
+		PadArraysToMultipleOfFour();
+
+		// Calculate the Flocking of 4 Fish at a time
+		for (iIndex = 0; iIndex < miNumberOfFish; iIndex += 4)
+		{
+			CalculateFlockingSIMD(iIndex);
+		}
+		return;
+	}
+#endif
+
+	// Calculate the Flocking of each Fish one at a time
+	for (iIndex = 0; iIndex < miNumberOfFish; iIndex++)
+	{
+		CalculateFlockingScalar(iIndex);
+	}
+}
+
+// Returns if the Fish is Flocking (its closest Neighbor is within its Sense Neighbor Range)
+bool CFlockingKernel::ReturnIfFishIsFlocking(int _iFishIndex) const
+{
+	return (mcIsFlockingList[_iFishIndex] != 0);
+}
+
+// Returns the Direction the Fish should swim in (not normalised)
+Ogre::Vector3 CFlockingKernel::ReturnNewDirection(int _iFishIndex) const
+{
+	return Ogre::Vector3(mcNewDirectionXList[_iFishIndex], mcNewDirectionYList[_iFishIndex], mcNewDirectionZList[_iFishIndex]);
+}
+
+// Returns the Speed the Fish should swim at
+float CFlockingKernel::ReturnNewSpeed(int _iFishIndex) const
+{
+	return mcNewSpeedList[_iFishIndex];
+}
+
+
+
+//---------- Private Functions ----------
+
+// Calculates the Flocking of a single Fish without using SSE
+// NOTE: Any change made here must also be made in CalculateFlockingSIMD() (in the same order) so the results stay identical
+void CFlockingKernel::CalculateFlockingScalar(int _iFishIndex)
+{
+	int iIndex = _iFishIndex;
+	float fFishX = mcPositionXList[iIndex];
+	float fFishY = mcPositionYList[iIndex];
+	float fFishZ = mcPositionZList[iIndex];
+	float fSenseNeighborRangeSquared = mcSenseNeighborRangeSquaredList[iIndex];
+
+	float fSeparationX = 0.0f, fSeparationY = 0.0f, fSeparationZ = 0.0f;	// Cumulative Direction away from all Neighbors
+	float fCohesionX = 0.0f, fCohesionY = 0.0f, fCohesionZ = 0.0f;			// Cumulative Position of all Neighbors
+	float fAlignmentX = 0.0f, fAlignmentY = 0.0f, fAlignmentZ = 0.0f;		// Cumulative facing Direction of all Neighbors
+	float fCumulativeSpeed = 0.0f;											// Cumulative Speed of all Neighbors
+	float fNumberOfNeighbors = 0.0f;										// How many Neighbors are in range
+	bool bIsFlocking = false;												// Tells if the closest Neighbor is in range
+
+	// Loop through the Fish's Neighbors
+	int iNeighborListStart = iIndex * GiMAX_NUMBER_OF_NEIGHBORS;
+	for (int iNeighbor = 0; iNeighbor < mcNumberOfNeighborsList[iIndex]; iNeighbor++)
+	{
+		int iNeighborIndex = mcNeighborIndexList[iNeighborListStart + iNeighbor];
+
+		// Find the Direction away from this Neighbor (Separation), and the squared Distance between the Fish
+		float fAwayX = fFishX - mcPositionXList[iNeighborIndex];
+		float fAwayY = fFishY - mcPositionYList[iNeighborIndex];
+		float fAwayZ = fFishZ - mcPositionZList[iNeighborIndex];
+		float fDistanceSquared = (fAwayX * fAwayX) + (fAwayY * fAwayY) + (fAwayZ * fAwayZ);
+
+		// If this Neighbor is not within range of the Fish
+		if (!(fDistanceSquared < fSenseNeighborRangeSquared))
+		{
+			continue;
+		}
+
+		// If this is the closest Neighbor, the Fish is Flocking
+		if (iNeighbor == 0)
+		{
+			bIsFlocking = true;
+		}
+
+		// Normalise the Away Direction
+		float fDistance = NormaliseScalar(fAwayX, fAwayY, fAwayZ);
+
+		// Calculate the Distance Coefficient for Separation with this Neighbor
+		float fMaxNeighborDistance = mcSenseNeighborRangeList[iNeighborIndex];
+		float fSeparationDistanceFactor = (fMaxNeighborDistance - fDistance) / fMaxNeighborDistance;
+		fSeparationDistanceFactor = fSeparationDistanceFactor * fSeparationDistanceFactor;
+
+		// Add this Neighbors distance scaled Away Direction to the Cumulative Away Direction
+		fSeparationX = fSeparationX + (fSeparationDistanceFactor * fAwayX);
+		fSeparationY = fSeparationY + (fSeparationDistanceFactor * fAwayY);
+		fSeparationZ = fSeparationZ + (fSeparationDistanceFactor * fAwayZ);
+
+		// Add this Neighbors Position, Direction, and Speed
+		fCohesionX = fCohesionX + mcPositionXList[iNeighborIndex];
+		fCohesionY = fCohesionY + mcPositionYList[iNeighborIndex];
+		fCohesionZ = fCohesionZ + mcPositionZList[iNeighborIndex];
+		fAlignmentX = fAlignmentX + mcHeadingXList[iNeighborIndex];
+		fAlignmentY = fAlignmentY + mcHeadingYList[iNeighborIndex];
+		fAlignmentZ = fAlignmentZ + mcHeadingZList[iNeighborIndex];
+		fCumulativeSpeed = fCumulativeSpeed + mcSpeedList[iNeighborIndex];
+		fNumberOfNeighbors = fNumberOfNeighbors + 1.0f;
+	}
+
+	// If the Fish is not Flocking
+	if (!bIsFlocking)
+	{
+		mcIsFlockingList[iIndex] = 0;
+		mcNewDirectionXList[iIndex] = mcNewDirectionYList[iIndex] = mcNewDirectionZList[iIndex] = 0.0f;
+		mcNewSpeedList[iIndex] = 0.0f;
+		return;
+	}
+
+	// Use the average Speed of the Neighbors
+	float fNewSpeed = fCumulativeSpeed / fNumberOfNeighbors;
+
+	// Find the Direction to the average Position of the Neighbors (Cohesion)
+	fCohesionX = (fCohesionX / fNumberOfNeighbors) - fFishX;
+	fCohesionY = (fCohesionY / fNumberOfNeighbors) - fFishY;
+	fCohesionZ = (fCohesionZ / fNumberOfNeighbors) - fFishZ;
+
+	// Direction away from the Shark and Sub
+	float fPreditorX = 0.0f, fPreditorY = 0.0f, fPreditorZ = 0.0f;
+
+	// If the Fish can sense the Shark closest to it
+	float fAwayX = fFishX - mcSharkXList[iIndex];
+	float fAwayY = fFishY - mcSharkYList[iIndex];
+	float fAwayZ = fFishZ - mcSharkZList[iIndex];
+	if (((fAwayX * fAwayX) + (fAwayY * fAwayY) + (fAwayZ * fAwayZ)) < mcSenseSharkRangeSquaredList[iIndex])
+	{
+		// Calculate Direction away from the Shark
+		NormaliseScalar(fAwayX, fAwayY, fAwayZ);
+		fPreditorX = fAwayX;
+		fPreditorY = fAwayY;
+		fPreditorZ = fAwayZ;
+	}
+
+	// If the Fish can sense the Submarine
+	fAwayX = fFishX - msSubmarinePosition.x;
+	fAwayY = fFishY - msSubmarinePosition.y;
+	fAwayZ = fFishZ - msSubmarinePosition.z;
+	if (((fAwayX * fAwayX) + (fAwayY * fAwayY) + (fAwayZ * fAwayZ)) < mcSenseSubmarineRangeSquaredList[iIndex])
+	{
+		// Add the Direction away from the Submarine to the Direction away from the Shark
+		NormaliseScalar(fAwayX, fAwayY, fAwayZ);
+		fPreditorX = fPreditorX + fAwayX;
+		fPreditorY = fPreditorY + fAwayY;
+		fPreditorZ = fPreditorZ + fAwayZ;
+	}
+
+	// Normalise all Direction factors
+	NormaliseScalar(fAlignmentX, fAlignmentY, fAlignmentZ);
+	NormaliseScalar(fCohesionX, fCohesionY, fCohesionZ);
+	NormaliseScalar(fSeparationX, fSeparationY, fSeparationZ);
+	NormaliseScalar(fPreditorX, fPreditorY, fPreditorZ);
+
+	// Sum the vectors to find this Fish's new Direction
+	float fAlignment = mcAlignmentCoefficientList[iIndex];
+	float fCohesion = mcCohesionCoefficientList[iIndex];
+	float fSeparation = mcSeparationCoefficientList[iIndex];
+	float fPreditorAvoidance = mcPreditorAvoidanceCoefficientList[iIndex];
+	float fNewDirectionX = (((fAlignment * fAlignmentX) + (fCohesion * fCohesionX)) + (fSeparation * fSeparationX)) + (fPreditorAvoidance * fPreditorX);
+	float fNewDirectionY = (((fAlignment * fAlignmentY) + (fCohesion * fCohesionY)) + (fSeparation * fSeparationY)) + (fPreditorAvoidance * fPreditorY);
+	float fNewDirectionZ = (((fAlignment * fAlignmentZ) + (fCohesion * fCohesionZ)) + (fSeparation * fSeparationZ)) + (fPreditorAvoidance * fPreditorZ);
+
+	// Only steer away from the Boundaries the Fish is steering into
+	float fBoundaryX = ((mcBoundaryXList[iIndex] * fNewDirectionX) < 0.0f) ? mcBoundaryXList[iIndex] : 0.0f;
+	float fBoundaryY = ((mcBoundaryYList[iIndex] * fNewDirectionY) < 0.0f) ? mcBoundaryYList[iIndex] : 0.0f;
+	float fBoundaryZ = ((mcBoundaryZList[iIndex] * fNewDirectionZ) < 0.0f) ? mcBoundaryZList[iIndex] : 0.0f;
+
+	// If the Fish is steering into a Boundary, add the Direction back into the ocean to its normalised Direction
+	if (fBoundaryX != 0.0f || fBoundaryY != 0.0f || fBoundaryZ != 0.0f)
+	{
+		NormaliseScalar(fNewDirectionX, fNewDirectionY, fNewDirectionZ);
+		fNewDirectionX = fNewDirectionX + fBoundaryX;
+		fNewDirectionY = fNewDirectionY + fBoundaryY;
+		fNewDirectionZ = fNewDirectionZ + fBoundaryZ;
+	}
+
+	mcNewDirectionXList[iIndex] = fNewDirectionX;
+	mcNewDirectionYList[iIndex] = fNewDirectionY;
+	mcNewDirectionZList[iIndex] = fNewDirectionZ;
+	mcNewSpeedList[iIndex] = fNewSpeed;
+	mcIsFlockingList[iIndex] = 1;
+}
+
+// Calculates the Flocking of the 4 Fish starting at the given Index using SSE
+// NOTE: Any change made here must also be made in CalculateFlockingScalar() (in the same order) so the results stay identical
+void CFlockingKernel::CalculateFlockingSIMD(int _iFirstFishIndex)
+{
+#ifdef FLOCKING_KERNEL_USE_SSE
+	int iIndex = _iFirstFishIndex;
+	int iLane = 0;
+	__m128 sZero = _mm_setzero_ps();
+
+	// Load the 4 Fish's values
+	__m128 sFishX = _mm_loadu_ps(&mcPositionXList[iIndex]);
+	__m128 sFishY = _mm_loadu_ps(&mcPositionYList[iIndex]);
+	__m128 sFishZ = _mm_loadu_ps(&mcPositionZList[iIndex]);
+	__m128 sSenseNeighborRangeSquared = _mm_loadu_ps(&mcSenseNeighborRangeSquaredList[iIndex]);
+
+	__m128 sSeparationX = sZero, sSeparationY = sZero, sSeparationZ = sZero;
+	__m128 sCohesionX = sZero, sCohesionY = sZero, sCohesionZ = sZero;
+	__m128 sAlignmentX = sZero, sAlignmentY = sZero, sAlignmentZ = sZero;
+	__m128 sCumulativeSpeed = sZero;
+	__m128 sNumberOfNeighbors = sZero;
+	__m128 sIsFlocking = sZero;
+
+	// Find the most Neighbors any of the 4 Fish have
+	int iMaxNumberOfNeighbors = 0;
+	for (iLane = 0; iLane < 4; iLane++)
+	{
+		if (mcNumberOfNeighborsList[iIndex + iLane] > iMaxNumberOfNeighbors)
+		{
+			iMaxNumberOfNeighbors = mcNumberOfNeighborsList[iIndex + iLane];
+		}
+	}
+
+	// Loop through the Fish's Neighbors
+	for (int iNeighbor = 0; iNeighbor < iMaxNumberOfNeighbors; iNeighbor++)
+	{
+		int iaNeighborIndex[4];
+		float faHasNeighbor[4];
+
+		// Find each Fish's Neighbor (Fish without this many Neighbors use themselves and are masked out)
+		for (iLane = 0; iLane < 4; iLane++)
+		{
+			if (iNeighbor < mcNumberOfNeighborsList[iIndex + iLane])
+			{
+				iaNeighborIndex[iLane] = mcNeighborIndexList[((iIndex + iLane) * GiMAX_NUMBER_OF_NEIGHBORS) + iNeighbor];
+				faHasNeighbor[iLane] = 1.0f;
+			}
+			else
+			{
+				iaNeighborIndex[iLane] = iIndex + iLane;
+				faHasNeighbor[iLane] = 0.0f;
+			}
+		}
+
+		// Gather the Neighbors values
+		__m128 sNeighborX = _mm_set_ps(mcPositionXList[iaNeighborIndex[3]], mcPositionXList[iaNeighborIndex[2]], mcPositionXList[iaNeighborIndex[1]], mcPositionXList[iaNeighborIndex[0]]);
+		__m128 sNeighborY = _mm_set_ps(mcPositionYList[iaNeighborIndex[3]], mcPositionYList[iaNeighborIndex[2]], mcPositionYList[iaNeighborIndex[1]], mcPositionYList[iaNeighborIndex[0]]);
+		__m128 sNeighborZ = _mm_set_ps(mcPositionZList[iaNeighborIndex[3]], mcPositionZList[iaNeighborIndex[2]], mcPositionZList[iaNeighborIndex[1]], mcPositionZList[iaNeighborIndex[0]]);
+		__m128 sHeadingX = _mm_set_ps(mcHeadingXList[iaNeighborIndex[3]], mcHeadingXList[iaNeighborIndex[2]], mcHeadingXList[iaNeighborIndex[1]], mcHeadingXList[iaNeighborIndex[0]]);
+		__m128 sHeadingY = _mm_set_ps(mcHeadingYList[iaNeighborIndex[3]], mcHeadingYList[iaNeighborIndex[2]], mcHeadingYList[iaNeighborIndex[1]], mcHeadingYList[iaNeighborIndex[0]]);
+		__m128 sHeadingZ = _mm_set_ps(mcHeadingZList[iaNeighborIndex[3]], mcHeadingZList[iaNeighborIndex[2]], mcHeadingZList[iaNeighborIndex[1]], mcHeadingZList[iaNeighborIndex[0]]);
+		__m128 sSpeed = _mm_set_ps(mcSpeedList[iaNeighborIndex[3]], mcSpeedList[iaNeighborIndex[2]], mcSpeedList[iaNeighborIndex[1]], mcSpeedList[iaNeighborIndex[0]]);
+		__m128 sMaxNeighborDistance = _mm_set_ps(mcSenseNeighborRangeList[iaNeighborIndex[3]], mcSenseNeighborRangeList[iaNeighborIndex[2]],
+												 mcSenseNeighborRangeList[iaNeighborIndex[1]], mcSenseNeighborRangeList[iaNeighborIndex[0]]);
+		__m128 sHasNeighbor = _mm_cmpgt_ps(_mm_set_ps(faHasNeighbor[3], faHasNeighbor[2], faHasNeighbor[1], faHasNeighbor[0]), sZero);
+
+		// Find the Direction away from this Neighbor (Separation), and the squared Distance between the Fish
+		__m128 sAwayX = _mm_sub_ps(sFishX, sNeighborX);
+		__m128 sAwayY = _mm_sub_ps(sFishY, sNeighborY);
+		__m128 sAwayZ = _mm_sub_ps(sFishZ, sNeighborZ);
+		__m128 sDistanceSquared = _mm_add_ps(_mm_add_ps(_mm_mul_ps(sAwayX, sAwayX), _mm_mul_ps(sAwayY, sAwayY)), _mm_mul_ps(sAwayZ, sAwayZ));
+
+		// Only use the Neighbors which exist and are within range of the Fish
+		__m128 sInRange = _mm_and_ps(sHasNeighbor, _mm_cmplt_ps(sDistanceSquared, sSenseNeighborRangeSquared));
+
+		// If this is the closest Neighbor, the Fish are Flocking if it is in range
+		if (iNeighbor == 0)
+		{
+			sIsFlocking = sInRange;
+		}
+
+		// Normalise the Away Direction
+		__m128 sDistance = NormaliseSSE(sAwayX, sAwayY, sAwayZ);
+
+		// Calculate the Distance Coefficient for Separation with this Neighbor
+		__m128 sSeparationDistanceFactor = _mm_div_ps(_mm_sub_ps(sMaxNeighborDistance, sDistance), sMaxNeighborDistance);
+		sSeparationDistanceFactor = _mm_mul_ps(sSeparationDistanceFactor, sSeparationDistanceFactor);
+
+		// Add this Neighbors distance scaled Away Direction to the Cumulative Away Direction
+		sSeparationX = SelectSSE(sInRange, _mm_add_ps(sSeparationX, _mm_mul_ps(sSeparationDistanceFactor, sAwayX)), sSeparationX);
+		sSeparationY = SelectSSE(sInRange, _mm_add_ps(sSeparationY, _mm_mul_ps(sSeparationDistanceFactor, sAwayY)), sSeparationY);
+		sSeparationZ = SelectSSE(sInRange, _mm_add_ps(sSeparationZ, _mm_mul_ps(sSeparationDistanceFactor, sAwayZ)), sSeparationZ);
+
+		// Add this Neighbors Position, Direction, and Speed
+		sCohesionX = SelectSSE(sInRange, _mm_add_ps(sCohesionX, sNeighborX), sCohesionX);
+		sCohesionY = SelectSSE(sInRange, _mm_add_ps(sCohesionY, sNeighborY), sCohesionY);
+		sCohesionZ = SelectSSE(sInRange, _mm_add_ps(sCohesionZ, sNeighborZ), sCohesionZ);
+		sAlignmentX = SelectSSE(sInRange, _mm_add_ps(sAlignmentX, sHeadingX), sAlignmentX);
+		sAlignmentY = SelectSSE(sInRange, _mm_add_ps(sAlignmentY, sHeadingY), sAlignmentY);
+		sAlignmentZ = SelectSSE(sInRange, _mm_add_ps(sAlignmentZ, sHeadingZ), sAlignmentZ);
+		sCumulativeSpeed = SelectSSE(sInRange, _mm_add_ps(sCumulativeSpeed, sSpeed), sCumulativeSpeed);
+		sNumberOfNeighbors = SelectSSE(sInRange, _mm_add_ps(sNumberOfNeighbors, _mm_set1_ps(1.0f)), sNumberOfNeighbors);
+	}
+
+	// Use the average Speed of the Neighbors
+	__m128 sNewSpeed = _mm_div_ps(sCumulativeSpeed, sNumberOfNeighbors);
+
+	// Find the Direction to the average Position of the Neighbors (Cohesion)
+	sCohesionX = _mm_sub_ps(_mm_div_ps(sCohesionX, sNumberOfNeighbors), sFishX);
+	sCohesionY = _mm_sub_ps(_mm_div_ps(sCohesionY, sNumberOfNeighbors), sFishY);
+	sCohesionZ = _mm_sub_ps(_mm_div_ps(sCohesionZ, sNumberOfNeighbors), sFishZ);
+
+	// If the Fish can sense the Shark closest to them, calculate the Direction away from the Shark
+	__m128 sAwayX = _mm_sub_ps(sFishX, _mm_loadu_ps(&mcSharkXList[iIndex]));
+	__m128 sAwayY = _mm_sub_ps(sFishY, _mm_loadu_ps(&mcSharkYList[iIndex]));
+	__m128 sAwayZ = _mm_sub_ps(sFishZ, _mm_loadu_ps(&mcSharkZList[iIndex]));
+	__m128 sInRange = _mm_cmplt_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(sAwayX, sAwayX), _mm_mul_ps(sAwayY, sAwayY)), _mm_mul_ps(sAwayZ, sAwayZ)),
+								   _mm_loadu_ps(&mcSenseSharkRangeSquaredList[iIndex]));
+	NormaliseSSE(sAwayX, sAwayY, sAwayZ);
+	__m128 sPreditorX = SelectSSE(sInRange, sAwayX, sZero);
+	__m128 sPreditorY = SelectSSE(sInRange, sAwayY, sZero);
+	__m128 sPreditorZ = SelectSSE(sInRange, sAwayZ, sZero);
+
+	// If the Fish can sense the Submarine, add the Direction away from the Submarine to the Direction away from the Shark
+	sAwayX = _mm_sub_ps(sFishX, _mm_set1_ps(msSubmarinePosition.x));
+	sAwayY = _mm_sub_ps(sFishY, _mm_set1_ps(msSubmarinePosition.y));
+	sAwayZ = _mm_sub_ps(sFishZ, _mm_set1_ps(msSubmarinePosition.z));
+	sInRange = _mm_cmplt_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(sAwayX, sAwayX), _mm_mul_ps(sAwayY, sAwayY)), _mm_mul_ps(sAwayZ, sAwayZ)),
+							_mm_loadu_ps(&mcSenseSubmarineRangeSquaredList[iIndex]));
+	NormaliseSSE(sAwayX, sAwayY, sAwayZ);
+	sPreditorX = SelectSSE(sInRange, _mm_add_ps(sPreditorX, sAwayX), sPreditorX);
+	sPreditorY = SelectSSE(sInRange, _mm_add_ps(sPreditorY, sAwayY), sPreditorY);
+	sPreditorZ = SelectSSE(sInRange, _mm_add_ps(sPreditorZ, sAwayZ), sPreditorZ);
+
+	// Normalise all Direction factors
+	NormaliseSSE(sAlignmentX, sAlignmentY, sAlignmentZ);
+	NormaliseSSE(sCohesionX, sCohesionY, sCohesionZ);
+	NormaliseSSE(sSeparationX, sSeparationY, sSeparationZ);
+	NormaliseSSE(sPreditorX, sPreditorY, sPreditorZ);
+
+	// Sum the vectors to find the Fish's new Directions
+	__m128 sAlignment = _mm_loadu_ps(&mcAlignmentCoefficientList[iIndex]);
+	__m128 sCohesion = _mm_loadu_ps(&mcCohesionCoefficientList[iIndex]);
+	__m128 sSeparation = _mm_loadu_ps(&mcSeparationCoefficientList[iIndex]);
+	__m128 sPreditorAvoidance = _mm_loadu_ps(&mcPreditorAvoidanceCoefficientList[iIndex]);
+	__m128 sNewDirectionX = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(sAlignment, sAlignmentX), _mm_mul_ps(sCohesion, sCohesionX)), _mm_mul_ps(sSeparation, sSeparationX)), _mm_mul_ps(sPreditorAvoidance, sPreditorX));
+	__m128 sNewDirectionY = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(sAlignment, sAlignmentY), _mm_mul_ps(sCohesion, sCohesionY)), _mm_mul_ps(sSeparation, sSeparationY)), _mm_mul_ps(sPreditorAvoidance, sPreditorY));
+	__m128 sNewDirectionZ = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(sAlignment, sAlignmentZ), _mm_mul_ps(sCohesion, sCohesionZ)), _mm_mul_ps(sSeparation, sSeparationZ)), _mm_mul_ps(sPreditorAvoidance, sPreditorZ));
+
+	// Only steer away from the Boundaries the Fish are steering into
+	__m128 sBoundaryX = _mm_loadu_ps(&mcBoundaryXList[iIndex]);
+	__m128 sBoundaryY = _mm_loadu_ps(&mcBoundaryYList[iIndex]);
+	__m128 sBoundaryZ = _mm_loadu_ps(&mcBoundaryZList[iIndex]);
+	sBoundaryX = _mm_and_ps(_mm_cmplt_ps(_mm_mul_ps(sBoundaryX, sNewDirectionX), sZero), sBoundaryX);
+	sBoundaryY = _mm_and_ps(_mm_cmplt_ps(_mm_mul_ps(sBoundaryY, sNewDirectionY), sZero), sBoundaryY);
+	sBoundaryZ = _mm_and_ps(_mm_cmplt_ps(_mm_mul_ps(sBoundaryZ, sNewDirectionZ), sZero), sBoundaryZ);
+
+	// For the Fish steering into a Boundary, add the Direction back into the ocean to their normalised Direction
+	__m128 sIntoBoundary = _mm_or_ps(_mm_or_ps(_mm_cmpneq_ps(sBoundaryX, sZero), _mm_cmpneq_ps(sBoundaryY, sZero)), _mm_cmpneq_ps(sBoundaryZ, sZero));
+	__m128 sNormalisedX = sNewDirectionX, sNormalisedY = sNewDirectionY, sNormalisedZ = sNewDirectionZ;
+	NormaliseSSE(sNormalisedX, sNormalisedY, sNormalisedZ);
+	sNewDirectionX = SelectSSE(sIntoBoundary, _mm_add_ps(sNormalisedX, sBoundaryX), sNewDirectionX);
+	sNewDirectionY = SelectSSE(sIntoBoundary, _mm_add_ps(sNormalisedY, sBoundaryY), sNewDirectionY);
+	sNewDirectionZ = SelectSSE(sIntoBoundary, _mm_add_ps(sNormalisedZ, sBoundaryZ), sNewDirectionZ);
+
+	// Fish which are not Flocking get zeroed Results
+	float faNewDirectionX[4], faNewDirectionY[4], faNewDirectionZ[4], faNewSpeed[4];
+	_mm_storeu_ps(faNewDirectionX, SelectSSE(sIsFlocking, sNewDirectionX, sZero));
+	_mm_storeu_ps(faNewDirectionY, SelectSSE(sIsFlocking, sNewDirectionY, sZero));
+	_mm_storeu_ps(faNewDirectionZ, SelectSSE(sIsFlocking, sNewDirectionZ, sZero));
+	_mm_storeu_ps(faNewSpeed, SelectSSE(sIsFlocking, sNewSpeed, sZero));
+	int iIsFlockingBits = _mm_movemask_ps(sIsFlocking);
+
+	// Store the Results of the real (not padding) Fish
+	for (iLane = 0; iLane < 4 && (iIndex + iLane) < miNumberOfFish; iLane++)
+	{
+		mcNewDirectionXList[iIndex + iLane] = faNewDirectionX[iLane];
+		mcNewDirectionYList[iIndex + iLane] = faNewDirectionY[iLane];
+		mcNewDirectionZList[iIndex + iLane] = faNewDirectionZ[iLane];
+		mcNewSpeedList[iIndex + iLane] = faNewSpeed[iLane];
+		mcIsFlockingList[iIndex + iLane] = (iIsFlockingBits >> iLane) & 1;
+	}
+#endif
+}
+
+// Pads the arrays with empty Fish so their size is a multiple of 4
+void CFlockingKernel::PadArraysToMultipleOfFour()
+{
+	unsigned int uiPaddedSize = (unsigned int)((miNumberOfFish + 3) & ~3);
+
+	// Padding Fish have no Neighbors, so they are never Flocking
+	mcPositionXList.resize(uiPaddedSize, 0.0f); mcPositionYList.resize(uiPaddedSize, 0.0f); mcPositionZList.resize(uiPaddedSize, 0.0f);
+	mcHeadingXList.resize(uiPaddedSize, 0.0f); mcHeadingYList.resize(uiPaddedSize, 0.0f); mcHeadingZList.resize(uiPaddedSize, 0.0f);
+	mcSpeedList.resize(uiPaddedSize, 0.0f);
+	mcSharkXList.resize(uiPaddedSize, 0.0f); mcSharkYList.resize(uiPaddedSize, 0.0f); mcSharkZList.resize(uiPaddedSize, 0.0f);
+	mcBoundaryXList.resize(uiPaddedSize, 0.0f); mcBoundaryYList.resize(uiPaddedSize, 0.0f); mcBoundaryZList.resize(uiPaddedSize, 0.0f);
+	mcSenseNeighborRangeList.resize(uiPaddedSize, 0.0f);
+	mcSenseNeighborRangeSquaredList.resize(uiPaddedSize, 0.0f);
+	mcSenseSharkRangeSquaredList.resize(uiPaddedSize, 0.0f);
+	mcSenseSubmarineRangeSquaredList.resize(uiPaddedSize, 0.0f);
+	mcAlignmentCoefficientList.resize(uiPaddedSize, 0.0f);
+	mcCohesionCoefficientList.resize(uiPaddedSize, 0.0f);
+	mcSeparationCoefficientList.resize(uiPaddedSize, 0.0f);
+	mcPreditorAvoidanceCoefficientList.resize(uiPaddedSize, 0.0f);
+	mcNumberOfNeighborsList.resize(uiPaddedSize, 0);
+	mcNeighborIndexList.resize(uiPaddedSize * GiMAX_NUMBER_OF_NEIGHBORS, 0);
+}
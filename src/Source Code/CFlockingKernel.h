@@ -0,0 +1,128 @@
+/////////////////////////////////////////////////////////////////////
+// CFlockingKernel.h (and CFlockingKernel.cpp)
+// Written by Daniel Schroeder
+// Created on October 17, 2026
+// Last Updated October 17, 2026
+//-------------------------------------------------------------------
+//   The CFlockingKernel class calculates the Flocking Direction and
+// Speed of many Fish at once. Each frame the Fish and their Neighbors
+// are copied into packed arrays (one array per value instead of one
+// Object per Fish), then the Separation, Alignment, Cohesion, and
+// Preditor Avoidance of 4 Fish at a time are calculated using SSE.
+// Each Fish avoids the Shark closest to it (given when it is Added), so
+// there can be any number of Sharks without the Kernel costing any more.
+// Fish steering into the edges of the ocean are also turned back using
+// the Boundary Steering given when they are Added.
+//   A scalar version of the same calculations is used when SSE is not
+// available (or turned off), and it gives exactly the same results as
+// long as floats are calculated in single precision (i.e. compiled with
+// /arch:SSE2 and without /fp:fast, which is how both of the project's
+// configurations are set up).
+/////////////////////////////////////////////////////////////////////
+
+#ifndef CFLOCKING_KERNEL_H
+#define CFLOCKING_KERNEL_H
+
+class CObject;			// Fish are only read from when they are Added
+struct SFlocking;		// A Fish's Flocking Component (see SComponents.h)
+#include <Ogre.h>		// Include OGRE
+#include <vector>
+using namespace std;
+
+// Use SSE if the compiler is targeting a processor which has it
+#if defined(_M_IX86) || defined(_M_X64) || defined(__SSE__)
+	#define FLOCKING_KERNEL_USE_SSE
+#endif
+
+class CFlockingKernel
+{
+public:
+
+	//---------- Contructors and Setup Functions ----------
+
+	CFlockingKernel();									// Default Constructor
+	~CFlockingKernel();									// Destructor
+
+	// Removes all Fish from the Kernel (should be done at the start of each frame)
+	void Purge();
+
+	// Set/Return if SSE should be used to calculate the Flocking
+	// NOTE: SSE will not be used if it was not compiled in, even if set to true
+	void SetIfSIMDShouldBeUsed(bool _bUseSIMD = true);
+	bool ReturnIfSIMDIsBeingUsed() const;
+
+
+	//---------- Fish Functions ----------
+
+	// Copies the Fish's Position, Direction, Speed, and Flocking values (from its Flocking Component _sFlocking) into the Kernel and returns its Index
+	// _sSharkPosition is where the Shark closest to the Fish is (_bThereIsAShark should be false if there are no Sharks)
+	// _sBoundarySteering is added to the Fish's Direction along the axes it is steering into a Boundary on (see CBoundaryField)
+	int AddFish(CObject* _cpFish, SFlocking const& _sFlocking, Ogre::Vector3 _sSharkPosition, bool _bThereIsAShark, Ogre::Vector3 _sBoundarySteering);
+
+	// Adds the Neighbor to the Fish's Neighbors (Neighbors should be added from closest to farthest)
+	// NOTE: Both Indices must have been returned from AddFish()
+	void AddNeighbor(int _iFishIndex, int _iNeighborIndex);
+
+	// Sets where the Submarine is so the Fish can avoid it
+	void SetSubmarinePosition(Ogre::Vector3 _sSubmarinePosition);
+
+	// Returns how many Fish are in the Kernel
+	int ReturnNumberOfFish() const;
+
+
+	//---------- Calculation Functions ----------
+
+	// Calculates the new Direction and Speed of every Fish in the Kernel
+	void CalculateFlocking();
+
+	// Returns if the Fish is Flocking (its closest Neighbor is within its Sense Neighbor Range)
+	bool ReturnIfFishIsFlocking(int _iFishIndex) const;
+
+	// Returns the Direction the Fish should swim in (not normalised), and the Speed it should swim at
+	// NOTE: These are only valid if the Fish is Flocking
+	Ogre::Vector3 ReturnNewDirection(int _iFishIndex) const;
+	float ReturnNewSpeed(int _iFishIndex) const;
+
+private:
+
+	// Calculates the Flocking of a single Fish without using SSE
+	void CalculateFlockingScalar(int _iFishIndex);
+
+	// Calculates the Flocking of the 4 Fish starting at the given Index using SSE
+	void CalculateFlockingSIMD(int _iFirstFishIndex);
+
+	// Pads the arrays with empty Fish so their size is a multiple of 4
+	void PadArraysToMultipleOfFour();
+
+	// Fish Data (one entry per Fish)
+	vector<float> mcPositionXList, mcPositionYList, mcPositionZList;	// Fish's Position
+	vector<float> mcHeadingXList, mcHeadingYList, mcHeadingZList;		// Direction Fish is facing
+	vector<float> mcSpeedList;											// Fish's Velocity Speed
+	vector<float> mcSharkXList, mcSharkYList, mcSharkZList;				// Position of the Shark closest to the Fish
+	vector<float> mcBoundaryXList, mcBoundaryYList, mcBoundaryZList;	// Steering away from the Boundaries the Fish is near
+	vector<float> mcSenseNeighborRangeList;								// Fish's Sense Neighbor Range
+	vector<float> mcSenseNeighborRangeSquaredList;						// Fish's Sense Neighbor Range squared
+	vector<float> mcSenseSharkRangeSquaredList;							// Fish's Sense Shark Range squared
+	vector<float> mcSenseSubmarineRangeSquaredList;						// Fish's Sense Submarine Range squared
+	vector<float> mcAlignmentCoefficientList;							// Fish's Flocking Coefficients
+	vector<float> mcCohesionCoefficientList;
+	vector<float> mcSeparationCoefficientList;
+	vector<float> mcPreditorAvoidanceCoefficientList;
+
+	// Neighbor Data (GiMAX_NUMBER_OF_NEIGHBORS entries per Fish)
+	vector<int> mcNeighborIndexList;			// Indices of each Fish's Neighbors
+	vector<int> mcNumberOfNeighborsList;		// How many Neighbors each Fish has
+
+	// Results (one entry per Fish)
+	vector<float> mcNewDirectionXList, mcNewDirectionYList, mcNewDirectionZList;	// Direction Fish should swim in
+	vector<float> mcNewSpeedList;													// Speed Fish should swim at
+	vector<int> mcIsFlockingList;													// Tells if the Fish is Flocking (1) or not (0)
+
+	int miNumberOfFish;							// How many Fish are in the Kernel (not counting padding)
+
+	Ogre::Vector3 msSubmarinePosition;			// Where the Submarine is
+
+	bool mbUseSIMD;								// Tells if SSE should be used
+};
+
+#endif
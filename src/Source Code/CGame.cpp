@@ -10,6 +10,12 @@ CGame::CGame()
 
 	mcpClock = CClock::ReturnSingletonInstance();
 	mcpScheduler = CScheduler::ReturnSingletonInstance();
+	mcpProfiler = CProfiler::ReturnSingletonInstance();
+
+	// Have the Objects read the Objects they are tracking from the World State snapshot
+	CObject::SetWorldState(&mcWorldState);
+
+	mbHeadless = false;
 
 	mbShowDebugHUD = true;
 
@@ -24,6 +30,7 @@ CGame::CGame()
 
 	mbReverseYAxis = false;
 	mfMouseSpeed = 1.0;
+	mfPlayerCaptureFishRange = mfPlayerGetItemRange = 0.0f;
 
 	mcpLevelTimeRemainingTextBox = NULL;
 	mfLevelTime = 0.0;
@@ -42,10 +49,34 @@ CGame::CGame()
 	mfCameraTargetTightness = 0.1f;
 	mfCameraTargetMaxOffsetAngle = 20.0f;
 
+	mfSimulationTimeStep = (1.0f / 60.0f);
+	miMaxSimulationStepsPerFrame = 5;
+	mfSimulationTimeAccumulator = 0.0f;
+	mfTimeStep = 0.0f;
+
 	mbAllowMixedFlocking = false;
+	mfSpatialGridCellSize = 0.0f;
+	mfNeighborSkinDistance = 2.0f * GiMETER;
+	mbRebuildNeighborLists = false;
+	mulNumberOfNeighborListRebuilds = 0;
+	miNumberOfAIThreads = 0;
+	mcAIScheduler.SetBudget(500.0f);
+	mcFishSchoolList.SetLevelBounds(Vector3(GiLEVEL_LEFT, GiLEVEL_BOTTOM, GiLEVEL_BACK), Vector3(GiLEVEL_RIGHT, GiLEVEL_TOP, GiLEVEL_FRONT));
+	mfFishSchoolRadius = 10.0f * GiMETER;
+	mfAINearDistance = 60.0f * GiMETER;
+	mfAIFarDistance = 150.0f * GiMETER;
+	miAIMidUpdateInterval = 4;
+	mulNumberOfAISteps = 0;
+	muiAIRandomSeed = 0;
+	for (int iLevelOfDetail = 0; iLevelOfDetail < GiNUMBER_OF_AI_LEVELS_OF_DETAIL; iLevelOfDetail++)
+	{
+		mulaNumberOfFishInEachAILevelOfDetail[iLevelOfDetail] = 0;
+	}
+	mfLargestCollisionRadius = 0.0f;
 
 	mcpPlayer = NULL;
 	mcpShark = NULL;
+	miNumberOfSharks = 1;
 
 	mcpSharkCamera = NULL;
 	mcpDesiredSharkCameraPosition = NULL;
@@ -68,6 +99,9 @@ CGame::CGame()
 // Deletes all allocated memory
 CGame::~CGame()
 {
+	// The World State is destroyed along with the Game
+	CObject::SetWorldState(NULL);
+
 	if (mcpObjectiveTextBox != NULL)
 	{	
 		delete mcpObjectiveTextBox;
@@ -151,7 +185,10 @@ bool CGame::frameEnded(const FrameEvent& _cEvent)
 	mcpClock->ReturnElapsedTimeAndResetClock();
 
 	// Process Scheduled Events
-	mcpScheduler->ProcessAllEvents();
+	{
+		PROFILE_ZONE("ProcessAllEvents");
+		mcpScheduler->ProcessAllEvents();
+	}
 
 	// Update the Debug HUD
 	UpdateDebugHUD();
@@ -476,8 +513,9 @@ void CGame::GameStateLoadingLevel(void* _vpOptionalDataToPass, EPurpose _ePurpos
 		// Clear the Scene to make sure it is empty to start with
 		cpGame->mcpSceneManager->clearScene();
 
-		// Clear out any Objects from the list
-		cpGame->mcObjectList.clear();
+		// Clear out any Objects from the Object Pool, and the snapshot of them
+		cpGame->mcObjectPool.Purge();
+		cpGame->mcWorldState.Purge();
 
 		// Release any unused resources
 		ResourceGroupManager::getSingleton().unloadUnreferencedResourcesInGroup(ResourceGroupManager::DEFAULT_RESOURCE_GROUP_NAME);
@@ -546,6 +584,12 @@ void CGame::GameStatePlay(void* _vpOptionalDataToPass, EPurpose _ePurpose)
 		// Create and initialize the TextBox to display when the Player captures a fish
 		cpGame->mcpPlayerGotPointsTextBox = new COgreText();
 		cpGame->mcpPlayerGotPointsTextBox->Show(false);
+
+		// Start with no time waiting to be Simulated (so the time spent Loading isn't Simulated)
+		cpGame->mfSimulationTimeAccumulator = 0.0f;
+
+		// Start the Fish Aging and the Shark getting hungry now that the Level is being played
+		cpGame->ScheduleDegradationEvents();
 	}
 	// Else if this State should Shutdown
 	else if (_ePurpose == eShutdown)
@@ -588,37 +632,21 @@ void CGame::GameStatePlay(void* _vpOptionalDataToPass, EPurpose _ePurpose)
 	// Else if this State is being Returned to
 	else if (_ePurpose == eReturning)
 	{
-
+		// Don't Simulate the time spent away from this State
+		cpGame->mfSimulationTimeAccumulator = 0.0f;
 	}
 	// Else this is a Normal call to this function
 
 	
 	//---------- Update All Objects ----------
 
-	// Update all Objects AI, position, and orientation
-	cpGame->UpdateObjects();
-
-
-	//---------- Process Collisions ----------
-
-	// Perform Player-Enemy collision detection
-	cpGame->PerformCollisionDetection();
+	// Run the Simulation (AI, movement, collisions, and level time) in fixed Steps for the time since the last frame,
+	//	and move the Scene Nodes to where the Objects are so they are rendered in the right place
+	cpGame->RunSimulationSteps(cpGame->mcFrameEvent.timeSinceLastFrame);
 
 
 	//---------- Update HUDs ----------
 
-	// If we are using the time for this level
-	if (cpGame->mbLevelHasTimeLimit)
-	{
-		// Update time remaining to complete the level
-		cpGame->mfLevelTime -= cpGame->mcFrameEvent.timeSinceLastFrame;
-	}
-	else
-	{
-		// Update the time spent in this level so far
-		cpGame->mfLevelTime += cpGame->mcFrameEvent.timeSinceLastFrame;
-	}
-	
 	// Display the Time in the HUD
 	cpGame->UpdateHUDs(cpGame->mfLevelTime);
 
@@ -644,7 +672,7 @@ void CGame::GameStatePlay(void* _vpOptionalDataToPass, EPurpose _ePurpose)
 		// If the Goal of the Level is to obtain a certain Score
 		case GiLEVEL_GOAL_SCORE:
 			// If the Player has the required Score
-			if (cpGame->mcpPlayer->mcAttributes.ReturnNumberOfPoints() >= cpGame->msLevelGoal.iRequiredValue)
+			if (cpGame->mcpPlayer->mcpAttributes->ReturnNumberOfPoints() >= cpGame->msLevelGoal.iRequiredValue)
 			{
 				// Record that the Player beat this level
 				bPlayerBeatLevel = true;
@@ -690,7 +718,7 @@ void CGame::GameStatePlay(void* _vpOptionalDataToPass, EPurpose _ePurpose)
 	}
 
 	// If the Player has died
-	if (cpGame->mcpPlayer->mcAttributes.ReturnHealth() < 1)
+	if (cpGame->mcpPlayer->mcpAttributes->ReturnHealth() < 1)
 	{
 		// Hide the Player
 		cpGame->mcpPlayer->mcpSceneNode->setVisible(false);
@@ -703,16 +731,158 @@ void CGame::GameStatePlay(void* _vpOptionalDataToPass, EPurpose _ePurpose)
 
 
 
+/////////////////////////////////////////////////////////////////
+// Headless Simulation Functions
+
+// Runs the given Level without a Render Window, Render System, or input for the given number of seconds
+// NOTE: This should be called instead of Go(), and the Objects are stepped by a fixed Time Step
+bool CGame::RunHeadless(int _iLevel, float _fSecondsToSimulate, float _fTimeStepInSeconds)
+{
+	// Make sure a valid Time Step was given
+	if (_fTimeStepInSeconds <= 0.0f)
+	{
+		WriteToLogFile("ERROR: Headless Time Step must be greater than zero");
+		return false;
+	}
+
+	// Record that there is nothing to render
+	mbHeadless = true;
+
+	// Create the Ogre Root without loading any Plugins (so no Render System is needed)
+	mcpRoot = new Root("", "", "Headless.log");
+
+	// Create the Scene Manager to hold the Objects Scene Nodes
+	mcpSceneManager = mcpRoot->createSceneManager(ST_GENERIC, "Headless SceneManager");
+
+	// Use Simulated Time so the Timers move forward by the Time Step instead of by the wall clock
+	mcpClock->SetIfSimulatedTimeShouldBeUsed(true);
+	mcpClock->ReturnElapsedTimeAndResetClock();
+
+	// Load the Level
+	miLevel = _iLevel;
+	msLevelGoal.Purge();
+	mcObjectPool.Purge();
+	mcWorldState.Purge();
+	miTotalNumberOfObjectsCreated = 0;
+	miFlockingFishCount = miNonFlockingFishCount = 0;
+	ReadInConfigurationFile("../../Level" + StringConverter::toString(miLevel) + ".txt", true);
+	if (!SetupLevelScene())
+	{
+		WriteToLogFile("ERROR: Could not set up Level " + StringConverter::toString(miLevel) + " for Headless simulation");
+		return false;
+	}
+
+	// Start the Fish Aging and the Shark getting hungry
+	ScheduleDegradationEvents();
+
+	// Calculate how many Ticks to simulate and how long each one is in milliseconds
+	int iNumberOfTicks = (int)(_fSecondsToSimulate / _fTimeStepInSeconds);
+	unsigned long ulTimeStepInMilliseconds = (unsigned long)((_fTimeStepInSeconds * 1000.0f) + 0.5f);
+
+	// Record when the simulation started (actual time, not Simulated Time)
+	unsigned long ulStartTime = mcpClock->ReturnSystemTime();
+
+	// Step the simulation
+	for (int iTick = 0; iTick < iNumberOfTicks; iTick++)
+	{
+		// Tell the Objects how much time has passed
+		mcFrameEvent.timeSinceLastFrame = _fTimeStepInSeconds;
+		mcFrameEvent.timeSinceLastEvent = _fTimeStepInSeconds;
+
+		// Update all Objects AI, position, and orientation, then process collisions
+		StepSimulation(_fTimeStepInSeconds);
+
+		// Keep the Scene Nodes in sync with the Objects
+		SyncObjectsToSceneNodes();
+
+		// Move the Clock forward and process any Scheduled Events
+		mcpClock->AdvanceSimulatedTime(ulTimeStepInMilliseconds);
+		mcpClock->ReturnElapsedTimeAndResetClock();
+		{
+			PROFILE_ZONE("ProcessAllEvents");
+			mcpScheduler->ProcessAllEvents();
+		}
+	}
+
+	// Calculate how long the simulation actually took
+	unsigned long ulElapsedTime = mcpClock->ReturnSystemTime() - ulStartTime;
+
+	// Write the results to the Log File
+	WriteToLogFile("Headless Level " + StringConverter::toString(miLevel) + ": " + StringConverter::toString(iNumberOfTicks) +
+		" Ticks of " + StringConverter::toString(_fTimeStepInSeconds) + "s took " + StringConverter::toString(ulElapsedTime) + "ms (" +
+		StringConverter::toString((iNumberOfTicks > 0) ? ((float)ulElapsedTime / iNumberOfTicks) : 0.0f) + "ms per Tick)");
+	WriteToLogFile("Headless Objects remaining: " + StringConverter::toString(mcObjectPool.ReturnNumberOfObjects()) + ", Flocking Fish: " +
+		StringConverter::toString(miFlockingFishCount) + ", Non-Flocking Fish: " + StringConverter::toString(miNonFlockingFishCount) +
+		", Sharks: " + StringConverter::toString((int)mcSharkList.size()));
+	WriteToLogFile("Headless Fish spawned: " + StringConverter::toString(mcPopulationController.ReturnNumberOfSpawns()) + " (at most " +
+		StringConverter::toString(mcPopulationController.ReturnMostSpawnsInAStep()) + " of a kind in one Tick, Max " +
+		StringConverter::toString(mcPopulationController.GetMaxSpawnsPerStep()) + ")");
+	WriteToLogFile("Headless Neighbor queries: " + StringConverter::toString(mcSpatialGrid.ReturnNumberOfQueries()) + ", Candidates examined: " +
+		StringConverter::toString(mcSpatialGrid.ReturnTotalNumberOfCandidatesExamined()) + " (" +
+		StringConverter::toString(mcSpatialGrid.ReturnAverageNumberOfCandidatesExamined()) + " per query, Cell Size " +
+		StringConverter::toString(mcSpatialGrid.GetCellSize() / GiMETER) + " meters)");
+	WriteToLogFile("Headless Neighbor List rebuilds: " + StringConverter::toString(mulNumberOfNeighborListRebuilds) + " of " +
+		StringConverter::toString(iNumberOfTicks) + " Ticks (Skin " + StringConverter::toString(mfNeighborSkinDistance / GiMETER) + " meters)");
+	WriteToLogFile("Headless AI Level Of Detail Fish per Step (Near/Mid/Far): " +
+		StringConverter::toString((iNumberOfTicks > 0) ? ((float)mulaNumberOfFishInEachAILevelOfDetail[GiAI_LEVEL_OF_DETAIL_NEAR] / iNumberOfTicks) : 0.0f) + " / " +
+		StringConverter::toString((iNumberOfTicks > 0) ? ((float)mulaNumberOfFishInEachAILevelOfDetail[GiAI_LEVEL_OF_DETAIL_MID] / iNumberOfTicks) : 0.0f) + " / " +
+		StringConverter::toString((iNumberOfTicks > 0) ? ((float)mulaNumberOfFishInEachAILevelOfDetail[GiAI_LEVEL_OF_DETAIL_FAR] / iNumberOfTicks) : 0.0f));
+	WriteToLogFile("Headless Fish Schools: " + StringConverter::toString(mcFishSchoolList.ReturnNumberOfSchools()) + " holding " +
+		StringConverter::toString(mcFishSchoolList.ReturnNumberOfFishInSchools()) + " Fish (Radius " + StringConverter::toString(mfFishSchoolRadius / GiMETER) + " meters)");
+	WriteToLogFile("Headless AI Scheduler Updates: " + StringConverter::toString(mcAIScheduler.ReturnNumberOfUpdates()) + ", Deferred: " +
+		StringConverter::toString(mcAIScheduler.ReturnNumberOfDeferredUpdates()) + " over " + StringConverter::toString(mcAIScheduler.ReturnNumberOfStepsOverBudget()) +
+		" Ticks (at most " + StringConverter::toString(mcAIScheduler.ReturnMostUpdatesDeferredInAStep()) + " in one Tick, Budget " +
+		StringConverter::toString(mcAIScheduler.GetBudget()) + "us, " + StringConverter::toString(mcAIScheduler.ReturnEstimatedUpdateCost()) + "us per Update)");
+	WriteToLogFile("Headless Objects moved in batches: " + StringConverter::toString(mcKinematicIntegrator.ReturnNumberOfObjectsIntegrated()) +
+		", one at a time: " + StringConverter::toString(mcKinematicIntegrator.ReturnNumberOfObjectsRejected()) +
+		" (SIMD " + StringConverter::toString(mcKinematicIntegrator.ReturnIfSIMDIsBeingUsed()) + ")");
+	WriteToLogFile("Headless AI Threads: " + StringConverter::toString(mcJobSystem.ReturnNumberOfThreads()) + ", Chunks stolen: " +
+		StringConverter::toString(mcJobSystem.ReturnNumberOfChunksStolen()));
+
+	// Stop using Simulated Time
+	mcpClock->SetIfSimulatedTimeShouldBeUsed(false);
+
+	return true;
+}
+
+
+
+/////////////////////////////////////////////////////////////////
+// Profiling Functions
+
+// Writes the Zones recorded by the Profiler to the file in Chrome's Trace Event format
+bool CGame::WriteProfileTrace(string _sFileName)
+{
+	// If the Zones were not compiled in there is nothing to write
+	if (!CProfiler::ReturnIfCompiledIn())
+	{
+		WriteToLogFile("ERROR: Could not write Profile Trace, the Profiler is not compiled in (define OCEAN_EXPLORER_PROFILER)");
+		return false;
+	}
+
+	// Write the Trace
+	if (!mcpProfiler->WriteChromeTrace(_sFileName))
+	{
+		WriteToLogFile("ERROR: Could not write Profile Trace to " + _sFileName);
+		return false;
+	}
+
+	WriteToLogFile("Profile Trace written to " + _sFileName);
+	return true;
+}
+
+
+
 /////////////////////////////////////////////////////////////////
 // Helper Functions
 
 // Sets up the initial scene of the level
 bool CGame::SetupLevelScene()
 {
+	PROFILE_ZONE("Load Level");
+
 	// Temporary local variables
 	int iIndex = 0;
-	Entity* cpEntity = NULL;
-	CObject cTempObject;
 
 	
 	/////////////////////////////////////////////////////////////
@@ -724,41 +894,88 @@ bool CGame::SetupLevelScene()
 	// How far the Player can see
 	float fPlayerViewDistance = GiLEVEL_WIDTH * 0.75f;
 
+	// Empty the Collision Grid (Objects created by the Level File are put in it as they are created)
+	mcCollisionGrid.Purge();
+	mfLargestCollisionRadius = 0.0f;
+
+	// Forget the spare Fish Scene Nodes and Entities (they were destroyed along with the last Level's Scene)
+	for (iIndex = 0; iIndex <= GiOBJECT_SPECIFIC_TYPE_FISH_INDEX_END; iIndex++)
+	{
+		mcaSpareFishSceneList[iIndex].clear();
+	}
+
+	// Remove any Events from the last Level (the Objects they were Scheduled for no longer exist)
+	mcpScheduler->RemoveAllScheduledEvents();
+
+	// If the Species have not been read in yet, read them in (they are the same for every Level, so this is only done once)
+	if (!mcSpeciesList.ReturnIfLoaded())
+	{
+		// If the Species File could not be read in, or had a mistake in it
+		if (!mcSpeciesList.ReadInSpeciesFile("../../Species.txt"))
+		{
+			WriteToLogFile("ERROR: " + mcSpeciesList.ReturnLastError());
+		}
+
+		// If the Species File could not be opened there are no Species to create the Objects from, so the Level can't be setup
+		// NOTE: A mistake in the file still leaves the rest of the Species usable, so only a missing file stops the Level
+		if (!mcSpeciesList.ReturnIfLoaded())
+		{
+			return false;
+		}
+	}
+
 
 	/////////////////////////////////////////////////////////////
 	// Setup Player
 
+	// Put the Player in the Object Pool and save a pointer to it (the Player is never Removed, so it stays valid)
+	mcpPlayer = mcObjectPool.ReturnObject(mcObjectPool.InsertNewObject());
+	mcObjectPool.AddComponent(mcpPlayer->msHandle, GiCOMPONENT_ATTRIBUTES);
+
 	// Create the Player in the middle of the ocean (0, 0, 0)
-	cTempObject.SetID(miTotalNumberOfObjectsCreated++);
-	cTempObject.SetGeneralObjectType(GiOBJECT_GENERAL_TYPE_PLAYER);
-	cTempObject.SetName("Player");
-	cTempObject.mcpEntity = mcpSceneManager->createEntity("PlayerEntity", "DansSubmarine.mesh");
-	cTempObject.mcpSceneNode = mcpSceneManager->getRootSceneNode()->createChildSceneNode("PlayerSceneNode");
-	cTempObject.mcpSceneNode->attachObject(cTempObject.mcpEntity);
-	cTempObject.mcpEntity->setCastShadows(true);
+	mcpPlayer->SetID(miTotalNumberOfObjectsCreated++);
+	mcpPlayer->SetGeneralObjectType(GiOBJECT_GENERAL_TYPE_PLAYER);
+	mcpPlayer->SetName("Player");
+	mcpPlayer->mcpSceneNode = mcpSceneManager->getRootSceneNode()->createChildSceneNode("PlayerSceneNode");
+
+	// If we are rendering, give the Player its mesh
+	if (!mbHeadless)
+	{
+		mcpPlayer->mcpEntity = mcpSceneManager->createEntity("PlayerEntity", "DansSubmarine.mesh");
+		mcpPlayer->mcpSceneNode->attachObject(mcpPlayer->mcpEntity);
+		mcpPlayer->mcpEntity->setCastShadows(true);
+	}
 
 	// Specify the direction the mesh faces by default
-	cTempObject.SetMeshesDefaultForwardDirection(Vector3::UNIT_Z);
-	cTempObject.SetMeshesDefaultUpDirection(Vector3::UNIT_Y);
-	cTempObject.SetMeshesDefaultRightDirection(Vector3::UNIT_X);
+	mcpPlayer->SetMeshesDefaultForwardDirection(Vector3::UNIT_Z);
+	mcpPlayer->SetMeshesDefaultUpDirection(Vector3::UNIT_Y);
+	mcpPlayer->SetMeshesDefaultRightDirection(Vector3::UNIT_X);
 
 	// Scale the Player to the desired size in Meters
 	float fPlayerLengthInMeters = 4.0;
-	float fPlayerSizeToMeterRatio = GetObjectLengthToMeterRatio(&cTempObject);
-	fPlayerLengthInMeters *= fPlayerSizeToMeterRatio;
-	cTempObject.mcpSceneNode->scale(fPlayerLengthInMeters, fPlayerLengthInMeters, fPlayerLengthInMeters);
-
-	// Create a Spot Light on the front of the Player
-	Light* cpPlayerSpotLight = mcpSceneManager->createLight("PlayerSpotLight");
-	cTempObject.mcpSceneNode->attachObject(cpPlayerSpotLight);
-	cpPlayerSpotLight->setType(Light::LT_SPOTLIGHT);
-	cpPlayerSpotLight->setPosition(0.0, 0.0, 1.9 * GiMETER);
-	cpPlayerSpotLight->setDirection(0.0, 0.0, 1.0);
-	cpPlayerSpotLight->setSpotlightRange(Radian(Degree(20)), Radian(Degree(30)));
-	cpPlayerSpotLight->setAttenuation(GiLEVEL_WIDTH, 1.0, 0, 0);
-	cpPlayerSpotLight->setDiffuseColour(ColourValue(0.8, 0.8, 0.8));
-	cpPlayerSpotLight->setSpecularColour(ColourValue(0.8, 0.8, 0.8));
-	cpPlayerSpotLight->setVisible(true);
+	float fPlayerSizeToMeterRatio = GetObjectLengthToMeterRatio(mcpPlayer);
+	float fPlayerScale = fPlayerLengthInMeters * fPlayerSizeToMeterRatio;
+	mcpPlayer->mcpSceneNode->scale(fPlayerScale, fPlayerScale, fPlayerScale);
+
+	// Cache the Players Bounding Radius so collision detection does not need to query the Entity
+	// NOTE: This is worked out from the Players Length (in world units) instead of the Mesh, so it is the same whether rendering or Headless
+	mcpPlayer->SetBoundingRadius(fPlayerLengthInMeters * GiMETER * 0.5);
+
+	// If we are rendering the Level
+	if (!mbHeadless)
+	{
+		// Create a Spot Light on the front of the Player
+		Light* cpPlayerSpotLight = mcpSceneManager->createLight("PlayerSpotLight");
+		mcpPlayer->mcpSceneNode->attachObject(cpPlayerSpotLight);
+		cpPlayerSpotLight->setType(Light::LT_SPOTLIGHT);
+		cpPlayerSpotLight->setPosition(0.0, 0.0, 1.9 * GiMETER);
+		cpPlayerSpotLight->setDirection(0.0, 0.0, 1.0);
+		cpPlayerSpotLight->setSpotlightRange(Radian(Degree(20)), Radian(Degree(30)));
+		cpPlayerSpotLight->setAttenuation(GiLEVEL_WIDTH, 1.0, 0, 0);
+		cpPlayerSpotLight->setDiffuseColour(ColourValue(0.8, 0.8, 0.8));
+		cpPlayerSpotLight->setSpecularColour(ColourValue(0.8, 0.8, 0.8));
+		cpPlayerSpotLight->setVisible(true);
+	}
 	
 
 	// Specify Players Acceleration and Velocities
@@ -768,27 +985,180 @@ bool CGame::SetupLevelScene()
 	float fMaxRotationVelocity = 90.0;				// Players Max Rotation Velocity
 
 	// Set Players Movement Acceleration and Max Velocities
-	cTempObject.SetDefaultAccelerationRate(fMovementAcceleration);
-	cTempObject.SetMaxVelocitySpeed(fMaxMovementVelocity);
+	mcpPlayer->SetDefaultAccelerationRate(fMovementAcceleration);
+	mcpPlayer->SetMaxVelocitySpeed(fMaxMovementVelocity);
 
 	// Set Players Rotation Acceleration and Max Velocities
-	cTempObject.SetDefaultRotationAccelerationRate(fRotationAcceleration);
-	cTempObject.SetMaxRotationVelocitySpeed(fMaxRotationVelocity);
+	mcpPlayer->SetDefaultRotationAccelerationRate(fRotationAcceleration);
+	mcpPlayer->SetMaxRotationVelocitySpeed(fMaxRotationVelocity);
 
 	// Apply Level Friction
-	cTempObject.SetFriction(mfLevelFriction);
+	mcpPlayer->SetFriction(mfLevelFriction);
 
 	// Apply gravity as an external force
-	cTempObject.mcExternalForceList.push_front(SExternalForce(Vector3::NEGATIVE_UNIT_Y * 7.0 * GiMETER, 0));
+	mcpPlayer->mcExternalForceList.push_front(SExternalForce(Vector3::NEGATIVE_UNIT_Y * 7.0 * GiMETER, 0));
 
 	// Specify how fast Mouse should rotate the Player
 	mfMouseSpeed = 3.0;
 
-	// Insert the Object into the Object List
-	mcObjectList.push_front(cTempObject);
+	// The Player must touch Fish and Items to get them, unless the Configuration Files give it a range
+	mfPlayerCaptureFishRange = mfPlayerGetItemRange = 0.0f;
+
+
+	/////////////////////////////////////////////////////////////
+	// Setup the Cameras, Lighting, and Ocean boundaries
+
+	// If we are rendering the Level (none of this is needed when running Headless)
+	if (!mbHeadless)
+	{
+		SetupLevelSurroundings(fPlayerViewDistance);
+	}
+
+
+	/////////////////////////////////////////////////////////////
+	// Setup the Shark
+
+	// Put the Shark in the Object Pool and save a pointer to it (the Shark is never Removed, so it stays valid)
+	// NOTE: This is the first Shark, the rest are created just like it once the Configuration Files have given it its settings
+	mcpShark = mcObjectPool.ReturnObject(mcObjectPool.InsertNewObject());
+	mcObjectPool.AddComponent(mcpShark->msHandle, GiCOMPONENT_SHARK_BRAIN);
+
+	// Set the Sharks ID, Name, and General Type
+	mcpShark->SetID(miTotalNumberOfObjectsCreated++);
+	mcpShark->SetName("Enemy" + StringConverter::toString(mcpShark->GetID()));
+	mcpShark->SetGeneralObjectType(GiOBJECT_GENERAL_TYPE_ENEMY);
+	mcpShark->SetSpecificObjectType(GiOBJECT_SPECIFIC_TYPE_SHARK);
+
+	// Setup the Shark, and stop if it could not be created
+	if (!CreateObject(*mcpShark))
+	{
+		mcObjectPool.RemoveObject(mcpShark->msHandle);
+		return false;
+	}
+
+	// Set how often this Objects Neighbor list should be updated
+	mcpShark->mcAIHelper.SetUpdateTimeInterval((int)Math::RangeRandom(750, 1250));
+
+	mcSharkList.clear();
+	mcSharkList.push_back(mcpShark);
+
+
+	// If we are rendering the Level
+	if (!mbHeadless)
+	{
+		// Setup the Sharks Camera System
+		mcpSharkCamera = mcpSceneManager->createCamera("SharkCamera");
+		mcSharkCameraSystem.SetupCamera("SharkCameraSystem", mcpSceneManager, mcpSharkCamera);
+		mcSharkCameraSystem.SetCameraTightness(0.2);
+		mcSharkCameraSystem.SetTargetTightness(0.2);
+
+		// Specify where we would like the Sharks Camera to be positioned and where it should point towards
+		mcpDesiredSharkCameraPosition = mcpShark->mcpSceneNode->createChildSceneNode("DesiredSharkCameraPositionSceneNode", Vector3(0, 4 * GiMETER, -150 * GiMETER));
+		mcpDesiredSharkCameraTarget = mcpShark->mcpSceneNode->createChildSceneNode("DesiredSharkCameraTargetSceneNode", Vector3(0, 0, 5 * GiMETER));
+
+		// Move the actual Camera and Target positions to the desired positions
+		mcSharkCameraSystem.SetCameraPosition(mcpDesiredSharkCameraPosition->getWorldPosition());
+		mcSharkCameraSystem.SetTargetPosition(mcpDesiredSharkCameraTarget->getWorldPosition());
+
+		// Set the Max Camera Offset Distance and Max Target Offset Angle
+		mcSharkCameraSystem.SetMaxCameraOffsetDistance(50 * GiMETER);
+		mcSharkCameraSystem.SetMaxTargetOffsetAngle(20);
+
+		// Set how close and how far the Shark Camera should start clipping at
+		mcpSharkCamera->setNearClipDistance(5.0);
+		mcpSharkCamera->setFarClipDistance(0);
+	}
+
+
+	/////////////////////////////////////////////////////////////
+	// Read in the Default Configuration File (after we have a handle to the Player and Shark)
+
+	// Read in the Default Configuration File to set default values
+	ReadInConfigurationFile("../../Defaults.txt");
+
+
+	/////////////////////////////////////////////////////////////
+	// Setup Level Specific Variables
+
+	// Load the Levels Configuration File
+	ReadInConfigurationFile("../../Level" + StringConverter::toString(miLevel) + ".txt");
+
+	// Make sure the Job System is using the number of AI Threads the Level wants
+	StartJobSystem();
+
+	// Empty the Spatial Grid and size its Cells to the range Neighbors are found in (unless a size was specified)
+	mcSpatialGrid.Purge();
+	mulNumberOfNeighborListRebuilds = 0;
+
+	// Remove every Object from the AI Scheduler (they are Inserted again as they are created)
+	mcAIScheduler.Purge();
+
+	// Create the rest of the Sharks, now that the first Shark has its settings from the Configuration Files
+	for (iIndex = 1; iIndex < miNumberOfSharks; iIndex++)
+	{
+		CreateExtraShark();
+	}
+
+	// Insert every Shark into the AI Scheduler so its Neighbors are updated periodically
+	for (iIndex = 0; iIndex < (int)mcSharkList.size(); iIndex++)
+	{
+		mcSharkList[iIndex]->mcAIHelper.miAISchedulerHandle = mcAIScheduler.InsertObject(mcSharkList[iIndex], mcSharkList[iIndex]->mcAIHelper.GetUpdateTimeInterval(), mcpClock->ReturnSavedTime());
+	}
+
+	// Build the field which tells Fish near the edges of the ocean which way to steer back into it
+	mcBoundaryField.BuildField(Vector3(GiLEVEL_LEFT, GiLEVEL_BOTTOM, GiLEVEL_BACK), Vector3(GiLEVEL_RIGHT, GiLEVEL_TOP, GiLEVEL_FRONT), GfBOUNDARY_AVOID_DISTANCE, GiMETER);
+
+	// Cover the Level with the Shark Influence Grid, and have the Sharks influence as far away as the Fish can sense them
+	mcSharkInfluenceGrid.SetBounds(Vector3(GiLEVEL_LEFT, GiLEVEL_BOTTOM, GiLEVEL_BACK), Vector3(GiLEVEL_RIGHT, GiLEVEL_TOP, GiLEVEL_FRONT), GfSHARK_INFLUENCE_CELL_SIZE);
+	mcSharkInfluenceGrid.SetInfluenceRange(msDefaultFishBrain.fSenseSharkRange);
+
+	// Keep the Objects moved by the Kinematic Integrator inside of the Level
+	mcKinematicIntegrator.SetBounds(Vector3(GiLEVEL_LEFT, GiLEVEL_BOTTOM, GiLEVEL_BACK), Vector3(GiLEVEL_RIGHT, GiLEVEL_TOP, GiLEVEL_FRONT));
+	mcKinematicIntegrator.ResetStatistics();
+	UpdateSharkInfluence();
+
+	// Remove every School (the Fish in them were Removed with the last Level)
+	mcFishSchoolList.Purge();
+	mulNumberOfAISteps = 0;
+
+	// Pick the Seed the Objects' AI random numbers are made from for this Level
+	muiAIRandomSeed = (unsigned int)rand();
+	for (iIndex = 0; iIndex < GiNUMBER_OF_AI_LEVELS_OF_DETAIL; iIndex++)
+	{
+		mulaNumberOfFishInEachAILevelOfDetail[iIndex] = 0;
+	}
+	mcSpatialGrid.SetCellSize((mfSpatialGridCellSize > 0.0f) ? mfSpatialGridCellSize : msDefaultFlocking.fSenseNeighborRange);
+
+	// Create the Flocking and Non-Flocking fish
+	CreateFishInBulk(true, miInitialFlockingFishCount);
+	CreateFishInBulk(false, miInitialNonFlockingFishCount);
+
+	// Have the Population Controller keep the number of each kind of Fish at the number created initially
+	mcPopulationController.SetTargetCount(GiPOPULATION_FLOCKING_FISH, miInitialFlockingFishCount);
+	mcPopulationController.SetTargetCount(GiPOPULATION_NON_FLOCKING_FISH, miInitialNonFlockingFishCount);
+	mcPopulationController.Reset();
+
+	// Create the spare Scene Nodes and Entities the first Fish spawned will use
+	CreateSpareFishScenes();
+
+	// Size the Collision Grids Cells to the farthest the Player or Shark can be from an Object they are touching
+	float fPlayerCollisionRange = mcpPlayer->GetBoundingRadius() + mfLargestCollisionRadius +
+		((mfPlayerGetItemRange > mfPlayerCaptureFishRange) ? mfPlayerGetItemRange : mfPlayerCaptureFishRange);
+	// NOTE: Every Shark has the same size and Feed Range as the first Shark
+	float fSharkCollisionRange = mcpShark->GetBoundingRadius() + mfLargestCollisionRadius + mcpShark->mspSharkBrain->fFeedRange;
+	float fCollisionGridCellSize = (fPlayerCollisionRange > fSharkCollisionRange) ? fPlayerCollisionRange : fSharkCollisionRange;
+	mcCollisionGrid.SetCellSize((fCollisionGridCellSize > 0.0f) ? fCollisionGridCellSize : GiMETER);
+
+	// Return that the Level was setup successfully
+	return true;
+}
 
-	// Save a handle to the Player Object
-	mcpPlayer = &mcObjectList.front();
+// Sets up the Cameras, Lighting, and Ocean boundaries of the level
+// NOTE: The Player must be created before this is called, since the Camera follows the Player
+void CGame::SetupLevelSurroundings(float _fPlayerViewDistance)
+{
+	// Temporary local variables
+	Entity* cpEntity = NULL;
 
 
 	/////////////////////////////////////////////////////////////
@@ -808,7 +1178,7 @@ bool CGame::SetupLevelScene()
 	mcCameraSystem.SetTargetPosition(mcpDesiredCameraTarget->getWorldPosition());
 
 	// Set the Max Camera Offset Distance and Max Target Offset Angle
-	mcCameraSystem.SetMaxCameraOffsetDistance(fPlayerViewDistance * 0.75);
+	mcCameraSystem.SetMaxCameraOffsetDistance(_fPlayerViewDistance * 0.75);
 	mcCameraSystem.SetMaxTargetOffsetAngle(mfCameraTargetMaxOffsetAngle);
 
 	// Set how close and how far the Camera should start clipping at
@@ -824,12 +1194,12 @@ bool CGame::SetupLevelScene()
 	// Setup Level Lighting and the Background Color
 
 	// Set up the Sky Box
-//	mcpSceneManager->setSkyBox(true, "DansMedia/OceanSkyBox", fPlayerViewDistance, false);
+//	mcpSceneManager->setSkyBox(true, "DansMedia/OceanSkyBox", _fPlayerViewDistance, false);
 
 	// Set the background and fog colour
 	msBackgroundColor = ColourValue(0, 0.2, 0.2);
 	mcpViewport->setBackgroundColour(msBackgroundColor);
-	mcpSceneManager->setFog(FOG_LINEAR, msBackgroundColor, 0.0, 0.0, fPlayerViewDistance);
+	mcpSceneManager->setFog(FOG_LINEAR, msBackgroundColor, 0.0, 0.0, _fPlayerViewDistance);
 
 	// Set ambient light
 	mcpSceneManager->setAmbientLight(ColourValue(0.2, 0.2, 0.2));
@@ -948,213 +1318,303 @@ bool CGame::SetupLevelScene()
 	mcpSceneManager->getRootSceneNode()->createChildSceneNode()->attachObject(cpEntity);
     cpEntity->setMaterialName("DansMedia/OceanWall");
     cpEntity->setCastShadows(true);
+}
 
+// Updates the Players Position based on input, and makes sure they stay in-bounds
+void CGame::UpdateObjects()
+{
+	PROFILE_ZONE("UpdateObjects");
 
-	/////////////////////////////////////////////////////////////
-	// Setup the Shark
-
-	// Set the Sharks ID, Name, and General Type
-	cTempObject.SetID(miTotalNumberOfObjectsCreated++);
-	cTempObject.SetName("Enemy" + StringConverter::toString(cTempObject.GetID()));
-	cTempObject.SetGeneralObjectType(GiOBJECT_GENERAL_TYPE_ENEMY);
-	cTempObject.SetSpecificObjectType(GiOBJECT_SPECIFIC_TYPE_SHARK);
-
-	// Setup the Shark
-	CreateObject(cTempObject);
-
-	// Set how often this Objects Neighbor list should be updated
-	cTempObject.mcAIHelper.SetUpdateTimeInterval((int)Math::RangeRandom(750, 1250));
+	// Temp local variables
+	Vector3 sObjectOldPosition = Vector3::ZERO;		// Holds objects position before moving
+	Vector3 sObjectNewPosition = Vector3::ZERO;		// Holds objects position after moving
+	Vector3 sVector = Vector3::ZERO;				// Temporary vector
+	CObject* cpObject = NULL;						// The Object being updated
+	int iIndex = 0;									// Used to loop through the Objects
+	int iThread = 0;								// Used to loop through the Job System Threads
+	int iNumberOfThreads = mcJobSystem.ReturnNumberOfThreads();
+
+	// Get the current Number of Objects, which all have Kinematics (Fish spawned this frame are not updated until next frame)
+	int iNumberOfObjects = mcObjectPool.ReturnNumberOfObjectsWithComponent(GiCOMPONENT_KINEMATICS);
+
+	// Make sure each Thread has somewhere to record its Statistics and Object Commands
+	mcCandidatesExaminedList.assign(iNumberOfThreads, 0);
+	mcNeighborQueriesList.assign(iNumberOfThreads, 0);
+	mcScheduledUpdateTicksList.assign(iNumberOfThreads, 0);
+	mcNumberOfScheduledUpdatesDoneList.assign(iNumberOfThreads, 0);
+	mcObjectCommandList.resize(iNumberOfThreads);
+
+	// Work out how many Fish may spawn this Step to replace the ones which were removed
+	mcPopulationController.Update(GiPOPULATION_FLOCKING_FISH, miFlockingFishCount, mfTimeStep);
+	mcPopulationController.Update(GiPOPULATION_NON_FLOCKING_FISH, miNonFlockingFishCount, mfTimeStep);
+
+	// Find which Objects' periodic Updates are due this Step (only as many as fit in the AI Update Budget, the rest wait their turn)
+	mcAIScheduler.SelectDueUpdates(mcpClock->ReturnSavedTime(), mcScheduledUpdateList);
+	for (iIndex = 0; iIndex < (int)mcScheduledUpdateList.size(); iIndex++)
+	{
+		mcScheduledUpdateList[iIndex]->mcAIHelper.mbScheduledUpdateDue = true;
+	}
 
-	// Insert the Object into the Object List
-	mcObjectList.push_front(cTempObject);
+	// Find where the Sharks are this Step, so the Fish can find the closest one without checking them all
+	UpdateSharkInfluence();
 
-	// Erase the temp Objects data
-	cTempObject.Purge();
+	// Expand, form, and move the Schools of far away Fish
+	UpdateFishSchools();
 
-	// Save a handle to the Shark Object
-	mcpShark = &mcObjectList.front();
+	// Work out what every Fish and Shark senses about the Sharks and the Player, so it is only done once this Step
+	UpdatePerception();
 
+	// A Fish outside of another Fish's Neighbor Candidates can only have come into its range once they have moved a
+	//	total of more than the Neighbor Skin, so the Candidates only need to be found again once any Fish in the Spatial
+	//	Grid moves half of it (including Fish in Schools or far away, since they can still be found as Candidates)
+	float fHalfNeighborSkinSquared = mfNeighborSkinDistance * 0.5f;
+	fHalfNeighborSkinSquared *= fHalfNeighborSkinSquared;
+	mbRebuildNeighborLists = false;
 
-	// Setup the Sharks Camera System
-	mcpSharkCamera = mcpSceneManager->createCamera("SharkCamera");
-	mcSharkCameraSystem.SetupCamera("SharkCameraSystem", mcpSceneManager, mcpSharkCamera);
-	mcSharkCameraSystem.SetCameraTightness(0.2);
-	mcSharkCameraSystem.SetTargetTightness(0.2);
+	// Loop through the Flocking Fish and find the ones whose Neighbors should be updated
+	mcNeighborUpdateList.clear();
+	int iNumberOfFlockingFish = mcObjectPool.ReturnNumberOfObjectsWithComponent(GiCOMPONENT_FLOCKING);
+	for (iIndex = 0; iIndex < iNumberOfFlockingFish; iIndex++)
+	{
+		SFlocking& sFlocking = mcObjectPool.ReturnFlockingAtIndex(iIndex);
+		cpObject = &mcObjectPool.ReturnObjectWithComponentAtIndex(GiCOMPONENT_FLOCKING, iIndex);
+
+		// If this Fish is in the Spatial Grid, and was not in it when the Lists were rebuilt (it was just spawned) or has
+		//	moved more than half the Skin since then
+		if (sFlocking.iSpatialGridHandle != -1 &&
+			(!sFlocking.bInNeighborLists ||
+			 cpObject->GetPosition().squaredDistance(sFlocking.sNeighborListsPosition) > fHalfNeighborSkinSquared))
+		{
+			// Every Fish's Candidates must be found again
+			mbRebuildNeighborLists = true;
+		}
 
-	// Specify where we would like the Sharks Camera to be positioned and where it should point towards
-	mcpDesiredSharkCameraPosition = mcpShark->mcpSceneNode->createChildSceneNode("DesiredSharkCameraPositionSceneNode", Vector3(0, 4 * GiMETER, -150 * GiMETER));
-	mcpDesiredSharkCameraTarget = mcpShark->mcpSceneNode->createChildSceneNode("DesiredSharkCameraTargetSceneNode", Vector3(0, 0, 5 * GiMETER));
+		// If this Fish is Dead
+		if (cpObject->GetState() == GiOBJECT_STATE_DEAD)
+		{
+			// It has no Neighbors to update
+			continue;
+		}
 
-	// Move the actual Camera and Target positions to the desired positions
-	mcSharkCameraSystem.SetCameraPosition(mcpDesiredSharkCameraPosition->getWorldPosition());
-	mcSharkCameraSystem.SetTargetPosition(mcpDesiredSharkCameraTarget->getWorldPosition());
+		// If this Fish is part of a School
+		if (sFlocking.iSchoolIndex != -1)
+		{
+			// Its School moves it, so it has no Neighbors
+			cpObject->mcAIHelper.miNumberOfNeighbors = 0;
+			sFlocking.iNumberOfNeighborCandidates = 0;
+			sFlocking.bNeighborCandidatesFound = false;
+			mulaNumberOfFishInEachAILevelOfDetail[GiAI_LEVEL_OF_DETAIL_FAR]++;
+			continue;
+		}
 
-	// Set the Max Camera Offset Distance and Max Target Offset Angle
-	mcSharkCameraSystem.SetMaxCameraOffsetDistance(50 * GiMETER);
-	mcSharkCameraSystem.SetMaxTargetOffsetAngle(20);
+		// Find how much AI the Fish should do this Step
+		sFlocking.iAILevelOfDetail = ReturnAILevelOfDetail(cpObject);
+		mulaNumberOfFishInEachAILevelOfDetail[sFlocking.iAILevelOfDetail]++;
 
-	// Set how close and how far the Shark Camera should start clipping at
-	mcpSharkCamera->setNearClipDistance(5.0);
-	mcpSharkCamera->setFarClipDistance(0);
+		// If the Fish is far from the Player and Shark
+		if (sFlocking.iAILevelOfDetail == GiAI_LEVEL_OF_DETAIL_FAR)
+		{
+			// It only wanders around, so it has no Neighbors (its Candidates are found again once it comes closer)
+			cpObject->mcAIHelper.miNumberOfNeighbors = 0;
+			sFlocking.iNumberOfNeighborCandidates = 0;
+			sFlocking.bNeighborCandidatesFound = false;
+			continue;
+		}
 
+		// Flocking Fish pick their Neighbors from their Neighbor Candidates every Step
+		mcNeighborUpdateList.push_back(cpObject);
 
-	/////////////////////////////////////////////////////////////
-	// Read in the Default Configuration File (after we have a handle to the Player and Shark)
+		// If this Fish has no Candidates yet (it was just spawned, or has come closer)
+		if (!sFlocking.bNeighborCandidatesFound)
+		{
+			// Every Fish's Candidates must be found again
+			mbRebuildNeighborLists = true;
+		}
+	}
 
-	// Initialize the Default Flocking Fish model
-	mcDefaultFlockingFish.mcAIHelper.SetIsAFlockingFish(true);
+	// If the Neighbor Lists are being rebuilt this Step
+	if (mbRebuildNeighborLists)
+	{
+		// Record where every Fish in the Spatial Grid is, so it can be told when any of them has moved more than half the Skin
+		for (iIndex = 0; iIndex < iNumberOfFlockingFish; iIndex++)
+		{
+			SFlocking& sFlocking = mcObjectPool.ReturnFlockingAtIndex(iIndex);
+			cpObject = &mcObjectPool.ReturnObjectWithComponentAtIndex(GiCOMPONENT_FLOCKING, iIndex);
+			sFlocking.bInNeighborLists = (sFlocking.iSpatialGridHandle != -1);
+			sFlocking.sNeighborListsPosition = cpObject->GetPosition();
+		}
+	}
 
-	// Read in the Default Configuration File to set default values
-	ReadInConfigurationFile("../../Defaults.txt");
+	// Loop through the Sharks and find the ones whose Neighbors should be updated
+	int iNumberOfSharks = mcObjectPool.ReturnNumberOfObjectsWithComponent(GiCOMPONENT_SHARK_BRAIN);
+	for (iIndex = 0; iIndex < iNumberOfSharks; iIndex++)
+	{
+		cpObject = &mcObjectPool.ReturnObjectWithComponentAtIndex(GiCOMPONENT_SHARK_BRAIN, iIndex);
 
+		// If it's time to update this living Sharks Neighbors
+		if (cpObject->GetState() != GiOBJECT_STATE_DEAD &&
+			(cpObject->mcAIHelper.miNumberOfNeighbors == 0 || cpObject->mcAIHelper.mbScheduledUpdateDue))
+		{
+			mcNeighborUpdateList.push_back(cpObject);
+		}
+	}
 
-	/////////////////////////////////////////////////////////////
-	// Setup Level Specific Variables
+	// Record how often the Neighbor Lists are rebuilt
+	if (mbRebuildNeighborLists)
+	{
+		mulNumberOfNeighborListRebuilds++;
+	}
 
-	// Load the Levels Configuration File
-	ReadInConfigurationFile("../../Level" + StringConverter::toString(miLevel) + ".txt");
+	// Find the Neighbors of every Object in the list, spread across all Threads (the Spatial Grid is not changed while they do)
+	mcJobSystem.ParallelFor((int)mcNeighborUpdateList.size(), 32, UpdateNeighborsJob, this);
 
-	// Loop through and create the Flocking fish
-	for (iIndex = 0; iIndex < miInitialFlockingFishCount; iIndex++)
+	// Add up the queries and Candidates each Thread examined and add them to the Spatial Grids Statistics
+	unsigned long ulNumberOfQueries = 0;
+	unsigned long ulNumberOfCandidatesExamined = 0;
+	long long llScheduledUpdateTicks = 0;
+	int iNumberOfScheduledUpdatesDone = 0;
+	for (iThread = 0; iThread < iNumberOfThreads; iThread++)
 	{
-		CreateFish(true);
+		ulNumberOfQueries += mcNeighborQueriesList[iThread];
+		ulNumberOfCandidatesExamined += mcCandidatesExaminedList[iThread];
+		llScheduledUpdateTicks += mcScheduledUpdateTicksList[iThread];
+		iNumberOfScheduledUpdatesDone += mcNumberOfScheduledUpdatesDoneList[iThread];
 	}
+	mcSpatialGrid.RecordQueryStatistics(ulNumberOfQueries, ulNumberOfCandidatesExamined);
 
-	// Loop through and create the Non-Flocking fish
-	for (iIndex = 0; iIndex < miInitialNonFlockingFishCount; iIndex++)
+	// Tell the AI Scheduler how long the periodic Updates took, so it knows how many fit in the Budget
+	mcAIScheduler.RecordUpdateCost((float)((double)llScheduledUpdateTicks * 1000000.0 / (double)mcpProfiler->ReturnTicksPerSecond()), iNumberOfScheduledUpdatesDone);
+
+	// The periodic Updates are done for this Step
+	for (iIndex = 0; iIndex < (int)mcScheduledUpdateList.size(); iIndex++)
 	{
-		CreateFish(false);
+		mcScheduledUpdateList[iIndex]->mcAIHelper.mbScheduledUpdateDue = false;
 	}
 
-	// Return that the Level was setup successfully
-	return true;
-}
+	// Calculate the Flocking of all Flocking Fish at once (used by PerformAI())
+	PerformFlocking();
 
-// Updates the Players Position based on input, and makes sure they stay in-bounds
-void CGame::UpdateObjects()
-{
-	// Temp local variables
-	Vector3 sObjectOldPosition = Vector3::ZERO;		// Holds objects position before moving
-	Vector3 sObjectNewPosition = Vector3::ZERO;		// Holds objects position after moving
-	Vector3 sVector = Vector3::ZERO;				// Temporary vector
-	list<CObject>::iterator cObjectListIterator;	// Used to loop through the Objects
+	// Loop through the Fish and find the living ones whose AI should be Performed this Step (the Sharks' AI is Performed on this Thread below)
+	mcAIObjectList.clear();
+	mulNumberOfAISteps++;
+	int iNumberOfFish = mcObjectPool.ReturnNumberOfObjectsWithComponent(GiCOMPONENT_FISH_BRAIN);
 
-	// Loop through all Objects
-	for (cObjectListIterator = mcObjectList.begin(); cObjectListIterator != mcObjectList.end(); cObjectListIterator++)
+	// The Fish which spawn this Step are picked at random from the ones which can, using random numbers made from this
+	//	Level's Seed and the Step number, and only as many as the Population Controller will let spawn are picked
+	SRandomNumberGenerator sSpawnRandom(muiAIRandomSeed ^ ((unsigned int)mulNumberOfAISteps * 0x27D4EB2FU));
+	int iaNumberOfFishWhichCanSpawn[GiNUMBER_OF_POPULATIONS];
+	for (int iPopulation = 0; iPopulation < GiNUMBER_OF_POPULATIONS; iPopulation++)
 	{
-		// If this Object is Dead
-		if (cObjectListIterator->GetState() == GiOBJECT_STATE_DEAD)
-		{
-			// Don't do any updating
-			continue;
-		}
+		mcaSpawnParentList[iPopulation].clear();
+		iaNumberOfFishWhichCanSpawn[iPopulation] = 0;
+	}
+	for (iIndex = 0; iIndex < iNumberOfFish; iIndex++)
+	{
+		cpObject = &mcObjectPool.ReturnObjectWithComponentAtIndex(GiCOMPONENT_FISH_BRAIN, iIndex);
 
-		// If this Object is an Enemy
-		if (cObjectListIterator->GetGeneralObjectType() == GiOBJECT_GENERAL_TYPE_ENEMY)
+		// If this is a living Fish which is not part of a School (only Flocking Fish can be)
+		if (cpObject->GetState() != GiOBJECT_STATE_DEAD &&
+			(cpObject->mspFlocking == NULL || cpObject->mspFlocking->iSchoolIndex == -1))
 		{
-			// If this is a Flocking Fish or the Shark
-			if (cObjectListIterator->mcAIHelper.GetIsAFlockingFish() ||
-				cObjectListIterator->GetSpecificObjectType() == GiOBJECT_SPECIFIC_TYPE_SHARK)
+			// If this Flocking Fish is a medium distance away and it is not its turn (spread out by ID so the same number do their AI each Step)
+			// NOTE: The Fish keeps swimming with the Velocity and Direction its last AI gave it
+			if (cpObject->mspFlocking != NULL &&
+				cpObject->mspFlocking->iAILevelOfDetail == GiAI_LEVEL_OF_DETAIL_MID &&
+				((mulNumberOfAISteps + (unsigned long)cpObject->GetID()) % (unsigned long)miAIMidUpdateInterval) != 0)
 			{
-				// If it's time to update this Objects Neighbor List
-				if (cObjectListIterator->mcAIHelper.mcNeighborList.empty() || 
-					cObjectListIterator->mcAIHelper.mcUpdateTimer.XTimeHasPassedUsingSavedTime(cObjectListIterator->mcAIHelper.GetUpdateTimeInterval()))
-				{
-					// Variable to iterate through the Object List
-					list<CObject>::iterator cNeighborIterator;
-
-					// Max number of Neighbors this Object can have
-					int iMaxNumOfNeighbors = cObjectListIterator->mcAIHelper.GetMaxNumberOfNeighbors();
-
-					// Variable to hold the nearest Neighbors so far, and their distance
-					SNeighbor saTempNeighborList[20];
-
-					// Forget all previous neighbors
-					cObjectListIterator->mcAIHelper.mcNeighborList.clear();
-
-					// Set the current number of Neighbors
-					int iNumOfNeighbors = 0;
+				continue;
+			}
 
-					// Loop through all Objects and look for closest neighbors
-					for (cNeighborIterator = mcObjectList.begin(); cNeighborIterator != mcObjectList.end(); cNeighborIterator++)
-					{
-						// If this Neighbor is Dead
-						if (cNeighborIterator->GetState() == GiOBJECT_STATE_DEAD)
-						{
-							// Move to the next Object
-							continue;
-						}
-
-						// Only flocking fish should be considered as Neighbors
-						if (cNeighborIterator->mcAIHelper.GetIsAFlockingFish() &&
-							cNeighborIterator->GetID() != cObjectListIterator->GetID())
-						{
-							// If Mixed Flocking is not allowed, AND this is not the Shark AND 
-							// the Neighbor is not the same Specific type as this fish
-							if (!mbAllowMixedFlocking && cObjectListIterator->GetSpecificObjectType() != GiOBJECT_SPECIFIC_TYPE_SHARK &&
-								cObjectListIterator->GetSpecificObjectType() != cNeighborIterator->GetSpecificObjectType())
-							{
-								continue;
-							}
-
-							// Calculate the squared distance to this fish (faster than calculating the actual distance)
-							unsigned int uiDistanceSquared = cObjectListIterator->mcpSceneNode->getWorldPosition().squaredDistance(cNeighborIterator->mcpSceneNode->getWorldPosition());
-							
-							// Insert this Neighbor into the end of the Temp Neighbor List
-							saTempNeighborList[iNumOfNeighbors].uiDistanceSquared = uiDistanceSquared;
-							saTempNeighborList[iNumOfNeighbors].cpNeighbor = &*cNeighborIterator;
-
-							// Use insertion-sort to sort Neighbors
-							int i, j;
-							CObject* cpObject;
-							for (i = 1; i <= iNumOfNeighbors; i++)
-							{
-								uiDistanceSquared = saTempNeighborList[i].uiDistanceSquared;
-								cpObject = saTempNeighborList[i].cpNeighbor;
-								j = i;
-								while ((j > 0) && (saTempNeighborList[j - 1].uiDistanceSquared > uiDistanceSquared))
-								{
-									saTempNeighborList[j] = saTempNeighborList[j - 1];
-									j = j - 1;
-								}
-								saTempNeighborList[j].uiDistanceSquared = uiDistanceSquared;
-								saTempNeighborList[j].cpNeighbor = cpObject;
-							}
-
-							if (iNumOfNeighbors < iMaxNumOfNeighbors)
-							{
-								// Increment the number of Neighbors found
-								iNumOfNeighbors++;
-							}
-						}
-					}
+			// Finish the Fish's Perception now that its Neighbors are updated
+			SenseClosestNeighbor(cpObject);
+			mcAIObjectList.push_back(cpObject);
 
-					// Insert the closest Neighbors into the Objects Neighbor list
-					int iPosition = 0;
-					while (saTempNeighborList[iPosition].cpNeighbor != NULL && iPosition < iMaxNumOfNeighbors)
+			// If this Fish can spawn this Step
+			if (ReturnIfFishCanSpawn(cpObject))
+			{
+				// Give it the same chance as every other Fish which can spawn of being one of the Parents (Reservoir Sampling)
+				int iPopulation = (cpObject->mspFlocking != NULL) ? GiPOPULATION_FLOCKING_FISH : GiPOPULATION_NON_FLOCKING_FISH;
+				int iNumberOfSpawnsDue = mcPopulationController.ReturnNumberOfSpawnsDue(iPopulation);
+				vector<CObject*>& cParentList = mcaSpawnParentList[iPopulation];
+				iaNumberOfFishWhichCanSpawn[iPopulation]++;
+				if ((int)cParentList.size() < iNumberOfSpawnsDue)
+				{
+					cParentList.push_back(cpObject);
+				}
+				else
+				{
+					int iParent = (int)(sSpawnRandom.ReturnNextNumber() % (unsigned int)iaNumberOfFishWhichCanSpawn[iPopulation]);
+					if (iParent < iNumberOfSpawnsDue)
 					{
-						// Insert this Object into the Neighbor list
-						cObjectListIterator->mcAIHelper.mcNeighborList.push_back(saTempNeighborList[iPosition].cpNeighbor);
-						iPosition++;
+						cParentList[iParent] = cpObject;
 					}
 				}
 			}
+		}
+	}
 
-			// Perform this Objects AI
-			PerformAI(&*cObjectListIterator);
+	// Ask to spawn a new Fish of the same type as each of the Parents picked (they are created at the end of the Step)
+	for (int iPopulation = 0; iPopulation < GiNUMBER_OF_POPULATIONS; iPopulation++)
+	{
+		for (iIndex = 0; iIndex < (int)mcaSpawnParentList[iPopulation].size(); iIndex++)
+		{
+			RequestFishSpawn(mcaSpawnParentList[iPopulation][iIndex], (iPopulation == GiPOPULATION_FLOCKING_FISH), 0);
 		}
+	}
 
-		// Save Objects Position and Orientation before moving
-		sObjectOldPosition = cObjectListIterator->mcpSceneNode->getWorldPosition();
+	// Perform the AI of every Fish, spread across all Threads
+	// NOTE: Each Fish only changes itself, and only reads the other Objects from the World State snapshot (which doesn't change until the end of the Step)
+	mcJobSystem.ParallelFor((int)mcAIObjectList.size(), 16, PerformAIJob, this);
 
-		// Update the Objects position, rotation, animation, etc
-		cObjectListIterator->Update((float)mcFrameEvent.timeSinceLastFrame);
+	// Empty the Kinematic Integrator so the Objects controlling themselves can be added to it below
+	mcKinematicIntegrator.Purge();
 
+	// Loop through all Objects (in the order their Kinematics are packed in, since that is what moving them works on)
+	for (iIndex = 0; iIndex < iNumberOfObjects; iIndex++)
+	{
+		cpObject = &mcObjectPool.ReturnObjectWithComponentAtIndex(GiCOMPONENT_KINEMATICS, iIndex);
+
+		// If this Object is Dead
+		if (cpObject->GetState() == GiOBJECT_STATE_DEAD)
+		{
+			// Don't do any updating
+			continue;
+		}
+
+		// If this Object is a Shark
+		if (cpObject->mspSharkBrain != NULL)
+		{
+			// Finish the Sharks Perception, then Perform its AI
+			SenseClosestNeighbor(cpObject);
+			PerformAI(cpObject);
+		}
+
+		// Save Objects Position and Orientation before moving
+		sObjectOldPosition = cpObject->GetPosition();
+
+		// If this Fish is part of a School
+		if (cpObject->mspFlocking != NULL && cpObject->mspFlocking->iSchoolIndex != -1)
+		{
+			// Just place it in its School, facing the way the School is swimming
+			cpObject->SetPosition(mcFishSchoolList.ReturnMemberPosition(cpObject));
+			cpObject->PointObjectInDirection(mcFishSchoolList.ReturnSchoolDirection(cpObject->mspFlocking->iSchoolIndex), true);
+		}
+		// Else if the Object is controlling itself, the Kinematic Integrator moves it (along with all of the others) below
+		else if (mcKinematicIntegrator.AddObject(cpObject) != -1)
+		{
+			continue;
+		}
+		// Else update the Objects position, rotation, animation, etc
+		else
+		{
+			cpObject->Update(mfTimeStep);
+		}
 
-		// Make sure the Object has not gone out of bounds
+
+		// Make sure the Object has not gone out of bounds
 
 		// Get the Objects new Position
-		sObjectNewPosition = cObjectListIterator->mcpSceneNode->getWorldPosition();
+		sObjectNewPosition = cpObject->GetPosition();
 
 		// If the Object has gone past the Left or Right boundary
 		if (sObjectNewPosition.x < GiLEVEL_LEFT|| sObjectNewPosition.x > GiLEVEL_RIGHT)
@@ -1178,239 +1638,615 @@ void CGame::UpdateObjects()
 		}
 
 		// If the Object is out of bounds and should be moved back in bounds
-		if (!cObjectListIterator->mcpSceneNode->getWorldPosition().positionEquals(sObjectNewPosition))
+		if (!cpObject->GetPosition().positionEquals(sObjectNewPosition))
 		{
 			// Move the Object back into a valid position
-			cObjectListIterator->mcpSceneNode->setPosition(sObjectNewPosition);
+			cpObject->SetPosition(sObjectNewPosition);
 		}
+
+		// Move it to its new Position in the Grids
+		MoveObjectInGrids(cpObject);
+	}
+
+	// Move all of the Objects controlling themselves at once (they are kept inside of the Level the same way as above)
+	{
+		PROFILE_ZONE("IntegrateObjects");
+		mcKinematicIntegrator.Integrate(mfTimeStep);
+	}
+
+	// Move the Objects the Kinematic Integrator moved to their new Positions in the Grids
+	for (iIndex = 0; iIndex < mcKinematicIntegrator.ReturnNumberOfObjects(); iIndex++)
+	{
+		MoveObjectInGrids(mcKinematicIntegrator.ReturnObject(iIndex));
 	}
 }
 
-// Perform AI on the given Object
-void CGame::PerformAI(CObject* _cpObject)
+// Moves the Object to its new Position in the Spatial and Collision Grids (if it is in them)
+void CGame::MoveObjectInGrids(CObject* _cpObject)
 {
-	// If this Object is Dead, or this is an Item
-	if (_cpObject->GetState() == GiOBJECT_STATE_DEAD || 
-		_cpObject->GetGeneralObjectType() == GiOBJECT_GENERAL_TYPE_ITEM)
+	// If this Object is a Flocking Fish in the Spatial Grid
+	if (_cpObject->mspFlocking != NULL && _cpObject->mspFlocking->iSpatialGridHandle != -1)
 	{
-		// Don't do any AI for this Object
-		return;
+		// Move it to its new Position in the Grid
+		mcSpatialGrid.UpdateObjectsPosition(_cpObject->mspFlocking->iSpatialGridHandle, _cpObject->GetPosition());
 	}
 
-	// If this is a Flocking Fish
-	if (_cpObject->mcAIHelper.GetIsAFlockingFish())
+	// If this Object is in the Collision Grid
+	if (_cpObject->mcAIHelper.miCollisionGridHandle != -1)
+	{
+		// Move it to its new Position in the Collision Grid
+		mcCollisionGrid.UpdateObjectsPosition(_cpObject->mcAIHelper.miCollisionGridHandle, _cpObject->GetPosition());
+	}
+}
+
+// Job which finds the closest Neighbors of the Objects in mcNeighborUpdateList
+void CGame::UpdateNeighborsJob(void* _vpGame, int _iStartIndex, int _iEndIndex, int _iThreadIndex)
+{
+	PROFILE_ZONE("UpdateNeighbors");
+
+	CGame* cpGame = (CGame*)_vpGame;
+	int iNumberOfCandidatesExamined = 0;
+
+	// Loop through the Objects in this Chunk
+	for (int iIndex = _iStartIndex; iIndex < _iEndIndex; iIndex++)
 	{
-		// If this Flocking Fish should Age
-		if (_cpObject->mcAIHelper.mcDegradationTimer.XTimeHasPassedUsingSavedTime(1000))
+		CObject* cpObject = cpGame->mcNeighborUpdateList[iIndex];
+
+		// Max number of Neighbors this Object can have
+		int iMaxNumOfNeighbors = cpObject->mcAIHelper.GetMaxNumberOfNeighbors();
+		if (iMaxNumOfNeighbors > GiMAX_NUMBER_OF_NEIGHBORS)
 		{
-			// Increment Fish's Age
-			_cpObject->mcAIHelper.SetAge(_cpObject->mcAIHelper.GetAge() + 1);
+			iMaxNumOfNeighbors = GiMAX_NUMBER_OF_NEIGHBORS;
 		}
 
-		// If this Fish can spawn
-		if (miFlockingFishCount < miInitialFlockingFishCount &&
-			_cpObject->mcAIHelper.GetAge() > _cpObject->mcAIHelper.GetSpawnAge() &&
-			(int)Math::RangeRandom(1, 50) == 25)
+		// The Shark looks for any Fish it can sense, while Fish look for other Fish they can flock with
+		float fRange = 0.0f;
+		int iSpecificTypeFilter = -1;
+		if (cpObject->mspSharkBrain != NULL)
 		{
-			// If the Fish cannot sense the Shark
-			float fSenseSharkRangeSquared = _cpObject->mcAIHelper.GetSenseSharkRange();
-			fSenseSharkRangeSquared *= fSenseSharkRangeSquared;
-			if (_cpObject->mcpSceneNode->getWorldPosition().squaredDistance(mcpShark->mcpSceneNode->getWorldPosition()) > fSenseSharkRangeSquared)
+			fRange = cpObject->mcAIHelper.GetSenseFishRange();
+		}
+		else
+		{
+			// Fish flock with Neighbors in their Sense Neighbor Range, and swim towards ones in their Sense Fish Range
+			fRange = cpObject->mspFlocking->fSenseNeighborRange;
+			if (cpObject->mcAIHelper.GetSenseFishRange() > fRange)
 			{
-				// Spawn a new Flocking Fish of the same type
-				CObject* cpNewFish = CreateFish(true, _cpObject->GetSpecificObjectType());
-
-				// Set both Fishes Age to zero
-				_cpObject->mcAIHelper.SetAge(0);
-				cpNewFish->mcAIHelper.SetAge(0);
+				fRange = cpObject->mcAIHelper.GetSenseFishRange();
+			}
 
-				// Position and orient the new Fish the same as this one
-				cpNewFish->mcpSceneNode->setPosition(_cpObject->mcpSceneNode->getWorldPosition());
-				cpNewFish->PointObjectInDirection(_cpObject->GetDirectionObjectIsFacing());
+			// If Mixed Flocking is not allowed, only look for Fish of the same Specific type as this fish
+			if (!cpGame->mbAllowMixedFlocking)
+			{
+				iSpecificTypeFilter = cpObject->GetSpecificObjectType();
 			}
 		}
 
-		CObject* cpNeighbor = NULL;		// Temp pointer to a Neighbor
-
-		// Loop through Fish's Neighbors until we find a valid one
-		while (!_cpObject->mcAIHelper.mcNeighborList.empty() && cpNeighbor == NULL)
+		// If this is a Flocking Fish
+		if (cpObject->mspFlocking != NULL)
 		{
-			// Get the Neighbor closest to the Fish
-			cpNeighbor = _cpObject->mcAIHelper.mcNeighborList.front();
+			// If the Neighbor Lists are being rebuilt this Step
+			if (cpGame->mbRebuildNeighborLists)
+			{
+				// Find every Fish this Fish could flock with before the Lists are rebuilt again
+				cpObject->mspFlocking->iNumberOfNeighborCandidates = cpGame->mcSpatialGrid.FindNearestNeighbors(cpObject->GetPosition(),
+					cpObject->mspFlocking->fSenseNeighborRange + cpGame->mfNeighborSkinDistance, GiMAX_NUMBER_OF_NEIGHBOR_CANDIDATES,
+					iSpecificTypeFilter, cpObject, cpObject->mspFlocking->saNeighborCandidates, &iNumberOfCandidatesExamined);
+				cpObject->mspFlocking->bNeighborCandidatesFound = true;
+
+				// Record the query this Thread has done
+				cpGame->mcNeighborQueriesList[_iThreadIndex]++;
+				cpGame->mcCandidatesExaminedList[_iThreadIndex] += iNumberOfCandidatesExamined;
+			}
+
+			// Pick the closest Candidates which are within the Fish's Sense Neighbor Range now
+			SObjectHandle saNeighbors[GiMAX_NUMBER_OF_NEIGHBORS];
+			int iNumberOfNeighbors = cpGame->ReturnNeighborsFromCandidates(cpObject, iMaxNumOfNeighbors, saNeighbors);
+
+			// If the Fish has Neighbors it can flock with
+			if (iNumberOfNeighbors > 0)
+			{
+				// Store them in this Objects Neighbors
+				for (int iNeighbor = 0; iNeighbor < iNumberOfNeighbors; iNeighbor++)
+				{
+					cpObject->mcAIHelper.msaNeighbors[iNeighbor] = saNeighbors[iNeighbor];
+				}
+				cpObject->mcAIHelper.miNumberOfNeighbors = iNumberOfNeighbors;
+				continue;
+			}
 
-			// If the Neighbor is Dead
-			if (cpNeighbor == NULL || cpNeighbor->GetState() == GiOBJECT_STATE_DEAD)
+			// Else the Fish is alone, so if the AI Scheduler did not select it to look further away for Fish to swim towards, keep the ones it has
+			if (cpObject->mcAIHelper.miNumberOfNeighbors > 0 && !cpObject->mcAIHelper.mbScheduledUpdateDue)
 			{
-				// Remove the Neighbor from the Neighbor list
-				_cpObject->mcAIHelper.mcNeighborList.pop_front();
-				cpNeighbor = NULL;
+				continue;
 			}
 		}
 
-		// If the Fish can sense a Neighbor (it is flocking)
-		float fSenseNeighborRangeSquared = _cpObject->mcAIHelper.GetSenseNeighborRange();
-		fSenseNeighborRangeSquared *= fSenseNeighborRangeSquared;
-		if (cpNeighbor != NULL && _cpObject->mcpSceneNode->getWorldPosition().squaredDistance(cpNeighbor->mcpSceneNode->getWorldPosition()) < fSenseNeighborRangeSquared)
+		// Time the query if it is the Objects periodic Update (so the AI Scheduler can learn how long they take)
+		long long llStartTicks = CProfiler::ReturnCurrentTicks();
+
+		// Find the closest Flocking Fish and store them in this Objects Neighbors
+		cpObject->mcAIHelper.miNumberOfNeighbors = cpGame->mcSpatialGrid.FindNearestNeighbors(cpObject->GetPosition(), fRange, 
+			iMaxNumOfNeighbors, iSpecificTypeFilter, cpObject, cpObject->mcAIHelper.msaNeighbors, &iNumberOfCandidatesExamined);
+
+		// Record the query this Thread has done
+		cpGame->mcNeighborQueriesList[_iThreadIndex]++;
+		cpGame->mcCandidatesExaminedList[_iThreadIndex] += iNumberOfCandidatesExamined;
+		if (cpObject->mcAIHelper.mbScheduledUpdateDue)
 		{
-			// Turn off Auto-Tracking so we have control over this Fish
-			_cpObject->SetIfObjectShouldMoveToDestinationAutomatically(false, false);
-			_cpObject->SetRotationVelocity(Vector3::ZERO);
+			cpGame->mcScheduledUpdateTicksList[_iThreadIndex] += CProfiler::ReturnCurrentTicks() - llStartTicks;
+			cpGame->mcNumberOfScheduledUpdatesDoneList[_iThreadIndex]++;
+		}
+	}
+}
 
-			// Set that this Fish is flocking
-			_cpObject->SetState(GiOBJECT_STATE_FLOCKING);
+// Picks the Fish's closest Neighbor Candidates which are within its Sense Neighbor Range, and stores up to
+//	_iMaxNeighbors of them in _saNeighbors (sorted from closest to farthest). Returns how many were stored
+int CGame::ReturnNeighborsFromCandidates(CObject* _cpFish, int _iMaxNeighbors, SObjectHandle* _saNeighbors) const
+{
+	float faDistances[GiMAX_NUMBER_OF_NEIGHBORS];	// Squared Distance to each Neighbor picked
+	int iNumberOfNeighbors = 0;						// How many Neighbors have been picked
+	float fSenseNeighborRangeSquared = _cpFish->mspFlocking->fSenseNeighborRange * _cpFish->mspFlocking->fSenseNeighborRange;
+	Vector3 sFishPosition = _cpFish->GetPosition();
+
+	// If the Fish can't have any Neighbors
+	if (_iMaxNeighbors <= 0)
+	{
+		return 0;
+	}
+
+	// Loop through the Fish's Neighbor Candidates
+	for (int iCandidate = 0; iCandidate < _cpFish->mspFlocking->iNumberOfNeighborCandidates; iCandidate++)
+	{
+		// Get the Candidate (NULL if it has been Removed since the Candidates were found)
+		CObject* cpCandidate = mcObjectPool.ReturnObject(_cpFish->mspFlocking->saNeighborCandidates[iCandidate]);
+		if (cpCandidate == NULL)
+		{
+			continue;
+		}
+
+		// If the Candidate is out of range, or is farther away than every Neighbor already picked
+		float fDistanceSquared = sFishPosition.squaredDistance(mcWorldState.ReturnPosition(cpCandidate));
+		if (!(fDistanceSquared < fSenseNeighborRangeSquared) ||
+			(iNumberOfNeighbors == _iMaxNeighbors && fDistanceSquared >= faDistances[iNumberOfNeighbors - 1]))
+		{
+			continue;
+		}
+
+		// Insert the Candidate into the Neighbors so they stay sorted (dropping the farthest if there are too many)
+		int iInsertIndex = (iNumberOfNeighbors < _iMaxNeighbors) ? iNumberOfNeighbors++ : (iNumberOfNeighbors - 1);
+		while (iInsertIndex > 0 && faDistances[iInsertIndex - 1] > fDistanceSquared)
+		{
+			faDistances[iInsertIndex] = faDistances[iInsertIndex - 1];
+			_saNeighbors[iInsertIndex] = _saNeighbors[iInsertIndex - 1];
+			iInsertIndex--;
+		}
+		faDistances[iInsertIndex] = fDistanceSquared;
+		_saNeighbors[iInsertIndex] = cpCandidate->msHandle;
+	}
+
+	return iNumberOfNeighbors;
+}
 
-			int iNumberOfNeighbors = 0;				// Used to record how many Neighbors this fish has
-			list<CObject*>::iterator cNeighborIterator;	// Used to traverse the Neighbor list
+// Job which Performs the AI of the Fish in mcAIObjectList
+void CGame::PerformAIJob(void* _vpGame, int _iStartIndex, int _iEndIndex, int _iThreadIndex)
+{
+	// NOTE: The Zone covers the whole Chunk rather than each Fish, so timing it doesn't add to (or flood the Profiler with) every Fish's AI
+	PROFILE_ZONE("PerformAI");
 
-			Vector3 sCumulativePosition = Vector3::ZERO;			// Cumulative Position of all Neighbors
-			Vector3 sCumulativeSeparationDirection = Vector3::ZERO;	// Cumulative Direction away from all Neighbors
-			Vector3 sCumulativeAlignmentDirection = Vector3::ZERO;	// Cumulative Alignment (facing) Direction of all Neighbors
-			float fCumulativeVelocity = 0.0f;						// Cumulative Velocity of all Neighbors
+	CGame* cpGame = (CGame*)_vpGame;
 
-			// Store the Fish's Position locally as it's used many times
-			Vector3 sFishPosition = _cpObject->mcpSceneNode->getWorldPosition();
+	// Loop through the Fish in this Chunk and Perform their AI
+	for (int iIndex = _iStartIndex; iIndex < _iEndIndex; iIndex++)
+	{
+		cpGame->PerformAI(cpGame->mcAIObjectList[iIndex], _iThreadIndex);
+	}
+}
 
-			// Loop through the Neighbor List and get the Neighbors within range of this fish
-			for (cNeighborIterator = _cpObject->mcAIHelper.mcNeighborList.begin(); cNeighborIterator != _cpObject->mcAIHelper.mcNeighborList.end(); cNeighborIterator++)
-			{
-				cpNeighbor = *cNeighborIterator;
+// Returns if the Fish may spawn a new Fish of the same type this Step
+bool CGame::ReturnIfFishCanSpawn(CObject* _cpFish) const
+{
+	// If this is a Flocking Fish
+	if (_cpFish->mspFlocking != NULL)
+	{
+		// It can spawn if Flocking Fish may spawn this Step, it is old enough, and it cannot sense any Shark
+		return (mcPopulationController.ReturnNumberOfSpawnsDue(GiPOPULATION_FLOCKING_FISH) > 0 &&
+				_cpFish->mspFishBrain->fAge > _cpFish->mspFishBrain->fSpawnAge &&
+				!_cpFish->mcAIHelper.msPerception.bCanSensePreditor);
+	}
+
+	// Else Non-Flocking Fish can spawn whenever the Population Controller lets them
+	return (mcPopulationController.ReturnNumberOfSpawnsDue(GiPOPULATION_NON_FLOCKING_FISH) > 0);
+}
+
+// Records that the Fish wants to spawn a new Fish of the same type
+void CGame::RequestFishSpawn(CObject* _cpParentFish, bool _bIsFlockingFish, int _iThreadIndex)
+{
+	SObjectCommand sCommand;
+	sCommand.iCommand = GiOBJECT_COMMAND_SPAWN_FISH;
+	sCommand.sHandle = _cpParentFish->msHandle;
+	sCommand.iSpecificType = _cpParentFish->GetSpecificObjectType();
+	sCommand.iObjectID = _cpParentFish->GetID();
+	sCommand.bIsFlockingFish = _bIsFlockingFish;
+
+	// Add the Command to this Threads list (so no other Thread is writing to it)
+	mcObjectCommandList[_iThreadIndex].push_back(sCommand);
+}
+
+// Marks the Object as Dead, and records that it should be Removed from the Level
+void CGame::RequestObjectRemoval(CObject* _cpObject, int _iThreadIndex)
+{
+	// Mark the Object as Dead right away so nothing else collides with it or eats it this Step
+	_cpObject->SetState(GiOBJECT_STATE_DEAD);
+
+	SObjectCommand sCommand;
+	sCommand.iCommand = GiOBJECT_COMMAND_REMOVE;
+	sCommand.sHandle = _cpObject->msHandle;
+	sCommand.iSpecificType = _cpObject->GetSpecificObjectType();
+	sCommand.iObjectID = _cpObject->GetID();
+	sCommand.bIsFlockingFish = false;
+
+	// Add the Command to this Threads list (so no other Thread is writing to it)
+	mcObjectCommandList[_iThreadIndex].push_back(sCommand);
+}
+
+// Marks the Object as Dead, and records that it should be taken out of the Collision Grid
+void CGame::RequestObjectKill(CObject* _cpObject, int _iThreadIndex)
+{
+	// Mark the Object as Dead right away so nothing else collides with it this Step
+	_cpObject->SetState(GiOBJECT_STATE_DEAD);
+
+	SObjectCommand sCommand;
+	sCommand.iCommand = GiOBJECT_COMMAND_KILL;
+	sCommand.sHandle = _cpObject->msHandle;
+	sCommand.iSpecificType = _cpObject->GetSpecificObjectType();
+	sCommand.iObjectID = _cpObject->GetID();
+	sCommand.bIsFlockingFish = false;
+
+	// Add the Command to this Threads list (so no other Thread is writing to it)
+	mcObjectCommandList[_iThreadIndex].push_back(sCommand);
+}
+
+// Makes every Command recorded by every Thread this Step
+void CGame::ApplyObjectCommands()
+{
+	PROFILE_ZONE("ApplyObjectCommands");
+
+	vector<SObjectCommand> cCommandList;		// Holds every Threads Commands
+	vector<SObjectCommand> cSpawnCommandList;	// Holds the Spawn Commands, which are handled once the other Commands are done
+	int iIndex = 0;								// Index of the Command being made
+
+	// Gather up the Commands from every Thread and empty their lists for next time
+	for (int iThread = 0; iThread < (int)mcObjectCommandList.size(); iThread++)
+	{
+		cCommandList.insert(cCommandList.end(), mcObjectCommandList[iThread].begin(), mcObjectCommandList[iThread].end());
+		mcObjectCommandList[iThread].clear();
+	}
+
+	// Sort the Commands so the Removals are made first (so new Fish can reuse the Scene Nodes and Entities of the Fish which
+	//	were Removed), Objects of the same type are handled together, and the same Commands are made no matter which Thread recorded them
+	sort(cCommandList.begin(), cCommandList.end());
+
+	// Loop through the Commands
+	for (iIndex = 0; iIndex < (int)cCommandList.size(); iIndex++)
+	{
+		SObjectCommand const& sCommand = cCommandList[iIndex];
+
+		// If this is a Spawn Command
+		if (sCommand.iCommand == GiOBJECT_COMMAND_SPAWN_FISH)
+		{
+			// Spawn the Fish once all of the Removals are done
+			cSpawnCommandList.push_back(sCommand);
+			continue;
+		}
+
+		// If the Object no longer exists (e.g. a Removal was recorded for it twice)
+		CObject* cpObject = mcObjectPool.ReturnObject(sCommand.sHandle);
+		if (cpObject == NULL)
+		{
+			continue;
+		}
+
+		switch (sCommand.iCommand)
+		{
+			// Remove the Object from the level (any Neighbor Handles to it will now be invalid)
+			case GiOBJECT_COMMAND_REMOVE:
+				DestroyObject(cpObject);
+			break;
 
-				// If this Neighbor is Dead
-				if (cpNeighbor == NULL || cpNeighbor->GetState() == GiOBJECT_STATE_DEAD)
+			// Take the Object out of the Collision Grid so it can't be collided with again
+			case GiOBJECT_COMMAND_KILL:
+				if (cpObject->mcAIHelper.miCollisionGridHandle != -1)
 				{
-					// Move on to the next Neighbor
-					continue;
+					mcCollisionGrid.RemoveObject(cpObject->mcAIHelper.miCollisionGridHandle);
+					cpObject->mcAIHelper.miCollisionGridHandle = -1;
 				}
 
-				// If this Neighbor is within range of the Fish
-				if (cpNeighbor != NULL && _cpObject->mcpSceneNode->getWorldPosition().squaredDistance(cpNeighbor->mcpSceneNode->getWorldPosition()) < fSenseNeighborRangeSquared)
+				// If this is a Ring, let it expand before it is Removed
+				if (cpObject->GetSpecificObjectType() == GiOBJECT_SPECIFIC_TYPE_RING && cpObject->mspCollectible != NULL)
 				{
-					// Find the Direction away from this Neighbor (Separation), and the Distance between the Fish
-					Vector3 sAwayDirection = sFishPosition - cpNeighbor->mcpSceneNode->getWorldPosition();
-					float fDistance = sAwayDirection.normalise();
+					cpObject->mspCollectible->bDying = true;
+				}
+			break;
 
-					// Max distance for a fish to be considered a Neighbor
-					float fMaxNeighborDistance = cpNeighbor->mcAIHelper.GetSenseNeighborRange();
+			default:
+			break;
+		}
+	}
 
-					// Calculate the Distance Coefficient for Separation with this Neighbor
-					float fSeparationDistanceFactor = ((fMaxNeighborDistance - fDistance) / fMaxNeighborDistance);
-					fSeparationDistanceFactor *= fSeparationDistanceFactor;
+	// Create the Fish which were Requested
+	SpawnRequestedFish(cSpawnCommandList);
+}
 
-					// Add this Neighbors distance scaled Away Direction to the Cumulative Away Direction
-					sCumulativeSeparationDirection += (fSeparationDistanceFactor * sAwayDirection);
+// Creates the Fish which were Requested while Performing the AI (only as many as the Population Controller allows this Step)
+void CGame::SpawnRequestedFish(vector<SObjectCommand>& _cSpawnCommandList)
+{
+	vector<CObject*> cNewFlockingFishList;		// Holds the new Flocking Fish so they can start Aging
+	int iIndex = 0;								// Index of the Request being handled
 
-					// Add this Neighbors Position to the Cumulative Position (Cohesion)
-					sCumulativePosition += cpNeighbor->mcpSceneNode->getWorldPosition();
+	// Random numbers used to pick the Requests, made from this Level's Seed and the Step number (not rand()), so the
+	//	Requests are picked the same way every time the Step is run
+	SRandomNumberGenerator sRandom(muiAIRandomSeed ^ ((unsigned int)mulNumberOfAISteps * 0xC2B2AE35U));
 
-					// Add this Neighbors Orientation (Alignment) to the Cumulative Alignment Direction
-					sCumulativeAlignmentDirection += cpNeighbor->GetDirectionObjectIsFacing();
+	// Loop until every Request has been handled
+	// NOTE: The Requests are already sorted, and are picked with the seeded random numbers above, so the same Fish
+	//		 spawn no matter which Thread Requested them
+	while (!_cSpawnCommandList.empty())
+	{
+		// Randomly pick one of the Requests, so the same Fish aren't always the ones to spawn
+		// NOTE: ReturnRangeRandom() may return its high value, so make sure the Index is in the list
+		iIndex = (int)sRandom.ReturnRangeRandom(0.0f, (float)_cSpawnCommandList.size());
+		iIndex = (iIndex < (int)_cSpawnCommandList.size()) ? iIndex : ((int)_cSpawnCommandList.size() - 1);
+
+		// Take the Request out of the list
+		SObjectCommand sRequest = _cSpawnCommandList[iIndex];
+		_cSpawnCommandList[iIndex] = _cSpawnCommandList.back();
+		_cSpawnCommandList.pop_back();
+
+		// If this kind of Fish can't spawn any more Fish this Step (several Fish may have Requested to spawn at once)
+		int iPopulation = sRequest.bIsFlockingFish ? GiPOPULATION_FLOCKING_FISH : GiPOPULATION_NON_FLOCKING_FISH;
+		if (mcPopulationController.ReturnNumberOfSpawnsDue(iPopulation) <= 0)
+		{
+			continue;
+		}
 
-					// Add this Neighbors Velocity to the Cumulative Velocity
-					fCumulativeVelocity += cpNeighbor->GetVelocitySpeed();
+		// If the Parent no longer exists
+		CObject* cpParentFish = mcObjectPool.ReturnObject(sRequest.sHandle);
+		if (cpParentFish == NULL)
+		{
+			continue;
+		}
 
-					// Increment the number of Neighbors found
-					iNumberOfNeighbors++;
-				}
-			}
+		// Spawn a new Fish of the same type, and use up one of this Step's Spawns
+		CObject* cpNewFish = CreateFish(sRequest.bIsFlockingFish, cpParentFish->GetSpecificObjectType());
 
-			// Set this Fish's Velocity to the average velocity of all Neighbors
-			_cpObject->SetVelocitySpeed(fCumulativeVelocity / iNumberOfNeighbors);
+		// If the Fish could not be created (its Species is not defined)
+		if (cpNewFish == NULL)
+		{
+			continue;
+		}
+		mcPopulationController.SpawnCommitted(iPopulation);
 
-			// Find the average Position of the Neighbors (Cohesion)
-			sCumulativePosition /= iNumberOfNeighbors;
+		// If this is a Flocking Fish
+		if (sRequest.bIsFlockingFish)
+		{
+			// Set both Fishes Age to zero
+			cpParentFish->mspFishBrain->fAge = 0;
+			cpNewFish->mspFishBrain->fAge = 0;
+			cNewFlockingFishList.push_back(cpNewFish);
+		}
 
-			// Find the Direction to the average Position
-			Vector3 sCohesionDirection = sCumulativePosition - sFishPosition;
+		// Position and orient the new Fish the same as its Parent
+		cpNewFish->SetPosition(cpParentFish->GetPosition());
+		cpNewFish->PointObjectInDirection(cpParentFish->GetDirectionObjectIsFacing());
+		cpNewFish->SavePreviousTransform();
 
-			// Direction away from the Shark and Sub
-			Vector3 sAwayFromPreditorDirection = Vector3::ZERO;
+		// Move the new Fish to where it was placed in the Grids
+		if (cpNewFish->mspFlocking != NULL && cpNewFish->mspFlocking->iSpatialGridHandle != -1)
+		{
+			mcSpatialGrid.UpdateObjectsPosition(cpNewFish->mspFlocking->iSpatialGridHandle, cpNewFish->GetPosition());
+		}
+		if (cpNewFish->mcAIHelper.miCollisionGridHandle != -1)
+		{
+			mcCollisionGrid.UpdateObjectsPosition(cpNewFish->mcAIHelper.miCollisionGridHandle, cpNewFish->GetPosition());
+		}
+	}
 
-			// If the Fish can sense the Shark
-			float fSenseSharkRangeSquared = _cpObject->mcAIHelper.GetSenseSharkRange();
-			fSenseSharkRangeSquared *= fSenseSharkRangeSquared;
-			if (_cpObject->mcpSceneNode->getWorldPosition().squaredDistance(mcpShark->mcpSceneNode->getWorldPosition()) < fSenseSharkRangeSquared)
-			{
-				// Calculate Direction away from the Shark
-				sAwayFromPreditorDirection = sFishPosition - mcpShark->mcpSceneNode->getWorldPosition();
-				sAwayFromPreditorDirection.normalise();
-			}
+	// Start Aging the new Flocking Fish
+	ScheduleFlockingFishAging(cNewFlockingFishList);
+}
 
-			// If the Fish can sense the Submarine
-			float fSenseSubmarineRangeSquared = _cpObject->mcAIHelper.GetSenseSubmarineRange();
-			fSenseSubmarineRangeSquared *= fSenseSubmarineRangeSquared;
-			if (_cpObject->mcpSceneNode->getWorldPosition().squaredDistance(mcpPlayer->mcpSceneNode->getWorldPosition()) < fSenseSubmarineRangeSquared)
-			{
-				// Calculate Direction away from the Submarine
-				Vector3 sAwayFromSubmarineDirection = sFishPosition - mcpPlayer->mcpSceneNode->getWorldPosition();
-				sAwayFromSubmarineDirection.normalise();
+// Schedules the Events which Age the Flocking Fish and make the Shark lose Health
+void CGame::ScheduleDegradationEvents()
+{
+	vector<CObject*> cFlockingFishList;		// Holds the Flocking Fish to start Aging
 
-				// Add this to the Direction away from the Shark
-				sAwayFromPreditorDirection += sAwayFromSubmarineDirection;
-			}
+	// Find the Flocking Fish which are not Aging yet
+	for (int iIndex = 0; iIndex < mcObjectPool.ReturnNumberOfObjectsWithComponent(GiCOMPONENT_FLOCKING); iIndex++)
+	{
+		CObject* cpObject = &mcObjectPool.ReturnObjectWithComponentAtIndex(GiCOMPONENT_FLOCKING, iIndex);
+		if (!mcpScheduler->ReturnIfEventIsScheduled(cpObject->mcAIHelper.msDegradationEvent))
+		{
+			cFlockingFishList.push_back(cpObject);
+		}
+	}
+
+	// Start Aging the Flocking Fish
+	ScheduleFlockingFishAging(cFlockingFishList);
 
-			// Normalise all Direction factors
-			sCumulativeAlignmentDirection.normalise();
-			sCohesionDirection.normalise();
-			sCumulativeSeparationDirection.normalise();
-			sAwayFromPreditorDirection.normalise();
+	// Make each Shark lose a Health point every Health Degrade Delay
+	for (int iShark = 0; iShark < (int)mcSharkList.size(); iShark++)
+	{
+		CObject* cpShark = mcSharkList[iShark];
+		unsigned long ulHealthDegradeDelay = (cpShark->mspSharkBrain->ulHealthDegradeDelay > 0) ? cpShark->mspSharkBrain->ulHealthDegradeDelay : 1;
+		mcpScheduler->RemoveScheduledEvent(cpShark->mcAIHelper.msDegradationEvent);
+		cpShark->mcAIHelper.msDegradationEvent = mcpScheduler->ScheduleNewEvent(MakeSharkHungry, ulHealthDegradeDelay, cpShark, 0, ulHealthDegradeDelay);
+	}
+}
 
-			// Sum the vectors to find this Fish's new Direction
-			Vector3 sNewDirection = ((_cpObject->mcAIHelper.GetAlignmentCoefficient() * sCumulativeAlignmentDirection) +
-									(_cpObject->mcAIHelper.GetCohesionCoefficient() * sCohesionDirection) +
-									(_cpObject->mcAIHelper.GetSeparationCoefficient() * sCumulativeSeparationDirection) + 
-									(_cpObject->mcAIHelper.GetPreditorAvoidanceCoefficient() * sAwayFromPreditorDirection));
+// Schedules an Event for each of the Flocking Fish which Ages it every second
+void CGame::ScheduleFlockingFishAging(vector<CObject*>& _cFlockingFishList)
+{
+	int iNumberOfFish = (int)_cFlockingFishList.size();
 
+	// If there are no Fish to Age
+	if (iNumberOfFish == 0)
+	{
+		return;
+	}
 
-			// If the Fish is steering into the left or right Ocean Boundary
-			if ((sFishPosition.x < (GiLEVEL_LEFT + (2 * GiMETER)) && sNewDirection.x < 0) ||
-				(sFishPosition.x > (GiLEVEL_RIGHT - (2 * GiMETER)) && sNewDirection.x > 0))
-			{
-				// Calculate middle position of the ocean directly above/below Fish's current location
-				Vector3 sOceanMiddleDirection = sFishPosition;
-				sOceanMiddleDirection.x = 0;
+	// Schedule all of the Events at once and give each Fish the Handle to its Event
+	vector<SEventHandle> cEventHandleList(iNumberOfFish);
+	mcpScheduler->ScheduleNewEvents(AgeFlockingFish, (void**)&_cFlockingFishList[0], iNumberOfFish, 1000, 0, 1000, true, &cEventHandleList[0]);
+	for (int iIndex = 0; iIndex < iNumberOfFish; iIndex++)
+	{
+		_cFlockingFishList[iIndex]->mcAIHelper.msDegradationEvent = cEventHandleList[iIndex];
+	}
+}
 
-				// Calculate Direction towards the middle of the ocean
-				sOceanMiddleDirection = sOceanMiddleDirection - sFishPosition;
-				sOceanMiddleDirection.normalise();
+// Starts the Job System with the number of AI Threads to use
+void CGame::StartJobSystem()
+{
+	// Figure out how many Threads should be used
+	int iNumberOfThreads = (miNumberOfAIThreads > 0) ? miNumberOfAIThreads : CJobSystem::ReturnNumberOfProcessors();
+	if (iNumberOfThreads > GiMAX_NUMBER_OF_JOB_THREADS)
+	{
+		iNumberOfThreads = GiMAX_NUMBER_OF_JOB_THREADS;
+	}
 
-				// Factor new Direction into the Fish's final direction
-				sNewDirection.normalise();
-				sNewDirection += (sOceanMiddleDirection * (float)Math::RangeRandom(0.7, 1.0));
-			}
+	// If the Job System is already using that many Threads
+	if (mcJobSystem.ReturnNumberOfThreads() == iNumberOfThreads)
+	{
+		return;
+	}
 
-			// If the Fish is steering into the bottom or top Ocean Boundary
-			if ((sFishPosition.y < (GiLEVEL_BOTTOM + (2 * GiMETER)) && sNewDirection.y < 0) ||
-				(sFishPosition.y > (GiLEVEL_TOP - (2 * GiMETER)) && sNewDirection.y > 0))
-			{
-				// Calculate middle position of the ocean directly above/below Fish's current location
-				Vector3 sOceanMiddleDirection = sFishPosition;
-				sOceanMiddleDirection.y = 0;
+	// If the Threads could not be created
+	if (!mcJobSystem.Start(iNumberOfThreads))
+	{
+		WriteToLogFile("ERROR: Could not create " + StringConverter::toString(iNumberOfThreads) + " AI Threads, running the AI on one Thread instead");
+		mcJobSystem.Start(1);
+	}
+}
 
-				// Calculate Direction towards the middle of the ocean
-				sOceanMiddleDirection = sOceanMiddleDirection - sFishPosition;
-				sOceanMiddleDirection.normalise();
+// Calculates the Flocking Direction and Speed of every living Flocking Fish at once
+void CGame::PerformFlocking()
+{
+	PROFILE_ZONE("PerformFlocking");
 
-				// Factor new Direction into the Fish's final direction
-				sNewDirection.normalise();
-				sNewDirection += (sOceanMiddleDirection * (float)Math::RangeRandom(0.7, 1.0));
-			}
+	CObject* cpObject = NULL;						// The Fish being looked at
+	int iIndex = 0;									// Used to loop through the Fish
+	int iNumberOfFlockingFish = mcObjectPool.ReturnNumberOfObjectsWithComponent(GiCOMPONENT_FLOCKING);
 
-			// If the Fish is steering into the back or front Ocean Boundary
-			if ((sFishPosition.z < (GiLEVEL_BACK + (2 * GiMETER)) && sNewDirection.z < 0) ||
-				(sFishPosition.z > (GiLEVEL_FRONT - (2 * GiMETER)) && sNewDirection.z > 0))
+	// Empty the Flocking Kernel from last frame
+	mcFlockingKernel.Purge();
+
+	// Loop through the Flocking Fish and copy the living ones into the Flocking Kernel
+	for (iIndex = 0; iIndex < iNumberOfFlockingFish; iIndex++)
+	{
+		SFlocking& sFlocking = mcObjectPool.ReturnFlockingAtIndex(iIndex);
+		cpObject = &mcObjectPool.ReturnObjectWithComponentAtIndex(GiCOMPONENT_FLOCKING, iIndex);
+
+		// If this is a living Flocking Fish which is not part of a School
+		if (cpObject->GetState() != GiOBJECT_STATE_DEAD && sFlocking.iSchoolIndex == -1)
+		{
+			// Give the Fish the Shark closest to it to avoid
+			SPerception const& sPerception = cpObject->mcAIHelper.msPerception;
+
+			// Find which way the Fish should turn if it steers into the edges of the ocean (by a random amount)
+			Vector3 sBoundarySteering = mcBoundaryField.ReturnSteering(cpObject->GetPosition());
+			if (sBoundarySteering != Vector3::ZERO)
 			{
-				// Calculate middle position of the ocean directly above/below Fish's current location
-				Vector3 sOceanMiddleDirection = sFishPosition;
-				sOceanMiddleDirection.z = 0;
+				sBoundarySteering *= (float)Math::RangeRandom(0.7, 1.0);
+			}
+
+			sFlocking.iFlockingKernelIndex = mcFlockingKernel.AddFish(cpObject, sFlocking, sPerception.sClosestPreditorPosition, sPerception.bThereIsAPreditor, sBoundarySteering);
+		}
+		else
+		{
+			sFlocking.iFlockingKernelIndex = -1;
+		}
+	}
+
+	// Loop through the Fish in the Flocking Kernel and give it their living Neighbors
+	for (iIndex = 0; iIndex < iNumberOfFlockingFish; iIndex++)
+	{
+		SFlocking& sFlocking = mcObjectPool.ReturnFlockingAtIndex(iIndex);
+		cpObject = &mcObjectPool.ReturnObjectWithComponentAtIndex(GiCOMPONENT_FLOCKING, iIndex);
+
+		// If this Fish is not in the Flocking Kernel
+		if (sFlocking.iFlockingKernelIndex == -1)
+		{
+			continue;
+		}
 
-				// Calculate Direction towards the middle of the ocean
-				sOceanMiddleDirection = sOceanMiddleDirection - sFishPosition;
-				sOceanMiddleDirection.normalise();
+		// Loop through the Fish's Neighbors (closest to farthest)
+		for (int iNeighbor = 0; iNeighbor < cpObject->mcAIHelper.miNumberOfNeighbors; iNeighbor++)
+		{
+			CObject* cpNeighbor = mcObjectPool.ReturnObject(cpObject->mcAIHelper.msaNeighbors[iNeighbor]);
 
-				// Factor new Direction into the Fish's final direction
-				sNewDirection.normalise();
-				sNewDirection += (sOceanMiddleDirection * (float)Math::RangeRandom(0.7, 1.0));
+			// If this Neighbor still exists and is in the Flocking Kernel (only Flocking Fish can be)
+			if (cpNeighbor != NULL && cpNeighbor->mspFlocking != NULL && cpNeighbor->mspFlocking->iFlockingKernelIndex != -1)
+			{
+				mcFlockingKernel.AddNeighbor(sFlocking.iFlockingKernelIndex, cpNeighbor->mspFlocking->iFlockingKernelIndex);
 			}
+		}
+	}
+
+	// Calculate the Flocking of every Fish, avoiding the closest Shark and the Submarine
+	mcFlockingKernel.SetSubmarinePosition(mcWorldState.ReturnPosition(mcpPlayer));
+	mcFlockingKernel.CalculateFlocking();
+}
+
+// Perform AI on the given Object
+void CGame::PerformAI(CObject* _cpObject, int _iThreadIndex)
+{
+	// If this Object is Dead, or this is an Item
+	if (_cpObject->GetState() == GiOBJECT_STATE_DEAD || 
+		_cpObject->GetGeneralObjectType() == GiOBJECT_GENERAL_TYPE_ITEM)
+	{
+		// Don't do any AI for this Object
+		return;
+	}
+
+	// Give the Object its own random numbers for this Step (from its Slot and the Step number), so they are the same no
+	//	matter which Thread runs its AI
+	SRandomNumberGenerator sRandom(muiAIRandomSeed ^ ((unsigned int)_cpObject->msHandle.iSlot * 0x9E3779B1U) ^
+		((unsigned int)mulNumberOfAISteps * 0x85EBCA77U));
+
+	// Get what the Object sensed this Step
+	SPerception const& sPerception = _cpObject->mcAIHelper.msPerception;
+
+	// If this is a Flocking Fish
+	if (_cpObject->mspFlocking != NULL)
+	{
+		// NOTE: The Fish's Age is incremented by its Degradation Event (see AgeFlockingFish())
+
+		// NOTE: Which Fish spawn this Step was already picked before the AI was Performed (see UpdateObjects())
+
+		// If the Fish is far from the Player and Shark it only wanders around
+		if (_cpObject->mspFlocking->iAILevelOfDetail == GiAI_LEVEL_OF_DETAIL_FAR)
+		{
+			PerformWanderAI(_cpObject, sRandom);
+			return;
+		}
+
+		// If the Fish can sense a Neighbor (it is flocking)
+		int iFlockingKernelIndex = _cpObject->mspFlocking->iFlockingKernelIndex;
+		if (iFlockingKernelIndex != -1 && mcFlockingKernel.ReturnIfFishIsFlocking(iFlockingKernelIndex))
+		{
+			// Turn off Auto-Tracking so we have control over this Fish
+			_cpObject->SetIfObjectShouldMoveToDestinationAutomatically(false, false);
+			_cpObject->SetRotationVelocity(Vector3::ZERO);
+
+			// Set that this Fish is flocking
+			_cpObject->SetState(GiOBJECT_STATE_FLOCKING);
+
+			// Set this Fish's Velocity to the average velocity of all Neighbors
+			_cpObject->SetVelocitySpeed(mcFlockingKernel.ReturnNewSpeed(iFlockingKernelIndex));
+
+			// Get this Fish's new Direction (the sum of its Alignment, Cohesion, Separation, and Preditor Avoidance, turned
+			//	back into the ocean if it is steering into a Boundary)
+			Vector3 sNewDirection = mcFlockingKernel.ReturnNewDirection(iFlockingKernelIndex);
 
 			// Make the Fish point in the new Direction
 			_cpObject->PointObjectInDirection(sNewDirection);
@@ -1423,26 +2259,26 @@ void CGame::PerformAI(CObject* _cpObject)
 			_cpObject->SetAccelerationRate(_cpObject->GetDefaultAccelerationRate());
 			_cpObject->SetRotationVelocitySpeed(_cpObject->GetDefaultRotationVelocitySpeed());
 
-			// If the Fish can sense the Shark
-			float fSenseSharkRangeSquared = _cpObject->mcAIHelper.GetSenseSharkRange();
-			fSenseSharkRangeSquared *= fSenseSharkRangeSquared;
-			if (_cpObject->mcpSceneNode->getWorldPosition().squaredDistance(mcpShark->mcpSceneNode->getWorldPosition()) < fSenseSharkRangeSquared)
+			// If the Fish can sense the closest Shark
+			if (sPerception.bCanSensePreditor)
 			{
 				// If the Fish is not already Avoiding the Shark
 				if (_cpObject->GetState() != GiOBJECT_STATE_AVOID_SHARK ||
 					_cpObject->GetIfObjectHasReachedAllDestinations())
 				{
 					// Clear the Fish's Destination list
-					_cpObject->mcDestinationList.clear();
+					_cpObject->mcDestinationList.Purge();
 
-					// Calculate direction away from Shark
-					Vector3 sAwayDirection = _cpObject->mcpSceneNode->getWorldPosition() - mcpShark->mcpSceneNode->getWorldPosition();
+					// Calculate direction away from the closest Shark, turned away from any other Sharks nearby
+					// NOTE: The Influence Grid's Away Direction is for the centre of the Fish's Cell, so the exact one is used too
+					Vector3 sAwayDirection = _cpObject->GetPosition() - sPerception.sClosestPreditorPosition;
+					sAwayDirection.normalise();
+					sAwayDirection += mcSharkInfluenceGrid.ReturnAwayDirection(_cpObject->GetPosition());
 					sAwayDirection.normalise();
 
 					// Make the Fish swim away from the Shark
-					Vector3 sAwayDestination = _cpObject->mcpSceneNode->getWorldPosition() + (sAwayDirection * 200 * GiMETER);
-					SDestination* spNewDestination =  new SDestination(NULL, &sAwayDestination);
-					_cpObject->mcDestinationList.push_front(spNewDestination);
+					Vector3 sAwayDestination = _cpObject->GetPosition() + (sAwayDirection * 200 * GiMETER);
+					_cpObject->mcDestinationList.PushFront(SDestination(sAwayDestination));
 					_cpObject->GetNextDestination();
 
 					// Set Fish's State
@@ -1452,22 +2288,20 @@ void CGame::PerformAI(CObject* _cpObject)
 			// Else the Fish can't sense the Shark
 			else
 			{
-				// If the Fish can sense another fish nearby
-				float fSenseFishRangeSquared = _cpObject->mcAIHelper.GetSenseFishRange();
-				fSenseFishRangeSquared *= fSenseFishRangeSquared;
-				if (cpNeighbor != NULL && _cpObject->mcpSceneNode->getWorldPosition().squaredDistance(cpNeighbor->mcpSceneNode->getWorldPosition()) < fSenseFishRangeSquared)
+				// If the Fish can sense another fish nearby (its closest Neighbor)
+				CObject* cpNeighbor = sPerception.cpClosestNeighbor;
+				if (sPerception.bCanSenseClosestNeighbor)
 				{
 					// If the Fish is not already tracking this Fish
 					if (_cpObject->GetState() != GiOBJECT_STATE_TRACKING_FISH ||
 						_cpObject->GetIfObjectHasReachedAllDestinations() ||
-						_cpObject->GetCurrentDestination() != cpNeighbor->mcpSceneNode)
+						_cpObject->ReturnCurrentDestinationObject() != cpNeighbor->msHandle)
 					{
 						// Clear the Fish's Destination list
-						_cpObject->mcDestinationList.clear();
+						_cpObject->mcDestinationList.Purge();
 
 						// Track this Fish
-						SDestination* spNewDestination =  new SDestination(cpNeighbor->mcpSceneNode);
-						_cpObject->mcDestinationList.push_front(spNewDestination);
+						_cpObject->mcDestinationList.PushFront(SDestination(cpNeighbor));
 						_cpObject->GetNextDestination();
 
 						// Set Fish's State
@@ -1477,64 +2311,38 @@ void CGame::PerformAI(CObject* _cpObject)
 				// Else the Fish cannot sense the Shark or any Fish nearby, so go exploring
 				else 
 				{
-					// If the Fish is not already exploring
-					if (_cpObject->GetState() != GiOBJECT_STATE_EXPLORING ||
-						_cpObject->GetIfObjectHasReachedAllDestinations())
-					{
-						// Clear the Fish's Destination list
-						_cpObject->mcDestinationList.clear();
-
-						// Give them a new random Destination to go to
-						Vector3 sRandomDestination = Vector3::ZERO;
-						sRandomDestination.x = Math::RangeRandom(GiLEVEL_LEFT, GiLEVEL_RIGHT);
-						sRandomDestination.y = Math::RangeRandom(GiLEVEL_BOTTOM, GiLEVEL_TOP);
-						sRandomDestination.z = Math::RangeRandom(GiLEVEL_BACK, GiLEVEL_FRONT);
-
-						// Add the new Destination to the Object
-						SDestination* spNewDestination =  new SDestination(NULL, &sRandomDestination);
-						_cpObject->mcDestinationList.push_front(spNewDestination);
-						_cpObject->GetNextDestination();
-
-						// Set the Fish's State
-						_cpObject->SetState(GiOBJECT_STATE_EXPLORING);
-					}
+					PerformWanderAI(_cpObject, sRandom);
 				}
 			}
 		}
 	}
 	// Else if this is the Shark
-	else if (_cpObject->GetSpecificObjectType() == GiOBJECT_SPECIFIC_TYPE_SHARK)
+	else if (_cpObject->mspSharkBrain != NULL)
 	{
-		// If it's time for the Shark to lose some more Health (get hungry)
-		if (_cpObject->mcAIHelper.mcDegradationTimer.XTimeHasPassedUsingSavedTime(_cpObject->mcAIHelper.GetHealthDegradeDelay()))
-		{
-			// Decrement Sharks Health
-			_cpObject->mcAttributes.SetHealthRelative(-1);
-		}
+		// NOTE: The Shark loses Health (gets hungry) from its Degradation Event (see MakeSharkHungry())
 
 		// Sharks actions are based on how hungry it is, so get Sharks Health (hunger)
-		int iSharkHealth = _cpObject->mcAttributes.ReturnHealth();
+		int iSharkHealth = _cpObject->mcpAttributes->ReturnHealth();
 
 		// Calculate Sharks max speed based on it's Health
-		_cpObject->SetMaxVelocitySpeed(mfLevelFriction + ((iSharkHealth * _cpObject->mcAIHelper.GetVelocityCoefficient()) * GiMETER));
+		_cpObject->SetMaxVelocitySpeed(mfLevelFriction + ((iSharkHealth * _cpObject->mspSharkBrain->fVelocityCoefficient) * GiMETER));
 
-		// If the Shark attacked the Player recently
-		if (!_cpObject->mcAIHelper.mcHitDelayTimer.XTimeHasPassedUsingSavedTimeWithoutRestartingTimer(_cpObject->mcAIHelper.GetHitDelay()))
+		// If the Shark attacked the Player recently (its Hit Delay Event hasn't fired yet)
+		if (mcpScheduler->ReturnIfEventIsScheduled(_cpObject->mspSharkBrain->sHitDelayEvent))
 		{
 			// If the Shark just attacked the Player last frame
 			if (_cpObject->GetState() != GiOBJECT_STATE_AVOID_PLAYER)
 			{
 				// Clear the Sharks Destination list
-				_cpObject->mcDestinationList.clear();
+				_cpObject->mcDestinationList.Purge();
 
 				// Calculate direction to swim away from Player
-				Vector3 sAwayDirection = _cpObject->mcpSceneNode->getWorldPosition() - mcpPlayer->mcpSceneNode->getWorldPosition();
+				Vector3 sAwayDirection = _cpObject->GetPosition() - mcWorldState.ReturnPosition(mcpPlayer);
 				sAwayDirection.normalise();
 
 				// Make the Shark swim away from the Player
-				Vector3 sAwayDestination = _cpObject->mcpSceneNode->getWorldPosition() + (sAwayDirection * 200 * GiMETER);
-				SDestination* spNewDestination =  new SDestination(NULL, &sAwayDestination);
-				_cpObject->mcDestinationList.push_front(spNewDestination);
+				Vector3 sAwayDestination = _cpObject->GetPosition() + (sAwayDirection * 200 * GiMETER);
+				_cpObject->mcDestinationList.PushFront(SDestination(sAwayDestination));
 				_cpObject->GetNextDestination();
 
 				// Set Sharks State
@@ -1546,23 +2354,20 @@ void CGame::PerformAI(CObject* _cpObject)
 		}
 
 		// Else If the Shark is Full
-		if (iSharkHealth > _cpObject->mcAIHelper.GetFullHealth())
+		if (iSharkHealth > _cpObject->mspSharkBrain->iFullHealth)
 		{
 			// If the Shark can sense the Submarine (Player), chase it
-			float fSenseSubmarineRangeSquared = _cpObject->mcAIHelper.GetSenseSubmarineRange();
-			fSenseSubmarineRangeSquared *= fSenseSubmarineRangeSquared;
-			if (_cpObject->mcpSceneNode->getWorldPosition().squaredDistance(mcpPlayer->mcpSceneNode->getWorldPosition()) < fSenseSubmarineRangeSquared)
+			if (sPerception.bCanSensePlayer)
 			{
 				// If the Shark is not already tracking the Submarine
 				if (_cpObject->GetState() != GiOBJECT_STATE_TRACKING_PLAYER ||
 					_cpObject->GetIfObjectHasReachedAllDestinations())
 				{
 					// Clear the Sharks Destination list
-					_cpObject->mcDestinationList.clear();
+					_cpObject->mcDestinationList.Purge();
 
 					// Track the Submarine
-					SDestination* spNewDestination =  new SDestination(mcpPlayer->mcpSceneNode);
-					_cpObject->mcDestinationList.push_front(spNewDestination);
+					_cpObject->mcDestinationList.PushFront(SDestination(mcpPlayer));
 					_cpObject->GetNextDestination();
 
 					// Set Sharks State
@@ -1577,17 +2382,16 @@ void CGame::PerformAI(CObject* _cpObject)
 					_cpObject->GetIfObjectHasReachedAllDestinations())
 				{
 					// Clear the Sharks Destination list
-					_cpObject->mcDestinationList.clear();
+					_cpObject->mcDestinationList.Purge();
 
 					// Give them a new random Destination to go to
 					Vector3 sRandomDestination = Vector3::ZERO;
-					sRandomDestination.x = Math::RangeRandom(GiLEVEL_LEFT, GiLEVEL_RIGHT);
-					sRandomDestination.y = Math::RangeRandom(GiLEVEL_BOTTOM, GiLEVEL_TOP);
-					sRandomDestination.z = Math::RangeRandom(GiLEVEL_BACK, GiLEVEL_FRONT);
+					sRandomDestination.x = sRandom.ReturnRangeRandom(GiLEVEL_LEFT, GiLEVEL_RIGHT);
+					sRandomDestination.y = sRandom.ReturnRangeRandom(GiLEVEL_BOTTOM, GiLEVEL_TOP);
+					sRandomDestination.z = sRandom.ReturnRangeRandom(GiLEVEL_BACK, GiLEVEL_FRONT);
 
 					// Add the new Destination to the Object
-					SDestination* spNewDestination =  new SDestination(NULL, &sRandomDestination);
-					_cpObject->mcDestinationList.push_front(spNewDestination);
+					_cpObject->mcDestinationList.PushFront(SDestination(sRandomDestination));
 					_cpObject->GetNextDestination();
 
 					// Set the Sharks State
@@ -1596,36 +2400,33 @@ void CGame::PerformAI(CObject* _cpObject)
 			}
 		}
 		// Else if the Shark is Nourished
-		else if (iSharkHealth > _cpObject->mcAIHelper.GetNourishedHealth())
+		else if (iSharkHealth > _cpObject->mspSharkBrain->iNourishedHealth)
 		{
 			// If the Shark can sense the Submarine (Player), approach it
-			float fSenseSubmarineRangeSquared = _cpObject->mcAIHelper.GetSenseSubmarineRange();
-			fSenseSubmarineRangeSquared *= fSenseSubmarineRangeSquared;
-			if (_cpObject->mcpSceneNode->getWorldPosition().squaredDistance(mcpPlayer->mcpSceneNode->getWorldPosition()) < fSenseSubmarineRangeSquared)
+			if (sPerception.bCanSensePlayer)
 			{
 				// If the Shark is not already approaching the Submarine
 				if (_cpObject->GetState() != GiOBJECT_STATE_APPROACHING_PLAYER ||
 					_cpObject->GetIfObjectHasReachedAllDestinations())
 				{
 					// Clear the Sharks Destination list
-					_cpObject->mcDestinationList.clear();
+					_cpObject->mcDestinationList.Purge();
 
 					Vector3 sDestination = Vector3::ZERO;
 					do
 					{
 						// Calculate a position near the Submarine
-						sDestination = mcpPlayer->mcpSceneNode->getWorldPosition();
-						sDestination.x += (-1 * (int)Math::RangeRandom(1, 3)) * (UnitCubed(Math::UnitRandom()) * 25 * GiMETER);
-						sDestination.y += (-1 * (int)Math::RangeRandom(1, 3)) * (UnitCubed(Math::UnitRandom()) * 25 * GiMETER);
-						sDestination.z += (-1 * (int)Math::RangeRandom(1, 3)) * (UnitCubed(Math::UnitRandom()) * 25 * GiMETER);
+						sDestination = mcWorldState.ReturnPosition(mcpPlayer);
+						sDestination.x += (-1 * (int)sRandom.ReturnRangeRandom(1, 3)) * (UnitCubed(sRandom.ReturnUnitRandom()) * 25 * GiMETER);
+						sDestination.y += (-1 * (int)sRandom.ReturnRangeRandom(1, 3)) * (UnitCubed(sRandom.ReturnUnitRandom()) * 25 * GiMETER);
+						sDestination.z += (-1 * (int)sRandom.ReturnRangeRandom(1, 3)) * (UnitCubed(sRandom.ReturnUnitRandom()) * 25 * GiMETER);
 					// Make sure Sharks new Destination is within the ocean boundaries
 					}while (sDestination.x < GiLEVEL_LEFT || sDestination.x > GiLEVEL_RIGHT ||
 							sDestination.y < GiLEVEL_BOTTOM || sDestination.y > GiLEVEL_TOP ||
 							sDestination.z < GiLEVEL_BACK || sDestination.z > GiLEVEL_FRONT);
 					
 					// Approach the Submarine using the new Destination
-					SDestination* spNewDestination =  new SDestination(NULL, &sDestination);
-					_cpObject->mcDestinationList.push_front(spNewDestination);
+					_cpObject->mcDestinationList.PushFront(SDestination(sDestination));
 					_cpObject->GetNextDestination();
 
 					// Set Sharks State
@@ -1635,39 +2436,20 @@ void CGame::PerformAI(CObject* _cpObject)
 			// Else the Shark can not sense the Submarine
 			else
 			{
-				CObject* cpSharkNeighbor = NULL;
-
-				// Loop through Sharks Neighbors until we find a valid one
-				while (!_cpObject->mcAIHelper.mcNeighborList.empty() && cpSharkNeighbor == NULL)
-				{
-					// Get the Neighbor closest to the Shark
-					cpSharkNeighbor = _cpObject->mcAIHelper.mcNeighborList.front();
-
-					// If this Neighbor is Dead
-					if (cpSharkNeighbor == NULL || cpSharkNeighbor->GetState() == GiOBJECT_STATE_DEAD)
-					{
-						// Remove the Neighbor from the Neighbor list
-						_cpObject->mcAIHelper.mcNeighborList.pop_front();
-						cpSharkNeighbor = NULL;
-					}
-				}
-
-				// If the Shark can sense a nearby fish
-				float fSenseFishRangeSquared = _cpObject->mcAIHelper.GetSenseFishRange();
-				fSenseFishRangeSquared *= fSenseFishRangeSquared;
-				if (cpSharkNeighbor != NULL && _cpObject->mcpSceneNode->getWorldPosition().squaredDistance(cpSharkNeighbor->mcpSceneNode->getWorldPosition()) < fSenseFishRangeSquared)
+				// If the Shark can sense a nearby fish (its closest Neighbor)
+				CObject* cpSharkNeighbor = sPerception.cpClosestNeighbor;
+				if (sPerception.bCanSenseClosestNeighbor)
 				{
 					// If the Shark is not already tracking this Fish
 					if (_cpObject->GetState() != GiOBJECT_STATE_TRACKING_FISH ||
 						_cpObject->GetIfObjectHasReachedAllDestinations() ||
-						_cpObject->GetCurrentDestination() != cpSharkNeighbor->mcpSceneNode)
+						_cpObject->ReturnCurrentDestinationObject() != cpSharkNeighbor->msHandle)
 					{
 						// Clear the Sharks Destination list
-						_cpObject->mcDestinationList.clear();
+						_cpObject->mcDestinationList.Purge();
 
 						// Track this Fish
-						SDestination* spNewDestination =  new SDestination(cpSharkNeighbor->mcpSceneNode);
-						_cpObject->mcDestinationList.push_front(spNewDestination);
+						_cpObject->mcDestinationList.PushFront(SDestination(cpSharkNeighbor));
 						_cpObject->GetNextDestination();
 
 						// Set Sharks State
@@ -1682,17 +2464,16 @@ void CGame::PerformAI(CObject* _cpObject)
 						_cpObject->GetIfObjectHasReachedAllDestinations())
 					{
 						// Clear the Sharks Destination list
-						_cpObject->mcDestinationList.clear();
+						_cpObject->mcDestinationList.Purge();
 
 						// Give them a new random Destination to go to
 						Vector3 sRandomDestination = Vector3::ZERO;
-						sRandomDestination.x = Math::RangeRandom(GiLEVEL_LEFT, GiLEVEL_RIGHT);
-						sRandomDestination.y = Math::RangeRandom(GiLEVEL_BOTTOM, GiLEVEL_TOP);
-						sRandomDestination.z = Math::RangeRandom(GiLEVEL_BACK, GiLEVEL_FRONT);
+						sRandomDestination.x = sRandom.ReturnRangeRandom(GiLEVEL_LEFT, GiLEVEL_RIGHT);
+						sRandomDestination.y = sRandom.ReturnRangeRandom(GiLEVEL_BOTTOM, GiLEVEL_TOP);
+						sRandomDestination.z = sRandom.ReturnRangeRandom(GiLEVEL_BACK, GiLEVEL_FRONT);
 
 						// Add the new Destination to the Object
-						SDestination* spNewDestination =  new SDestination(NULL, &sRandomDestination);
-						_cpObject->mcDestinationList.push_front(spNewDestination);
+						_cpObject->mcDestinationList.PushFront(SDestination(sRandomDestination));
 						_cpObject->GetNextDestination();
 
 						// Set the Sharks State
@@ -1704,39 +2485,20 @@ void CGame::PerformAI(CObject* _cpObject)
 		// Else the Shark is hungry
 		else
 		{
-			CObject* cpSharkNeighbor = NULL;
-
-			// Loop through Sharks Neighbors until we find a valid one
-			while (!_cpObject->mcAIHelper.mcNeighborList.empty() && cpSharkNeighbor == NULL)
-			{
-				// Get the Neighbor closest to the Shark
-				cpSharkNeighbor = _cpObject->mcAIHelper.mcNeighborList.front();
-
-				// If this Neighbor is Dead
-				if (cpSharkNeighbor == NULL || cpSharkNeighbor->GetState() == GiOBJECT_STATE_DEAD)
-				{
-					// Remove the Neighbor from the Neighbor list
-					_cpObject->mcAIHelper.mcNeighborList.pop_front();
-					cpSharkNeighbor = NULL;
-				}
-			}
-
-			// If the Shark can sense a nearby fish
-			float fSenseFishRangeSquared = _cpObject->mcAIHelper.GetSenseFishRange();
-			fSenseFishRangeSquared *= fSenseFishRangeSquared;
-			if (cpSharkNeighbor != NULL && _cpObject->mcpSceneNode->getWorldPosition().squaredDistance(cpSharkNeighbor->mcpSceneNode->getWorldPosition()) < fSenseFishRangeSquared)
+			// If the Shark can sense a nearby fish (its closest Neighbor)
+			CObject* cpSharkNeighbor = sPerception.cpClosestNeighbor;
+			if (sPerception.bCanSenseClosestNeighbor)
 			{
 				// If the Shark is not already tracking this Fish
 				if (_cpObject->GetState() != GiOBJECT_STATE_TRACKING_FISH ||
 					_cpObject->GetIfObjectHasReachedAllDestinations() ||
-					_cpObject->GetCurrentDestination() != cpSharkNeighbor->mcpSceneNode)
+					_cpObject->ReturnCurrentDestinationObject() != cpSharkNeighbor->msHandle)
 				{
 					// Clear the Sharks Destination list
-					_cpObject->mcDestinationList.clear();
+					_cpObject->mcDestinationList.Purge();
 
 					// Track this Fish
-					SDestination* spNewDestination =  new SDestination(cpSharkNeighbor->mcpSceneNode);
-					_cpObject->mcDestinationList.push_front(spNewDestination);
+					_cpObject->mcDestinationList.PushFront(SDestination(cpSharkNeighbor));
 					_cpObject->GetNextDestination();
 
 					// Set Sharks State
@@ -1751,17 +2513,16 @@ void CGame::PerformAI(CObject* _cpObject)
 					_cpObject->GetIfObjectHasReachedAllDestinations())
 				{
 					// Clear the Sharks Destination list
-					_cpObject->mcDestinationList.clear();
+					_cpObject->mcDestinationList.Purge();
 
 					// Give them a new random Destination to go to
 					Vector3 sRandomDestination = Vector3::ZERO;
-					sRandomDestination.x = Math::RangeRandom(GiLEVEL_LEFT, GiLEVEL_RIGHT);
-					sRandomDestination.y = Math::RangeRandom(GiLEVEL_BOTTOM, GiLEVEL_TOP);
-					sRandomDestination.z = Math::RangeRandom(GiLEVEL_BACK, GiLEVEL_FRONT);
+					sRandomDestination.x = sRandom.ReturnRangeRandom(GiLEVEL_LEFT, GiLEVEL_RIGHT);
+					sRandomDestination.y = sRandom.ReturnRangeRandom(GiLEVEL_BOTTOM, GiLEVEL_TOP);
+					sRandomDestination.z = sRandom.ReturnRangeRandom(GiLEVEL_BACK, GiLEVEL_FRONT);
 
 					// Add the new Destination to the Object
-					SDestination* spNewDestination =  new SDestination(NULL, &sRandomDestination);
-					_cpObject->mcDestinationList.push_front(spNewDestination);
+					_cpObject->mcDestinationList.PushFront(SDestination(sRandomDestination));
 					_cpObject->GetNextDestination();
 
 					// Set the Sharks State
@@ -1773,212 +2534,412 @@ void CGame::PerformAI(CObject* _cpObject)
 	// Else this is a Non-Flocking Fish
 	else
 	{
-		// If this Fish can spawn
-		if (miNonFlockingFishCount < miInitialNonFlockingFishCount)
-		{
-			// Use some randomness to make sure the same Fish isn't doing all the spawning
-			if ((int)Math::RangeRandom(1, 20) == 10)
-			{
-				// Spawn a new Non-Flocking Fish of the same type
-				CObject* cpNewFish = CreateFish(false, _cpObject->GetSpecificObjectType());
-
-				// Position and orient the new Fish the same as this one
-				cpNewFish->mcpSceneNode->setPosition(_cpObject->mcpSceneNode->getWorldPosition());
-				cpNewFish->PointObjectInDirection(_cpObject->GetDirectionObjectIsFacing());
-			}
-		}
+		// NOTE: Which Fish spawn this Step was already picked before the AI was Performed (see UpdateObjects())
 
 		// If the Fish does not have a Destination to go to
 		if (_cpObject->GetIfObjectHasReachedAllDestinations())
 		{
 			// Give them a new random Destination to go to
 			Vector3 sRandomDestination = Vector3::ZERO;
-			sRandomDestination.x = Math::RangeRandom(GiLEVEL_LEFT, GiLEVEL_RIGHT);
-			sRandomDestination.y = Math::RangeRandom(GiLEVEL_BOTTOM, GiLEVEL_TOP);
-			sRandomDestination.z = Math::RangeRandom(GiLEVEL_BACK, GiLEVEL_FRONT);
+			sRandomDestination.x = sRandom.ReturnRangeRandom(GiLEVEL_LEFT, GiLEVEL_RIGHT);
+			sRandomDestination.y = sRandom.ReturnRangeRandom(GiLEVEL_BOTTOM, GiLEVEL_TOP);
+			sRandomDestination.z = sRandom.ReturnRangeRandom(GiLEVEL_BACK, GiLEVEL_FRONT);
 
 			// Add the new Destination to the Object
-			SDestination* spNewDestination =  new SDestination(NULL, &sRandomDestination);
-			_cpObject->mcDestinationList.push_front(spNewDestination);
+			_cpObject->mcDestinationList.PushFront(SDestination(sRandomDestination));
 			_cpObject->GetNextDestination();
 		}
 	}
 }
 
-// Perform collision detection between Player and other entities
-void CGame::PerformCollisionDetection()
+// Makes the Fish wander to random Destinations (the only AI done by Fish far from the Player and Shark)
+void CGame::PerformWanderAI(CObject* _cpObject, SRandomNumberGenerator& _sRandom)
 {
-	// Temp local variables
-	int iIndex = 0;									// Temp counting variable
-	list<CObject>::iterator cObjectListIterator;	// Used to loop through the Object list
-	float fRadius = 0.0f;							// Radius of the Object
-	float fSharkCollisionDistance = 0.0f;			// Distance away from Object Shark must be to attack
-	float fPlayerCollisionDistance = 0.0f;			// Distance away from Fish Player must be to capture it
-	bool bObjectIsAnItem = false;
-	
-	// Store the Player and Sharks Bounding Radius
-	float fPlayerRadius = mcpPlayer->mcpEntity->getBoundingRadius();
-	float fSharkRadius = mcpShark->mcpEntity->getBoundingRadius();
-	
-	// Get the current Number of Objects
-	int iNumberOfObjects = (int)mcObjectList.size();
-	
-	// Loop through all of the Objects and check for a collision
-	cObjectListIterator = mcObjectList.begin();
-	for (iIndex = 0; iIndex < iNumberOfObjects; iIndex++)
+	// If the Fish is not already exploring
+	if (_cpObject->GetState() != GiOBJECT_STATE_EXPLORING ||
+		_cpObject->GetIfObjectHasReachedAllDestinations())
 	{
-		// If this Object is Dead
-		if (cObjectListIterator->GetState() == GiOBJECT_STATE_DEAD)
+		// Make sure Auto-Tracking is turned on and it is moving at full speed
+		_cpObject->SetIfObjectShouldMoveToDestinationAutomatically(true, true);
+		_cpObject->SetAccelerationRate(_cpObject->GetDefaultAccelerationRate());
+		_cpObject->SetRotationVelocitySpeed(_cpObject->GetDefaultRotationVelocitySpeed());
+
+		// Clear the Fish's Destination list
+		_cpObject->mcDestinationList.Purge();
+
+		// Give them a new random Destination to go to
+		Vector3 sRandomDestination = Vector3::ZERO;
+		sRandomDestination.x = _sRandom.ReturnRangeRandom(GiLEVEL_LEFT, GiLEVEL_RIGHT);
+		sRandomDestination.y = _sRandom.ReturnRangeRandom(GiLEVEL_BOTTOM, GiLEVEL_TOP);
+		sRandomDestination.z = _sRandom.ReturnRangeRandom(GiLEVEL_BACK, GiLEVEL_FRONT);
+
+		// Add the new Destination to the Object
+		_cpObject->mcDestinationList.PushFront(SDestination(sRandomDestination));
+		_cpObject->GetNextDestination();
+
+		// Set the Fish's State
+		_cpObject->SetState(GiOBJECT_STATE_EXPLORING);
+	}
+}
+
+// Returns which AI Level Of Detail the Flocking Fish should be in, based on how close it is to the Player or Shark
+int CGame::ReturnAILevelOfDetail(CObject* _cpFish) const
+{
+	// Find the distance to whichever of the Player or closest Shark is closer (from what the Fish sensed this Step)
+	SPerception const& sPerception = _cpFish->mcAIHelper.msPerception;
+	float fDistanceSquared = sPerception.fPlayerDistanceSquared;
+	if (sPerception.bThereIsAPreditor && sPerception.fClosestPreditorDistanceSquared < fDistanceSquared)
+	{
+		fDistanceSquared = sPerception.fClosestPreditorDistanceSquared;
+	}
+	float fDistance = Math::Sqrt(fDistanceSquared);
+
+	// Fish must move a little past a boundary before they change Level Of Detail, so Fish sitting on one don't keep switching back and forth
+	float fNearDistance = mfAINearDistance;
+	float fFarDistance = mfAIFarDistance;
+	if (_cpFish->mspFlocking->iAILevelOfDetail == GiAI_LEVEL_OF_DETAIL_NEAR)
+	{
+		fNearDistance *= (1.0f + GfAI_LEVEL_OF_DETAIL_HYSTERESIS);
+	}
+	else if (_cpFish->mspFlocking->iAILevelOfDetail == GiAI_LEVEL_OF_DETAIL_FAR)
+	{
+		fFarDistance *= (1.0f - GfAI_LEVEL_OF_DETAIL_HYSTERESIS);
+	}
+
+	// Return the Level Of Detail the distance falls in
+	if (fDistance < fNearDistance)
+	{
+		return GiAI_LEVEL_OF_DETAIL_NEAR;
+	}
+	else if (fDistance > fFarDistance)
+	{
+		return GiAI_LEVEL_OF_DETAIL_FAR;
+	}
+	return GiAI_LEVEL_OF_DETAIL_MID;
+}
+
+// Returns the distance from the Position to whichever of the Player or closest Shark is closer
+float CGame::ReturnDistanceToPlayerOrShark(Vector3 _sPosition) const
+{
+	Vector3 sSharkPosition = Vector3::ZERO;
+	float fPlayerDistanceSquared = _sPosition.squaredDistance(mcWorldState.ReturnPosition(mcpPlayer));
+
+	// If there are no Sharks, only the Player counts
+	if (!mcSharkInfluenceGrid.ReturnClosestPreditor(_sPosition, sSharkPosition))
+	{
+		return Math::Sqrt(fPlayerDistanceSquared);
+	}
+
+	float fSharkDistanceSquared = _sPosition.squaredDistance(sSharkPosition);
+	return Math::Sqrt((fPlayerDistanceSquared < fSharkDistanceSquared) ? fPlayerDistanceSquared : fSharkDistanceSquared);
+}
+
+// Stores every Sharks Position in the Shark Influence Grid
+void CGame::UpdateSharkInfluence()
+{
+	PROFILE_ZONE("UpdateSharkInfluence");
+
+	// Get every Sharks Position
+	mcSharkPositionList.clear();
+	for (int iShark = 0; iShark < (int)mcSharkList.size(); iShark++)
+	{
+		mcSharkPositionList.push_back(mcWorldState.ReturnPosition(mcSharkList[iShark]));
+	}
+
+	// Fill in the Grid (this costs the same no matter how many Fish there are)
+	mcSharkInfluenceGrid.UpdateInfluence(mcSharkPositionList);
+}
+
+// Works out what each living Fish and Shark senses about the Sharks and the Player this Step
+void CGame::UpdatePerception()
+{
+	PROFILE_ZONE("UpdatePerception");
+
+	int iIndex = 0;
+	int iNumberOfFish = mcObjectPool.ReturnNumberOfObjectsWithComponent(GiCOMPONENT_FISH_BRAIN);
+	int iNumberOfSharks = mcObjectPool.ReturnNumberOfObjectsWithComponent(GiCOMPONENT_SHARK_BRAIN);
+
+	// Loop through the Fish
+	for (iIndex = 0; iIndex < iNumberOfFish; iIndex++)
+	{
+		CObject* cpObject = &mcObjectPool.ReturnObjectWithComponentAtIndex(GiCOMPONENT_FISH_BRAIN, iIndex);
+
+		// If this Fish is Dead, or it is part of a School (its School is moved for it)
+		if (cpObject->GetState() == GiOBJECT_STATE_DEAD || (cpObject->mspFlocking != NULL && cpObject->mspFlocking->iSchoolIndex != -1))
+		{
+			// It has nothing to sense
+			continue;
+		}
+
+		SPerception& sPerception = cpObject->mcAIHelper.msPerception;
+		Vector3 sPosition = cpObject->GetPosition();
+
+		// Sense the Player
+		SensePlayer(cpObject);
+
+		// Sense the closest Shark
+		float fSenseSharkRange = mcObjectPool.ReturnFishBrainAtIndex(iIndex).fSenseSharkRange;
+		sPerception.bThereIsAPreditor = mcSharkInfluenceGrid.ReturnClosestPreditor(sPosition, sPerception.sClosestPreditorPosition);
+		sPerception.fClosestPreditorDistanceSquared = sPerception.bThereIsAPreditor ? sPosition.squaredDistance(sPerception.sClosestPreditorPosition) : 0.0f;
+		sPerception.bCanSensePreditor = (sPerception.bThereIsAPreditor &&
+			sPerception.fClosestPreditorDistanceSquared < (fSenseSharkRange * fSenseSharkRange));
+	}
+
+	// Loop through the Sharks
+	for (iIndex = 0; iIndex < iNumberOfSharks; iIndex++)
+	{
+		CObject* cpObject = &mcObjectPool.ReturnObjectWithComponentAtIndex(GiCOMPONENT_SHARK_BRAIN, iIndex);
+
+		// If this Shark is Dead
+		if (cpObject->GetState() == GiOBJECT_STATE_DEAD)
 		{
-			// If this Object is a Ring
-			if (cObjectListIterator->GetSpecificObjectType() == GiOBJECT_SPECIFIC_TYPE_RING)
+			// It has nothing to sense
+			continue;
+		}
+
+		// Sense the Player
+		SensePlayer(cpObject);
+
+		// Sharks have no Preditors
+		SPerception& sPerception = cpObject->mcAIHelper.msPerception;
+		sPerception.bThereIsAPreditor = false;
+		sPerception.fClosestPreditorDistanceSquared = 0.0f;
+		sPerception.bCanSensePreditor = false;
+	}
+}
+
+// Works out how far the Object is from the Player and if it can sense it, and forgets its closest Neighbor until it is sensed again
+void CGame::SensePlayer(CObject* _cpObject)
+{
+	SPerception& sPerception = _cpObject->mcAIHelper.msPerception;
+
+	// Sense the Player
+	float fSenseSubmarineRange = _cpObject->mcAIHelper.GetSenseSubmarineRange();
+	sPerception.fPlayerDistanceSquared = _cpObject->GetPosition().squaredDistance(mcWorldState.ReturnPosition(mcpPlayer));
+	sPerception.bCanSensePlayer = (sPerception.fPlayerDistanceSquared < (fSenseSubmarineRange * fSenseSubmarineRange));
+
+	// The Neighbors are sensed once they have been updated this Step (see SenseClosestNeighbor())
+	sPerception.cpClosestNeighbor = NULL;
+	sPerception.bCanSenseClosestNeighbor = false;
+}
+
+// Works out which of the Objects Neighbors is closest and if it can sense it
+void CGame::SenseClosestNeighbor(CObject* _cpObject)
+{
+	SPerception& sPerception = _cpObject->mcAIHelper.msPerception;
+
+	// Get the closest Neighbor which still exists, and check if it is within the Sense Fish Range
+	// NOTE: The Neighbor is sensed where it was at the end of the last Step, so it doesn't matter if it has moved yet this Step
+	float fSenseFishRange = _cpObject->mcAIHelper.GetSenseFishRange();
+	sPerception.cpClosestNeighbor = ReturnClosestNeighbor(_cpObject);
+	sPerception.bCanSenseClosestNeighbor = (sPerception.cpClosestNeighbor != NULL &&
+		_cpObject->GetPosition().squaredDistance(mcWorldState.ReturnPosition(sPerception.cpClosestNeighbor)) < (fSenseFishRange * fSenseFishRange));
+}
+
+// Expands the Schools the Player or Shark have come close to, groups far away Flocking Fish into Schools, and moves the Schools
+void CGame::UpdateFishSchools()
+{
+	PROFILE_ZONE("UpdateFishSchools");
+
+	int iIndex = 0;
+	int iSchool = 0;
+
+	// Schools are expanded once any of their Fish would no longer be Far, and are only formed from Fish well past
+	//	that (beyond the Far Distance plus a School's width) so new Schools aren't expanded again straight away
+	float fExpandDistance = mfAIFarDistance * (1.0f - GfAI_LEVEL_OF_DETAIL_HYSTERESIS);
+	float fFormDistance = mfAIFarDistance + (2.0f * mfFishSchoolRadius);
+
+	// Loop through the Schools
+	for (iSchool = 0; iSchool < mcFishSchoolList.ReturnNumberOfSchoolSlots(); iSchool++)
+	{
+		// If this slot holds a School
+		if (mcFishSchoolList.ReturnIfSchoolIsInUse(iSchool))
+		{
+			// If Schools were turned off, or the Player or Shark has come close to the School
+			if (mfFishSchoolRadius <= 0.0f ||
+				(ReturnDistanceToPlayerOrShark(mcFishSchoolList.ReturnSchoolCentre(iSchool)) - mcFishSchoolList.ReturnSchoolSpread(iSchool)) < fExpandDistance)
 			{
-				// If the Ring was retrieved over 1 second ago
-				if (cObjectListIterator->mcAIHelper.mcDegradationTimer.ReturnTimePassedSinceLastRestartUsingSavedTime() > 1000)
-				{
-					// Hide the Ring
-					cObjectListIterator->mcpSceneNode->setVisible(false);
+				// Turn the School's Members back into individual Fish so their full AI takes over
+				mcFishSchoolList.ExpandSchool(iSchool, mcObjectPool);
+			}
+		}
+	}
 
-					// Delete all of the Rings children (other "world" Enemies)
-					cObjectListIterator->mcpSceneNode->removeAndDestroyAllChildren();
+	// If it's time to group far away Fish into Schools (Fish only move a little each Step, so this isn't done every Step)
+	if (mfFishSchoolRadius > 0.0f && (mulNumberOfAISteps % GiFISH_SCHOOL_FORMING_INTERVAL) == 0)
+	{
+		int iNumberOfFlockingFish = mcObjectPool.ReturnNumberOfObjectsWithComponent(GiCOMPONENT_FLOCKING);
+		SObjectHandle saNeighbors[GiMAX_SPATIAL_GRID_QUERY_NEIGHBORS];
 
-					// Delete the Rings Entity and Scene Node
-					cObjectListIterator->mcpSceneNode->detachObject(cObjectListIterator->mcpEntity);
-					mcpSceneManager->destroyEntity(cObjectListIterator->mcpEntity);
-					mcpSceneManager->destroySceneNode(cObjectListIterator->mcpSceneNode->getName());
+		// Loop through the Flocking Fish
+		for (iIndex = 0; iIndex < iNumberOfFlockingFish; iIndex++)
+		{
+			CObject* cpObject = &mcObjectPool.ReturnObjectWithComponentAtIndex(GiCOMPONENT_FLOCKING, iIndex);
+			SFlocking const& sFlocking = mcObjectPool.ReturnFlockingAtIndex(iIndex);
+
+			// If this is not a living Flocking Fish which is Far from, and well away from, the Player and Shark, or it is already in a School
+			if (cpObject->GetState() == GiOBJECT_STATE_DEAD ||
+				sFlocking.iSchoolIndex != -1 ||
+				sFlocking.iAILevelOfDetail != GiAI_LEVEL_OF_DETAIL_FAR ||
+				ReturnDistanceToPlayerOrShark(cpObject->GetPosition()) < fFormDistance)
+			{
+				continue;
+			}
 
-					// Delete the Ring from the Object List (and move to the next Object in the List)
-					cObjectListIterator = mcObjectList.erase(cObjectListIterator);
-				}
-				else
-				{
-					// Scale the Ring based on how much time has passed
-					float fScaleFactor = 1.05f + mcFrameEvent.timeSinceLastFrame;
-					cObjectListIterator->mcpSceneNode->scale(fScaleFactor, fScaleFactor, fScaleFactor);
+			// If Mixed Flocking is not allowed, Schools only hold one type of Fish
+			int iSpecificTypeFilter = mbAllowMixedFlocking ? -1 : cpObject->GetSpecificObjectType();
 
-					// Move to the next Object in the list
-					cObjectListIterator++;
-				}
+			// If there is a School close enough to join, join it
+			iSchool = mcFishSchoolList.ReturnSchoolToJoin(cpObject->GetPosition(), iSpecificTypeFilter, mfFishSchoolRadius);
+			if (iSchool != -1)
+			{
+				mcFishSchoolList.AddMember(iSchool, cpObject);
+				continue;
 			}
-			// Else this Object is not a Ring
-			else
+
+			// Find the other Fish close enough to form a School with
+			int iNumberOfNeighbors = mcSpatialGrid.FindNearestNeighbors(cpObject->GetPosition(), mfFishSchoolRadius, GiMAX_SPATIAL_GRID_QUERY_NEIGHBORS,
+				iSpecificTypeFilter, cpObject, saNeighbors);
+
+			// Pick the ones which are also Far and not already in a School
+			mcNewSchoolList.clear();
+			mcNewSchoolList.push_back(cpObject);
+			for (int iNeighbor = 0; iNeighbor < iNumberOfNeighbors; iNeighbor++)
 			{
-				// If this Object has been dead for long enough
-				if (cObjectListIterator->mcAIHelper.mcDegradationTimer.XTimeHasPassedUsingSavedTime(3000))
+				CObject* cpNeighbor = mcObjectPool.ReturnObject(saNeighbors[iNeighbor]);
+				if (cpNeighbor != NULL && cpNeighbor->mspFlocking != NULL && cpNeighbor->mspFlocking->iSchoolIndex == -1 &&
+					cpNeighbor->mspFlocking->iAILevelOfDetail == GiAI_LEVEL_OF_DETAIL_FAR &&
+					ReturnDistanceToPlayerOrShark(cpNeighbor->GetPosition()) >= fFormDistance)
 				{
-					// All Neighbor references to this Object should have been cleared out by now
-					// so Delete the Object from the Object List (and move to the next Object in the list)
-					cObjectListIterator = mcObjectList.erase(cObjectListIterator);
+					mcNewSchoolList.push_back(cpNeighbor);
 				}
 			}
 
-			// Move to the next Object
-			continue;
+			// If there are enough Fish, group them into a School
+			if ((int)mcNewSchoolList.size() >= GiMIN_NUMBER_OF_FISH_IN_SCHOOL)
+			{
+				mcFishSchoolList.CreateSchool(mcNewSchoolList);
+			}
 		}
+	}
 
-		// Determine the Sharks attack range based on if the Object is the Player or a Fish
-		// If the Object is the Player
-		if (cObjectListIterator->GetGeneralObjectType() == GiOBJECT_GENERAL_TYPE_PLAYER)
-		{
-			fSharkCollisionDistance = mcpShark->mcAIHelper.GetAttackRange();
-		}
-		// Else it is a Fish
-		else
+	// Move the Schools
+	mcFishSchoolList.UpdateSchools(mfTimeStep);
+}
+
+// Perform collision detection between Player and other entities
+void CGame::PerformCollisionDetection()
+{
+	PROFILE_ZONE("PerformCollisionDetection");
+
+	// Temp local variables
+	int iIndex = 0;									// Temp counting variable
+	CObject* cpObject = NULL;						// The Object being checked
+	float fCollisionDistance = 0.0f;				// How close the Object must be to collide
+
+	// Store the Players Bounding Radius
+	float fPlayerRadius = mcpPlayer->GetBoundingRadius();
+
+	// Expand the Rings which were retrieved, and Remove the ones which are done expanding
+	UpdateDyingRings();
+
+
+	//---------- Player capturing Fish and getting Items ----------
+
+	// Get the Players Item and Fish Capture ranges
+	float fPlayerItemRange = mfPlayerGetItemRange;
+	float fPlayerFishRange = mfPlayerCaptureFishRange;
+
+	// Find every Fish and Item which could be close enough to the Player (using the largest range and Object there could be)
+	float fPlayerQueryRange = fPlayerRadius + ((fPlayerItemRange > fPlayerFishRange) ? fPlayerItemRange : fPlayerFishRange) + mfLargestCollisionRadius;
+	mcCollisionGrid.FindObjectsInRange(mcpPlayer->GetPosition(), fPlayerQueryRange, mcCollisionCandidateList);
+
+	// Loop through the Objects which may be colliding with the Player
+	for (iIndex = 0; iIndex < (int)mcCollisionCandidateList.size(); iIndex++)
+	{
+		cpObject = mcCollisionCandidateList[iIndex];
+
+		// If this Object is Dead
+		if (cpObject->GetState() == GiOBJECT_STATE_DEAD)
 		{
-			fSharkCollisionDistance = mcpShark->mcAIHelper.GetFeedRange();
+			continue;
 		}
 
 		// Get the Players Capture Range based on if this is an Item or not
-		if (cObjectListIterator->GetGeneralObjectType() == GiOBJECT_GENERAL_TYPE_ITEM)
-		{
-			// Get the Players Item Capture range
-			fPlayerCollisionDistance = mcpPlayer->mcAIHelper.GetFeedRange();
+		fCollisionDistance = (cpObject->GetGeneralObjectType() == GiOBJECT_GENERAL_TYPE_ITEM) ? fPlayerItemRange : fPlayerFishRange;
+		fCollisionDistance += cpObject->GetBoundingRadius() + fPlayerRadius;
 
-			// Record that this Object is an Item
-			bObjectIsAnItem = true;
-		}
-		else
+		// If the Player is close enough to the Object for a collision
+		if (mcpPlayer->GetPosition().squaredDistance(cpObject->GetPosition()) < (fCollisionDistance * fCollisionDistance))
 		{
-			// Get the Players Fish Capture range
-			fPlayerCollisionDistance = mcpPlayer->mcAIHelper.GetAttackRange();
-
-			// Record that this Object is an Item
-			bObjectIsAnItem = false;
+			// Capture the Fish or get the Item
+			PlayerCapturesObject(cpObject);
 		}
+	}
+
+
+	// Loop through every Shark
+	for (int iShark = 0; iShark < (int)mcSharkList.size(); iShark++)
+	{
+		CObject* cpShark = mcSharkList[iShark];
+		float fSharkRadius = cpShark->GetBoundingRadius();
+
 
-		// Calculate the Radius of the Object
-		fRadius = cObjectListIterator->mcpEntity->getBoundingRadius();
+		//---------- Shark attacking the Player ----------
 
-		// If the Player is close enough to the Object for a collision AND
-		//	this Object is not the Player or the Shark
-		if (mcpPlayer->mcpSceneNode->getWorldPosition().distance(cObjectListIterator->mcpSceneNode->getWorldPosition()) < (fRadius + fPlayerRadius + fPlayerCollisionDistance) &&
-			mcpPlayer->GetID() != cObjectListIterator->GetID() && mcpShark->GetID() != cObjectListIterator->GetID())
+		// If the Shark is close enough to the Player to attack
+		fCollisionDistance = fPlayerRadius + fSharkRadius + cpShark->mspSharkBrain->fAttackRange;
+		if (cpShark->GetPosition().squaredDistance(mcpPlayer->GetPosition()) < (fCollisionDistance * fCollisionDistance))
 		{
-			// If the Goal of the Level is to Collect Objects
-			if (msLevelGoal.iGoal == GiLEVEL_GOAL_COLLECT)
+			// If the Shark hasn't just attacked the Player (its Hit Delay Event has fired)
+			if (!mcpScheduler->ReturnIfEventIsScheduled(cpShark->mspSharkBrain->sHitDelayEvent))
 			{
-				// If this is the type of Object the Player is Collecting
-				if (cObjectListIterator->GetSpecificObjectType() == msLevelGoal.iSpecificTypeToCollect)
+				// Push Player in direction away from Shark at the speed the Shark was travelling
+				Vector3 sAwayDirection = mcpPlayer->GetPosition() - cpShark->GetPosition();
+				sAwayDirection.normalise();
+				mcpPlayer->SetVelocity(sAwayDirection, cpShark->GetVelocitySpeed());
+
+				// Reduce the Players Health
+				mcpPlayer->mcpAttributes->SetHealthRelative(-1);
+
+				// If the Player is not already flashing from another Shark's attack
+				if (!mcpScheduler->ReturnIfEventIsScheduled(msPlayerFlashEvent))
 				{
-					// Increment the number of Objects the Player has Collected
-					msLevelGoal.iNumberCollected++;
+					// Make the Player flash (an even amount of times) for as long as they are invincible to the Shark
+					int iNumOfTimesToFlash = (cpShark->mspSharkBrain->ulHitDelay / 400);
+					msPlayerFlashEvent = mcpScheduler->ScheduleNewEvent(MakePlayerFlash, 0, this, iNumOfTimesToFlash * 2, 200);
 				}
-			}
-
-			// Get how many Points the Object was worth
-			int iPointsEarned = cObjectListIterator->mcAttributes.ReturnNumberOfPoints();
 
-			// If the Player earned enough points for an extra Health point
-			if ((int)(mcpPlayer->mcAttributes.ReturnNumberOfPoints() / GiPOINTS_NEEDED_FOR_EXTRA_HEALTH) !=
-				(int)((mcpPlayer->mcAttributes.ReturnNumberOfPoints() + iPointsEarned) / GiPOINTS_NEEDED_FOR_EXTRA_HEALTH))
-			{
-				// Increase the Players health by one point
-				mcpPlayer->mcAttributes.SetHealthRelative(1);
+				// Start the Sharks Hit Delay (it avoids the Player until the Event fires)
+				cpShark->mspSharkBrain->sHitDelayEvent = mcpScheduler->ScheduleNewEvent(EndSharkHitDelay, cpShark->mspSharkBrain->ulHitDelay, cpShark);
 			}
+		}
 
-			// Add the Objects Points to the Players Points
-			mcpPlayer->mcAttributes.SetNumberOfPointsRelative(iPointsEarned);
 
-			// If we have a handle to the Player Got Points TextBox
-			if (mcpPlayerGotPointsTextBox != NULL)
-			{
-				// Display a message based on how many Points were earned
-				if (iPointsEarned < 200)
-				{
-					mcpPlayerGotPointsTextBox->SetAll("  Nice\n" + StringConverter::toString(iPointsEarned) + " Points", 0.35, 0.4);
-				}
-				else if (iPointsEarned < 400)
-				{
-					mcpPlayerGotPointsTextBox->SetAll("  Sweet\n" + StringConverter::toString(iPointsEarned) + " Points", 0.35, 0.4);
-				}
-				else if (iPointsEarned < 600)
-				{
-					mcpPlayerGotPointsTextBox->SetAll("  Great\n" + StringConverter::toString(iPointsEarned) + " Points", 0.35, 0.4);
-				}
-				else if (iPointsEarned < 800)
-				{
-					mcpPlayerGotPointsTextBox->SetAll("  Super\n" + StringConverter::toString(iPointsEarned) + " Points", 0.35, 0.4);
-				}
-				else
-				{
-					mcpPlayerGotPointsTextBox->SetAll("Holy Mackerel\n  " + StringConverter::toString(iPointsEarned) + " Points", 0.28, 0.4);
-				}
+		//---------- Shark feeding on Fish ----------
 
-				// Randomly pick and set the color to display the message in
-				mcpPlayerGotPointsTextBox->SetColour(ColourValue(Math::UnitRandom(), Math::UnitRandom(), Math::UnitRandom()));
-				
-				// Display the message
-				mcpPlayerGotPointsTextBox->Show(true);
+		// Find every Fish which could be close enough for the Shark to feed on (Fish the Player or another Shark just ate are marked Dead)
+		float fSharkFeedRange = cpShark->mspSharkBrain->fFeedRange;
+		mcCollisionGrid.FindObjectsInRange(cpShark->GetPosition(), fSharkRadius + fSharkFeedRange + mfLargestCollisionRadius, mcCollisionCandidateList);
+
+		// Loop through the Objects which may be close enough to the Shark
+		for (iIndex = 0; iIndex < (int)mcCollisionCandidateList.size(); iIndex++)
+		{
+			cpObject = mcCollisionCandidateList[iIndex];
 
-				// Reset the Player Got Points Timer
-				mcPlayerGotPointsTimer.RestartTimerUsingSavedTime();
+			// If this Object is Dead or is not a Fish (the Shark doesn't eat Items)
+			if (cpObject->GetState() == GiOBJECT_STATE_DEAD ||
+				cpObject->GetGeneralObjectType() != GiOBJECT_GENERAL_TYPE_ENEMY)
+			{
+				continue;
 			}
 
-			// If this Object is a Fish
-			if (cObjectListIterator->GetGeneralObjectType() == GiOBJECT_GENERAL_TYPE_ENEMY)
+			// If the Shark is close enough to the Fish to feed
+			fCollisionDistance = cpObject->GetBoundingRadius() + fSharkRadius + fSharkFeedRange;
+			if (cpShark->GetPosition().squaredDistance(cpObject->GetPosition()) < (fCollisionDistance * fCollisionDistance))
 			{
 				// If this is a Flocking Fish
-				if (cObjectListIterator->mcAIHelper.GetIsAFlockingFish())
+				if (cpObject->mspFlocking != NULL)
 				{
 					// Decrement the number of Flocking Fish left
 					miFlockingFishCount--;
@@ -1990,162 +2951,430 @@ void CGame::PerformCollisionDetection()
 					miNonFlockingFishCount--;
 				}
 
-				// Hide the Object
-				cObjectListIterator->mcpSceneNode->setVisible(false);
+				// Add the Objects Health to the Sharks Health
+				cpShark->mcpAttributes->SetHealthRelative(cpObject->mcpAttributes->ReturnHealth());
 
-				// Delete all of the Objects children (other "world" Enemies)
-				cObjectListIterator->mcpSceneNode->removeAndDestroyAllChildren();
+				// Remove the Fish from the level at the end of the Step (it is marked Dead so no other Shark eats it)
+				RequestObjectRemoval(cpObject);
+			}
+		}
+	}
+}
 
-				// Delete the Objects Entity and Scene Node
-				cObjectListIterator->mcpSceneNode->detachObject(cObjectListIterator->mcpEntity);
-				mcpSceneManager->destroyEntity(cObjectListIterator->mcpEntity);
-				mcpSceneManager->destroySceneNode(cObjectListIterator->mcpSceneNode->getName());
+// Handles the Player capturing the Fish or getting the Item
+void CGame::PlayerCapturesObject(CObject* _cpObject)
+{
+	// If the Goal of the Level is to Collect Objects
+	if (msLevelGoal.iGoal == GiLEVEL_GOAL_COLLECT)
+	{
+		// If this is the type of Object the Player is Collecting
+		if (_cpObject->GetSpecificObjectType() == msLevelGoal.iSpecificTypeToCollect)
+		{
+			// Increment the number of Objects the Player has Collected
+			msLevelGoal.iNumberCollected++;
+		}
+	}
 
-				// Mark the Object to be deleted
-				cObjectListIterator->SetState(GiOBJECT_STATE_DEAD);
-				cObjectListIterator->mcAIHelper.mcDegradationTimer.RestartTimerUsingSavedTime();
+	// Get how many Points the Object was worth
+	int iPointsEarned = _cpObject->mcpAttributes->ReturnNumberOfPoints();
 
-				// Move to the next Object in the list
-				cObjectListIterator++;
-			}
-			// Else if the Object the Player collided with is an Item
-			else if (cObjectListIterator->GetGeneralObjectType() == GiOBJECT_GENERAL_TYPE_ITEM)
-			{
-				// Check which type of item the Player picked up
-				switch (cObjectListIterator->GetSpecificObjectType())
-				{
-					default:
-					case GiOBJECT_SPECIFIC_TYPE_RING:
-						// Add 5 seconds to the time remaining
-						mfLevelTime += 5.0;
+	// If the Player earned enough points for an extra Health point
+	if ((int)(mcpPlayer->mcpAttributes->ReturnNumberOfPoints() / GiPOINTS_NEEDED_FOR_EXTRA_HEALTH) !=
+		(int)((mcpPlayer->mcpAttributes->ReturnNumberOfPoints() + iPointsEarned) / GiPOINTS_NEEDED_FOR_EXTRA_HEALTH))
+	{
+		// Increase the Players health by one point
+		mcpPlayer->mcpAttributes->SetHealthRelative(1);
+	}
 
-						// Display that time was added to the level time remaining
-						mcpPlayerGotPointsTextBox->SetAll("+5 seconds", 0.28, 0.4);
+	// Add the Objects Points to the Players Points
+	mcpPlayer->mcpAttributes->SetNumberOfPointsRelative(iPointsEarned);
 
-						// Randomly pick and set the color to display the message in
-						mcpPlayerGotPointsTextBox->SetColour(ColourValue(Math::UnitRandom(), Math::UnitRandom(), Math::UnitRandom()));
-					break;
+	// If we have a handle to the Player Got Points TextBox
+	if (mcpPlayerGotPointsTextBox != NULL)
+	{
+		// Display a message based on how many Points were earned
+		if (iPointsEarned < 200)
+		{
+			mcpPlayerGotPointsTextBox->SetAll("  Nice\n" + StringConverter::toString(iPointsEarned) + " Points", 0.35, 0.4);
+		}
+		else if (iPointsEarned < 400)
+		{
+			mcpPlayerGotPointsTextBox->SetAll("  Sweet\n" + StringConverter::toString(iPointsEarned) + " Points", 0.35, 0.4);
+		}
+		else if (iPointsEarned < 600)
+		{
+			mcpPlayerGotPointsTextBox->SetAll("  Great\n" + StringConverter::toString(iPointsEarned) + " Points", 0.35, 0.4);
+		}
+		else if (iPointsEarned < 800)
+		{
+			mcpPlayerGotPointsTextBox->SetAll("  Super\n" + StringConverter::toString(iPointsEarned) + " Points", 0.35, 0.4);
+		}
+		else
+		{
+			mcpPlayerGotPointsTextBox->SetAll("Holy Mackerel\n  " + StringConverter::toString(iPointsEarned) + " Points", 0.28, 0.4);
+		}
 
-					case GiOBJECT_SPECIFIC_TYPE_DIAMOND:
-						// Increase the Players speed a bit
-						mcpPlayer->SetMaxVelocitySpeed(mcpPlayer->GetMaxVelocitySpeed() + (1.0 * GiMETER));
-					break;
-				}
+		// Randomly pick and set the color to display the message in
+		mcpPlayerGotPointsTextBox->SetColour(ColourValue(Math::UnitRandom(), Math::UnitRandom(), Math::UnitRandom()));
+		
+		// Display the message
+		mcpPlayerGotPointsTextBox->Show(true);
 
-				// If this Item is a Ring
-				if (cObjectListIterator->GetSpecificObjectType() == GiOBJECT_SPECIFIC_TYPE_RING)
+		// Reset the Player Got Points Timer
+		mcPlayerGotPointsTimer.RestartTimerUsingSavedTime();
+	}
+
+	// If this Object is a Fish
+	if (_cpObject->GetGeneralObjectType() == GiOBJECT_GENERAL_TYPE_ENEMY)
+	{
+		// If this is a Flocking Fish
+		if (_cpObject->mspFlocking != NULL)
+		{
+			// Decrement the number of Flocking Fish left
+			miFlockingFishCount--;
+		}
+		// Else it's not a Flocking Fish
+		else
+		{
+			// Decrement the number of Non-Flocking Fish left
+			miNonFlockingFishCount--;
+		}
+
+		// Remove the Fish from the level at the end of the Step (it is marked Dead so the Shark can't eat it too)
+		RequestObjectRemoval(_cpObject);
+	}
+	// Else if the Object the Player collided with is an Item
+	else if (_cpObject->GetGeneralObjectType() == GiOBJECT_GENERAL_TYPE_ITEM)
+	{
+		// Check which type of item the Player picked up
+		switch (_cpObject->GetSpecificObjectType())
+		{
+			default:
+			case GiOBJECT_SPECIFIC_TYPE_RING:
+				// Add 5 seconds to the time remaining
+				mfLevelTime += 5.0;
+
+				// If we have a handle to the Player Got Points TextBox
+				if (mcpPlayerGotPointsTextBox != NULL)
 				{
-					// Mark the Ring as being Dead (since we want it to expand before dissapearing)
-					cObjectListIterator->SetState(GiOBJECT_STATE_DEAD);
-					cObjectListIterator->mcAIHelper.mcDegradationTimer.RestartTimerUsingSavedTime();
+					// Display that time was added to the level time remaining
+					mcpPlayerGotPointsTextBox->SetAll("+5 seconds", 0.28, 0.4);
 
-					// Move to the next Object in the list
-					cObjectListIterator++;
+					// Randomly pick and set the color to display the message in
+					mcpPlayerGotPointsTextBox->SetColour(ColourValue(Math::UnitRandom(), Math::UnitRandom(), Math::UnitRandom()));
 				}
-				else
-				{
-					// Hide the Object
-					cObjectListIterator->mcpSceneNode->setVisible(false);
+			break;
+
+			case GiOBJECT_SPECIFIC_TYPE_DIAMOND:
+				// Increase the Players speed a bit
+				mcpPlayer->SetMaxVelocitySpeed(mcpPlayer->GetMaxVelocitySpeed() + (1.0 * GiMETER));
+			break;
+		}
+
+		// If this Item is a Ring
+		if (_cpObject->GetSpecificObjectType() == GiOBJECT_SPECIFIC_TYPE_RING)
+		{
+			// Start timing how long the Ring has been Dead (since we want it to expand before dissapearing)
+			_cpObject->mspCollectible->cDyingTimer.RestartTimerUsingSavedTime();
+
+			// Take the Ring out of the Collision Grid at the end of the Step so it can't be retrieved again, and let it expand
+			RequestObjectKill(_cpObject);
+		}
+		else
+		{
+			// Remove the Item from the level at the end of the Step
+			RequestObjectRemoval(_cpObject);
+		}
+	}
+}
+
+// Expands the Rings the Player has retrieved, and Removes them once they have expanded for a second
+void CGame::UpdateDyingRings()
+{
+	// Loop through the Items the Player can collect
+	int iNumberOfCollectibles = mcObjectPool.ReturnNumberOfObjectsWithComponent(GiCOMPONENT_COLLECTIBLE);
+	for (int iIndex = 0; iIndex < iNumberOfCollectibles; iIndex++)
+	{
+		SCollectible& sCollectible = mcObjectPool.ReturnCollectibleAtIndex(iIndex);
+
+		// If this Item is not dying, move to the next one
+		if (!sCollectible.bDying)
+		{
+			continue;
+		}
+
+		CObject* cpRing = &mcObjectPool.ReturnObjectWithComponentAtIndex(GiCOMPONENT_COLLECTIBLE, iIndex);
+
+		// If the Ring was retrieved less than 1 second ago
+		if (sCollectible.cDyingTimer.ReturnTimePassedSinceLastRestartUsingSavedTime() <= 1000)
+		{
+			// Scale the Ring based on how much time has passed, so it grows just as fast no matter how many Steps there are per second
+			// NOTE: The growth rate is what scaling by (1.05 + the time since the last frame) each frame gave at 60 frames per second
+			const float fRING_GROWTH_PER_SECOND = 48.05f;
+			float fScaleFactor = Math::Pow(fRING_GROWTH_PER_SECOND, mfTimeStep);
+			cpRing->mcpSceneNode->scale(fScaleFactor, fScaleFactor, fScaleFactor);
+		}
+		// Else the Ring is done expanding
+		else
+		{
+			// Remove the Ring from the level at the end of the Step (and don't Request it again before then)
+			RequestObjectRemoval(cpRing);
+			sCollectible.bDying = false;
+		}
+	}
+}
+
+// Inserts the Object into the Collision Grid so the Player and Shark can find it
+void CGame::InsertObjectIntoCollisionGrid(CObject* _cpObject)
+{
+	_cpObject->mcAIHelper.miCollisionGridHandle = mcCollisionGrid.InsertObject(_cpObject, _cpObject->GetPosition(), _cpObject->GetSpecificObjectType());
+
+	// Record the largest Bounding Radius so the Player and Shark know how far to look for Objects they may be touching
+	if (_cpObject->GetBoundingRadius() > mfLargestCollisionRadius)
+	{
+		mfLargestCollisionRadius = _cpObject->GetBoundingRadius();
+	}
+}
+
+// Runs one Simulation Step of the given length (AI, movement, collisions, and the level time)
+void CGame::StepSimulation(float _fTimeStepInSeconds)
+{
+	PROFILE_ZONE("StepSimulation");
+
+	CObject* cpObject = NULL;						// The Object being looked at
+	int iIndex = 0;									// Used to loop through the Objects
+	int iNumberOfObjects = mcObjectPool.ReturnNumberOfObjects();
+
+	// Record how much time this Step Simulates
+	mfTimeStep = _fTimeStepInSeconds;
+
+	// Record where every Object is before this Step so the Scene Nodes can be blended between Steps
+	for (iIndex = 0; iIndex < iNumberOfObjects; iIndex++)
+	{
+		cpObject = &mcObjectPool.ReturnObjectAtIndex(iIndex);
+		cpObject->SavePreviousTransform();
+	}
+
+	// Update all Objects AI, position, and orientation
+	UpdateObjects();
+
+	// Perform Player-Enemy collision detection
+	PerformCollisionDetection();
+
+	// Now that nothing is looping through the Objects, spawn, kill, and remove the Objects which were requested this Step
+	ApplyObjectCommands();
+
+	// If we are using the time for this level
+	if (mbLevelHasTimeLimit)
+	{
+		// Update time remaining to complete the level
+		mfLevelTime -= mfTimeStep;
+	}
+	else
+	{
+		// Update the time spent in this level so far
+		mfLevelTime += mfTimeStep;
+	}
+
+	// Now that every Object has finished this Step, make where they ended up the snapshot the next Step reads
+	PublishWorldState();
+}
+
+// Writes every Objects State into the World State and Swaps its buffers
+void CGame::PublishWorldState()
+{
+	PROFILE_ZONE("PublishWorldState");
+
+	int iNumberOfObjects = mcObjectPool.ReturnNumberOfObjects();
+
+	// Loop through all of the Objects and write their State into the buffer being written to
+	for (int iIndex = 0; iIndex < iNumberOfObjects; iIndex++)
+	{
+		mcWorldState.WriteObjectState(&mcObjectPool.ReturnObjectAtIndex(iIndex));
+	}
+
+	// Make the written buffer the snapshot for the next Step
+	mcWorldState.Swap();
+}
+
+// Runs as many fixed Simulation Steps as fit in the time since the last frame, then syncs the Scene Nodes
+void CGame::RunSimulationSteps(float _fTimeSinceLastFrame)
+{
+	// If fixed Steps are not being used
+	if (mfSimulationTimeStep <= 0.0f)
+	{
+		// Simulate the whole frame in one Step and use the Objects Transforms as they are
+		StepSimulation(_fTimeSinceLastFrame);
+		SyncObjectsToSceneNodes();
+		return;
+	}
+
+	// Add the time since the last frame to the time waiting to be Simulated
+	mfSimulationTimeAccumulator += _fTimeSinceLastFrame;
+
+	// Run a Step for each full Step of time waiting to be Simulated
+	int iNumberOfSteps = 0;
+	while (mfSimulationTimeAccumulator >= mfSimulationTimeStep && iNumberOfSteps < miMaxSimulationStepsPerFrame)
+	{
+		StepSimulation(mfSimulationTimeStep);
+		mfSimulationTimeAccumulator -= mfSimulationTimeStep;
+		iNumberOfSteps++;
+	}
+
+	// If we could not catch up (i.e. there was a long hitch), drop the time we fell behind by so the Simulation slows
+	//	down for a moment instead of running more and more Steps each frame trying to catch up
+	if (mfSimulationTimeAccumulator >= mfSimulationTimeStep)
+	{
+		mfSimulationTimeAccumulator = 0.0f;
+	}
+
+	// Render the Objects part way between their last two Steps, based on how much time is left over
+	SyncObjectsToSceneNodes(mfSimulationTimeAccumulator / mfSimulationTimeStep);
+}
+
+// Pushes the Position and Orientation of every Object to its Scene Node so it can be rendered
+void CGame::SyncObjectsToSceneNodes(float _fInterpolation)
+{
+	CObject* cpObject = NULL;						// The Object being synced
+	int iIndex = 0;									// Used to loop through the Objects
+	int iNumberOfObjects = mcObjectPool.ReturnNumberOfObjects();
+
+	// Loop through all of the Objects
+	for (iIndex = 0; iIndex < iNumberOfObjects; iIndex++)
+	{
+		cpObject = &mcObjectPool.ReturnObjectAtIndex(iIndex);
+
+		// Move this Objects Scene Node (does nothing if its Scene Node was already destroyed)
+		cpObject->SyncSceneNodeWithTransform(_fInterpolation);
+	}
+}
+
+// Destroys the Objects Entity and Scene Node (along with any of its children)
+void CGame::DestroyObjectsSceneNode(CObject* _cpObject)
+{
+	// If the Object has no Scene Node there is nothing to destroy
+	if (_cpObject->mcpSceneNode == NULL)
+	{
+		return;
+	}
+
+	// Hide the Object
+	_cpObject->mcpSceneNode->setVisible(false);
+
+	// Delete all of the Objects children (other "world" Enemies)
+	_cpObject->mcpSceneNode->removeAndDestroyAllChildren();
+
+	// If the Object is a Fish
+	int iSpecificType = _cpObject->GetSpecificObjectType();
+	if (_cpObject->GetGeneralObjectType() == GiOBJECT_GENERAL_TYPE_ENEMY &&
+		iSpecificType >= GiOBJECT_SPECIFIC_TYPE_FISH_INDEX_START && iSpecificType <= GiOBJECT_SPECIFIC_TYPE_FISH_INDEX_END)
+	{
+		// Take the Scene Node out of the scene so it isn't rendered while it is spare
+		if (_cpObject->mcpSceneNode->getParentSceneNode() != NULL)
+		{
+			_cpObject->mcpSceneNode->getParentSceneNode()->removeChild(_cpObject->mcpSceneNode);
+		}
+
+		// Keep the Scene Node and Entity for the next Fish of the same type, instead of deleting them
+		SFishScene sSpareFishScene;
+		sSpareFishScene.cpSceneNode = _cpObject->mcpSceneNode;
+		sSpareFishScene.cpEntity = _cpObject->mcpEntity;
+		mcaSpareFishSceneList[iSpecificType].push_back(sSpareFishScene);
+
+		_cpObject->mcpSceneNode = NULL;
+		_cpObject->mcpEntity = NULL;
+		return;
+	}
 
-					// Delete all of the Objects children (other "world" Enemies)
-					cObjectListIterator->mcpSceneNode->removeAndDestroyAllChildren();
+	// If the Object has an Entity (it won't when running Headless)
+	if (_cpObject->mcpEntity != NULL)
+	{
+		// Delete the Objects Entity
+		_cpObject->mcpSceneNode->detachObject(_cpObject->mcpEntity);
+		mcpSceneManager->destroyEntity(_cpObject->mcpEntity);
+		_cpObject->mcpEntity = NULL;
+	}
 
-					// Delete the Objects Entity and Scene Node
-					cObjectListIterator->mcpSceneNode->detachObject(cObjectListIterator->mcpEntity);
-					mcpSceneManager->destroyEntity(cObjectListIterator->mcpEntity);
-					mcpSceneManager->destroySceneNode(cObjectListIterator->mcpSceneNode->getName());
+	// Delete the Objects Scene Node
+	mcpSceneManager->destroySceneNode(_cpObject->mcpSceneNode->getName());
+	_cpObject->mcpSceneNode = NULL;
+}
 
-					// Erase this Object from the list and move to the next Object in the list
-					cObjectListIterator = mcObjectList.erase(cObjectListIterator);
-				}
-			}
-			else
-			{
-				// Move to the next Object in the list
-				cObjectListIterator++;
-			}
-		}
-		// Else if the Shark is close enough to the Object to attack/feed, and the Object is not the Shark, and the Object isn't an Item
-		else if (!bObjectIsAnItem && mcpShark->mcpSceneNode->getWorldPosition().distance(cObjectListIterator->mcpSceneNode->getWorldPosition()) < (fRadius + fSharkRadius + fSharkCollisionDistance) &&
-				 mcpShark->GetID() != cObjectListIterator->GetID())
-		{
-			// If this Object is the Player AND the Shark hasn't just attacked the Player
-			if (cObjectListIterator->GetGeneralObjectType() == GiOBJECT_GENERAL_TYPE_PLAYER &&
-				mcpShark->mcAIHelper.mcHitDelayTimer.XTimeHasPassedUsingSavedTime(mcpShark->mcAIHelper.GetHitDelay()))
-			{
-				// Push Player in direction away from Shark at the speed the Shark was travelling
-				Vector3 sAwayDirection = mcpPlayer->mcpSceneNode->getWorldPosition() - mcpShark->mcpSceneNode->getWorldPosition();
-				sAwayDirection.normalise();
-				mcpPlayer->SetVelocity(sAwayDirection, mcpShark->GetVelocitySpeed());
+// Removes the Object from the level (its Scene Node, Spatial Grid entry, and the Object itself)
+// NOTE: The Object must not be used after this, and any Handles to it become invalid
+void CGame::DestroyObject(CObject* _cpObject)
+{
+	// Hide and Delete the Objects Entity and Scene Node
+	DestroyObjectsSceneNode(_cpObject);
 
-				// Reduce the Players Health
-				mcpPlayer->mcAttributes.SetHealthRelative(-1);
+	// If the Object is a Flocking Fish in the Spatial Grid
+	if (_cpObject->mspFlocking != NULL && _cpObject->mspFlocking->iSpatialGridHandle != -1)
+	{
+		// Take the Object out of the Spatial Grid so it is no longer found as a Neighbor
+		mcSpatialGrid.RemoveObject(_cpObject->mspFlocking->iSpatialGridHandle);
+		_cpObject->mspFlocking->iSpatialGridHandle = -1;
+	}
 
-				// Make the Player flash (an even amount of times) for as long as they are invincible to the Shark
-				int iNumOfTimesToFlash = (mcpShark->mcAIHelper.GetHitDelay() / 400);
-				mcpScheduler->ScheduleNewEvent(MakePlayerFlash, 0, this, iNumOfTimesToFlash * 2, 200);
-				
-				// Reset the Sharks Hit Delay Timer
-				mcpShark->mcAIHelper.mcHitDelayTimer.RestartTimerUsingSavedTime();
-			}
-			// Else if this Object is a Fish
-			else if (cObjectListIterator->GetGeneralObjectType() == GiOBJECT_GENERAL_TYPE_ENEMY)
-			{
-				// If this is a Flocking Fish
-				if (cObjectListIterator->mcAIHelper.GetIsAFlockingFish())
-				{
-					// Decrement the number of Flocking Fish left
-					miFlockingFishCount--;
-				}
-				// Else it's not a Flocking Fish
-				else
-				{
-					// Decrement the number of Non-Flocking Fish left
-					miNonFlockingFishCount--;
-				}
+	// If the Object is in the Collision Grid
+	if (_cpObject->mcAIHelper.miCollisionGridHandle != -1)
+	{
+		// Take the Object out of the Collision Grid so the Player and Shark can no longer collide with it
+		mcCollisionGrid.RemoveObject(_cpObject->mcAIHelper.miCollisionGridHandle);
+		_cpObject->mcAIHelper.miCollisionGridHandle = -1;
+	}
 
-				// Hide the Object
-				cObjectListIterator->mcpSceneNode->setVisible(false);
+	// If the Object is a Flocking Fish in a School
+	if (_cpObject->mspFlocking != NULL && _cpObject->mspFlocking->iSchoolIndex != -1)
+	{
+		// Take the Object out of its School so the School no longer moves it
+		mcFishSchoolList.RemoveMember(_cpObject);
+	}
 
-				// Add the Objects Health to the Sharks Health
-				mcpShark->mcAttributes.SetHealthRelative(cObjectListIterator->mcAttributes.ReturnHealth());
+	// If the Object is in the AI Scheduler
+	if (_cpObject->mcAIHelper.miAISchedulerHandle != -1)
+	{
+		// Take the Object out of the AI Scheduler so it is no longer Updated
+		mcAIScheduler.RemoveObject(_cpObject->mcAIHelper.miAISchedulerHandle);
+		_cpObject->mcAIHelper.miAISchedulerHandle = -1;
+	}
 
-				// Remove this Object from the Sharks Neighbor list if it's in there
-				mcpShark->mcAIHelper.mcNeighborList.remove(&*cObjectListIterator);
+	// Stop the Objects Degradation Event (if it has one) so it is not fired on a Removed Object
+	mcpScheduler->RemoveScheduledEvent(_cpObject->mcAIHelper.msDegradationEvent);
+	_cpObject->mcAIHelper.msDegradationEvent = SEventHandle();
 
-				// Delete all of the Objects children (other "world" Enemies)
-				cObjectListIterator->mcpSceneNode->removeAndDestroyAllChildren();
+	// Remove the Object from the Object Pool
+	mcObjectPool.RemoveObject(_cpObject->msHandle);
+}
 
-				// Delete the Object Entity and Scene Node
-				cObjectListIterator->mcpSceneNode->detachObject(cObjectListIterator->mcpEntity);
-				mcpSceneManager->destroyEntity(cObjectListIterator->mcpEntity);
-				mcpSceneManager->destroySceneNode(cObjectListIterator->mcpSceneNode->getName());
+// Returns the closest of the Objects Neighbors which still exists, or NULL if there isn't one
+// NOTE: Dead Fish are Removed in the same Step they die (only Rings stay around while Dead, and they are never
+//		 Neighbors), so the Neighbors State is not checked (it may be being changed by another Thread)
+CObject* CGame::ReturnClosestNeighbor(CObject* _cpObject) const
+{
+	CObject* cpNeighbor = NULL;
 
-				// Mark the Object to be deleted
-				cObjectListIterator->SetState(GiOBJECT_STATE_DEAD);
-				cObjectListIterator->mcAIHelper.mcDegradationTimer.RestartTimerUsingSavedTime();
+	// Loop through the Neighbors from closest to farthest
+	for (int iIndex = 0; iIndex < _cpObject->mcAIHelper.miNumberOfNeighbors; iIndex++)
+	{
+		// Get the Neighbor (NULL if it has been Removed since the Neighbors were found)
+		cpNeighbor = mcObjectPool.ReturnObject(_cpObject->mcAIHelper.msaNeighbors[iIndex]);
 
-				// Move to the next Object in the list
-				cObjectListIterator++;
-			}
-			else
-			{
-				// Move to the next Object in the list
-				cObjectListIterator++;
-			}
-		}
-		// Else the Player and Shark are not colliding with this Object
-		else
+		// If this Neighbor still exists
+		if (cpNeighbor != NULL)
 		{
-			// Move to the next Object in the list
-			cObjectListIterator++;
+			return cpNeighbor;
 		}
 	}
+
+	// No Neighbors were found
+	return NULL;
 }
 
 // Update the Cameras Position and Orientation based on the mode being used
 void CGame::UpdateCamera()
 {
+	PROFILE_ZONE("UpdateCamera");
+
 	// Temp variable used to tell how much time has passed since switching Camera Modes
 	unsigned long ulTimeSinceRestart = 0;
 
@@ -2246,7 +3475,7 @@ void CGame::UpdateCamera()
 
 
 	// If the Player is no longer flashing from being attacked
-	if (mcpScheduler->IsEmpty())
+	if (!mcpScheduler->ReturnIfEventIsScheduled(msPlayerFlashEvent))
 	{
 		// If the camera is in 1st person view mode
 		if (miCameraMode == GiCAMERA_MODE_FIRST_PERSON)
@@ -2270,8 +3499,10 @@ void CGame::UpdateCamera()
 // Updates the time remaining to complete the level HUD
 void CGame::UpdateHUDs(float _fTimeRemaining)
 {
+	PROFILE_ZONE("UpdateHUDs");
+
 	// Create and display string showing the Players Health
-	String sText = "Health " + StringConverter::toString(mcpPlayer->mcAttributes.ReturnHealth());
+	String sText = "Health " + StringConverter::toString(mcpPlayer->mcpAttributes->ReturnHealth());
 	mcpPlayersHealthTextBox->SetText(sText);
 
 	// Create and display string showing how much time is remaining
@@ -2279,7 +3510,7 @@ void CGame::UpdateHUDs(float _fTimeRemaining)
 	mcpLevelTimeRemainingTextBox->SetText(sText);
 
 	// Display how many Points the Player has
-	sText = "Score " + StringConverter::toString(mcpPlayer->mcAttributes.ReturnNumberOfPoints());
+	sText = "Score " + StringConverter::toString(mcpPlayer->mcpAttributes->ReturnNumberOfPoints());
 	mcpPlayersPointsTextBox->SetText(sText);
 
 	// If enough time has passed since the Player caught a fish
@@ -2357,7 +3588,7 @@ void CGame::UpdateHUDs(float _fTimeRemaining)
 					sText += "Avoiding Player";
 				break;
 			}
-			sText += "  Health " + StringConverter::toString(mcpShark->mcAttributes.ReturnHealth());
+			sText += "  Health " + StringConverter::toString(mcpShark->mcpAttributes->ReturnHealth());
 
 			// Display number of Flocking and Non-Flocking Fish
 			sText += "\nFlocking Fish " + StringConverter::toString(miFlockingFishCount) + "  Non-Flocking Fish " + StringConverter::toString(miNonFlockingFishCount);
@@ -2430,8 +3661,12 @@ void CGame::UpdateDebugHUD()
 		cpGUIWorstFPS->setCaption(sWorstFPS + StringConverter::toString(cStats.worstFPS) + " " + StringConverter::toString(cStats.worstFrameTime) + "ms");
 		cpGUITriangleCount->setCaption(sTriangleCount + StringConverter::toString(cStats.triangleCount));
 
-		// Don't display the number of Batches or the Ogre Logo
-		cpGUINumberOfBatches->hide();
+		// Display how many Candidates the Neighbor queries are examining (used to tune the Spatial Grids Cell Size)
+		cpGUINumberOfBatches->setCaption("Neighbor Candidates: " + StringConverter::toString(mcSpatialGrid.ReturnAverageNumberOfCandidatesExamined(), 4) +
+			" avg over " + StringConverter::toString(mcSpatialGrid.ReturnNumberOfQueries()) + " queries");
+		mcSpatialGrid.ResetStatistics();
+
+		// Don't display the Ogre Logo
 		cpGUIOgreLogo->hide();
 	}
 	catch(...)
@@ -2704,13 +3939,21 @@ bool CGame::ReadInConfigurationFile(string _sFileName, bool _bOnlyGetGoalVariabl
 					cpObject = CreateItem(iSpecificObjectType);
 				}
 
-				// Position the Object
-				cpObject->mcpSceneNode->setPosition(sPosition);
+				// If the Object was created (it isn't if its Species is not defined)
+				if (cpObject != NULL)
+				{
+					// Position the Object
+					cpObject->SetPosition(sPosition);
+
+					// Orient the Object
+					cpObject->Pitch(Radian(Degree(sRotation.x)));
+					cpObject->Yaw(Radian(Degree(sRotation.y)));
+					cpObject->Roll(Radian(Degree(sRotation.z)));
 
-				// Orient the Object
-				cpObject->mcpSceneNode->pitch(Radian(Degree(sRotation.x)));
-				cpObject->mcpSceneNode->yaw(Radian(Degree(sRotation.y)));
-				cpObject->mcpSceneNode->roll(Radian(Degree(sRotation.z)));
+					// Move the Scene Node to where the Object was placed (without sliding there from where it was created)
+					cpObject->SavePreviousTransform();
+					cpObject->SyncSceneNodeWithTransform();
+				}
 			}
 			// If we are setting the Cameras Tightness
 			else if (sBuffer == "CameraTightness:")
@@ -2739,42 +3982,46 @@ bool CGame::ReadInConfigurationFile(string _sFileName, bool _bOnlyGetGoalVariabl
 				fInFile >> sBuffer;
 				iMode = atoi(sBuffer.c_str());
 
-				switch (iMode)
+				// If we are rendering (there are no Shadows when running Headless)
+				if (!mbHeadless)
 				{
-					default:
-					case 1:
-						// Use the fast but lower quality lighting mode
-						mcpSceneManager->setShadowTechnique(SHADOWTYPE_TEXTURE_MODULATIVE);
-					break;
-
-					case 2:
-						// Use the medium speed, medium quality lighting mode
-						mcpSceneManager->setShadowTechnique(SHADOWTYPE_STENCIL_MODULATIVE);
-					break;
-
-					case 3:
-						// Use the slow but good quality lighting mode
-						mcpSceneManager->setShadowTechnique(SHADOWTYPE_STENCIL_ADDITIVE);
-					break;
+					switch (iMode)
+					{
+						default:
+						case 1:
+							// Use the fast but lower quality lighting mode
+							mcpSceneManager->setShadowTechnique(SHADOWTYPE_TEXTURE_MODULATIVE);
+						break;
+
+						case 2:
+							// Use the medium speed, medium quality lighting mode
+							mcpSceneManager->setShadowTechnique(SHADOWTYPE_STENCIL_MODULATIVE);
+						break;
+
+						case 3:
+							// Use the slow but good quality lighting mode
+							mcpSceneManager->setShadowTechnique(SHADOWTYPE_STENCIL_ADDITIVE);
+						break;
+					}
 				}
 			}
 			// If we are setting the Players initial amount of Points
 			else if (sBuffer == "PlayerInitialPoints:")
 			{
 				fInFile >> sBuffer;
-				mcpPlayer->mcAttributes.SetHealth(atoi(sBuffer.c_str()));
+				mcpPlayer->mcpAttributes->SetHealth(atoi(sBuffer.c_str()));
 			}
 			// If we are setting how close the Player must be to a fish to catch it
 			else if (sBuffer == "PlayerCaptureFishRange:")
 			{
 				fInFile >> sBuffer;
-				mcpPlayer->mcAIHelper.SetAttackRange(atof(sBuffer.c_str()) * GiMETER);
+				mfPlayerCaptureFishRange = atof(sBuffer.c_str()) * GiMETER;
 			}
 			// If we are setting how close the Player must be to an Item to get it
 			else if (sBuffer == "PlayerGetItemRange:")
 			{
 				fInFile >> sBuffer;
-				mcpPlayer->mcAIHelper.SetFeedRange(atof(sBuffer.c_str()) * GiMETER);
+				mfPlayerGetItemRange = atof(sBuffer.c_str()) * GiMETER;
 			}
 			// If we are settings the Players max speed
 			else if (sBuffer == "PlayerMaxSpeed:")
@@ -2794,98 +4041,213 @@ bool CGame::ReadInConfigurationFile(string _sFileName, bool _bOnlyGetGoalVariabl
 				fInFile >> sBuffer;
 				miInitialNonFlockingFishCount = atoi(sBuffer.c_str());
 			}
+			// If we are setting how many Flocking Fish per second may spawn to replace the ones which were removed
+			else if (sBuffer == "FlockingFishSpawnRate:")
+			{
+				fInFile >> sBuffer;
+				mcPopulationController.SetSpawnRate(GiPOPULATION_FLOCKING_FISH, atof(sBuffer.c_str()));
+			}
+			// If we are setting how many Non-Flocking Fish per second may spawn to replace the ones which were removed
+			else if (sBuffer == "NonFlockingFishSpawnRate:")
+			{
+				fInFile >> sBuffer;
+				mcPopulationController.SetSpawnRate(GiPOPULATION_NON_FLOCKING_FISH, atof(sBuffer.c_str()));
+			}
+			// If we are setting the most Fish of each kind which may spawn in one update
+			else if (sBuffer == "MaxFishSpawnsPerStep:")
+			{
+				fInFile >> sBuffer;
+				mcPopulationController.SetMaxSpawnsPerStep(atoi(sBuffer.c_str()));
+			}
 			// If we are specifying whether to allow Flocking between different types of fish
 			else if (sBuffer == "AllowMixedFlocking:")
 			{
 				fInFile >> sBuffer;
 				mbAllowMixedFlocking = (sBuffer == "true") ? true : false;
 			}
+			// If we are specifying whether to use SSE to calculate the Flocking (false uses the scalar code, which gives the same results)
+			else if (sBuffer == "UseSIMDFlocking:")
+			{
+				fInFile >> sBuffer;
+				mcFlockingKernel.SetIfSIMDShouldBeUsed((sBuffer == "true") ? true : false);
+			}
+			// If we are specifying whether to use SSE to move the Objects (false uses the scalar code, which gives the same results)
+			else if (sBuffer == "UseSIMDIntegration:")
+			{
+				fInFile >> sBuffer;
+				mcKinematicIntegrator.SetIfSIMDShouldBeUsed((sBuffer == "true") ? true : false);
+			}
+			// If we are setting how many fixed Simulation Steps to run per second (0 steps by the frame time instead)
+			else if (sBuffer == "SimulationStepsPerSecond:")
+			{
+				fInFile >> sBuffer;
+				float fStepsPerSecond = atof(sBuffer.c_str());
+				mfSimulationTimeStep = (fStepsPerSecond > 0.0f) ? (1.0f / fStepsPerSecond) : 0.0f;
+			}
+			// If we are setting the most Simulation Steps that may be run in one frame
+			else if (sBuffer == "MaxSimulationStepsPerFrame:")
+			{
+				fInFile >> sBuffer;
+				miMaxSimulationStepsPerFrame = atoi(sBuffer.c_str());
+
+				// Make sure at least one Step is run each frame
+				if (miMaxSimulationStepsPerFrame < 1)
+				{
+					miMaxSimulationStepsPerFrame = 1;
+				}
+			}
+			// If we are setting how many Threads to run the AI on (0 uses one per processor)
+			else if (sBuffer == "AIThreads:")
+			{
+				fInFile >> sBuffer;
+				miNumberOfAIThreads = atoi(sBuffer.c_str());
+			}
+			// If we are setting how many microseconds of periodic AI Updates may be done each Step (0 for no limit)
+			else if (sBuffer == "AIUpdateBudget:")
+			{
+				fInFile >> sBuffer;
+				mcAIScheduler.SetBudget(atof(sBuffer.c_str()));
+			}
+			// If we are setting how close to the Player or Shark Flocking Fish must be to do their full AI every Step
+			else if (sBuffer == "AINearDistance:")
+			{
+				fInFile >> sBuffer;
+				mfAINearDistance = atof(sBuffer.c_str()) * GiMETER;
+			}
+			// If we are setting how far from the Player and Shark Flocking Fish must be to only wander around
+			else if (sBuffer == "AIFarDistance:")
+			{
+				fInFile >> sBuffer;
+				mfAIFarDistance = atof(sBuffer.c_str()) * GiMETER;
+			}
+			// If we are setting how many Steps apart the Flocking Fish in between do their full AI
+			else if (sBuffer == "AIMidUpdateInterval:")
+			{
+				fInFile >> sBuffer;
+				miAIMidUpdateInterval = atoi(sBuffer.c_str());
+
+				// Make sure the Fish do their AI at least once every Step
+				if (miAIMidUpdateInterval < 1)
+				{
+					miAIMidUpdateInterval = 1;
+				}
+			}
+			// If we are setting the size of the Spatial Grids Cells (0 uses the Fish Sense Neighbor Range)
+			else if (sBuffer == "SpatialGridCellSize:")
+			{
+				fInFile >> sBuffer;
+				mfSpatialGridCellSize = atof(sBuffer.c_str()) * GiMETER;
+			}
 			// If we are setting how old a fish must be to spawn
 			else if (sBuffer == "FishSpawnAge:")
 			{
 				fInFile >> sBuffer;
-				mcDefaultFlockingFish.mcAIHelper.SetSpawnAge(atof(sBuffer.c_str()));
+				msDefaultFishBrain.fSpawnAge = atof(sBuffer.c_str());
 			}
 			// If we are setting how far away a fish can detect the Shark from
 			else if (sBuffer == "FishSenseSharkRange:")
 			{
 				fInFile >> sBuffer;
-				mcDefaultFlockingFish.mcAIHelper.SetSenseSharkRange(atof(sBuffer.c_str()) * GiMETER);
+				msDefaultFishBrain.fSenseSharkRange = atof(sBuffer.c_str()) * GiMETER;
 			}
 			// If we are setting how far away a fish can detect the Player from
 			else if (sBuffer == "FishSenseSubmarineRange:")
 			{
 				fInFile >> sBuffer;
-				mcDefaultFlockingFish.mcAIHelper.SetSenseSubmarineRange(atof(sBuffer.c_str()) * GiMETER);
+				mcDefaultFlockingFishAIHelper.SetSenseSubmarineRange(atof(sBuffer.c_str()) * GiMETER);
 			}
 			// If we are setting how far away a fish can detect another fish from
 			else if (sBuffer == "FishSenseFishRange:")
 			{
 				fInFile >> sBuffer;
-				mcDefaultFlockingFish.mcAIHelper.SetSenseFishRange(atof(sBuffer.c_str()) * GiMETER);
+				mcDefaultFlockingFishAIHelper.SetSenseFishRange(atof(sBuffer.c_str()) * GiMETER);
 			}
 			// If we are setting the Max number of neighbors a fish can have
 			else if (sBuffer == "FishMaxNeighborCount:")
 			{
 				fInFile >> sBuffer;
-				mcDefaultFlockingFish.mcAIHelper.SetMaxNumberOfNeighbors(atoi(sBuffer.c_str()));
-				mcpShark->mcAIHelper.SetMaxNumberOfNeighbors(mcDefaultFlockingFish.mcAIHelper.GetMaxNumberOfNeighbors());
+				mcDefaultFlockingFishAIHelper.SetMaxNumberOfNeighbors(atoi(sBuffer.c_str()));
+				mcpShark->mcAIHelper.SetMaxNumberOfNeighbors(mcDefaultFlockingFishAIHelper.GetMaxNumberOfNeighbors());
 			}
 			// If we are setting the distance between fish for them to be considered neighbors
 			else if (sBuffer == "FishSenseNeighborRange:")
 			{
 				fInFile >> sBuffer;
-				mcDefaultFlockingFish.mcAIHelper.SetSenseNeighborRange(atof(sBuffer.c_str()) * GiMETER);
+				msDefaultFlocking.fSenseNeighborRange = atof(sBuffer.c_str()) * GiMETER;
+			}
+			// If we are setting how close far away Fish must be to be grouped into a School (0 turns Schools off)
+			else if (sBuffer == "FishSchoolRadius:")
+			{
+				fInFile >> sBuffer;
+				mfFishSchoolRadius = atof(sBuffer.c_str()) * GiMETER;
+			}
+			// If we are setting how far past their Sense Neighbor Range Fish find Neighbor Candidates
+			else if (sBuffer == "FishNeighborSkin:")
+			{
+				fInFile >> sBuffer;
+				mfNeighborSkinDistance = atof(sBuffer.c_str()) * GiMETER;
 			}
 			else if (sBuffer == "FishSeparationStrength:")
 			{
 				fInFile >> sBuffer;
-				mcDefaultFlockingFish.mcAIHelper.SetSeparationCoefficient(atof(sBuffer.c_str()));
+				msDefaultFlocking.fSeparationCoefficient = atof(sBuffer.c_str());
 			}
 			else if (sBuffer == "FishAlignmentStrength:")
 			{
 				fInFile >> sBuffer;
-				mcDefaultFlockingFish.mcAIHelper.SetAlignmentCoefficient(atof(sBuffer.c_str()));
+				msDefaultFlocking.fAlignmentCoefficient = atof(sBuffer.c_str());
 			}
 			else if (sBuffer == "FishCohesionStrength:")
 			{
 				fInFile >> sBuffer;
-				mcDefaultFlockingFish.mcAIHelper.SetCohesionCoefficient(atof(sBuffer.c_str()));
+				msDefaultFlocking.fCohesionCoefficient = atof(sBuffer.c_str());
 			}
 			else if (sBuffer == "FishPreditorAvoidanceStrength:")
 			{
 				fInFile >> sBuffer;
-				mcDefaultFlockingFish.mcAIHelper.SetPreditorAvoidanceCoefficient(atof(sBuffer.c_str()));
+				msDefaultFlocking.fPreditorAvoidanceCoefficient = atof(sBuffer.c_str());
+			}
+			// If we are setting how many Sharks are in the Level
+			else if (sBuffer == "NumberOfSharks:")
+			{
+				fInFile >> sBuffer;
+				miNumberOfSharks = atoi(sBuffer.c_str());
+
+				// Make sure there is at least one Shark (the Shark Camera and HUD follow the first one)
+				if (miNumberOfSharks < 1)
+				{
+					miNumberOfSharks = 1;
+				}
 			}
 			else if (sBuffer == "SharkInitialPoints:")
 			{
 				fInFile >> sBuffer;
-				mcpShark->mcAttributes.SetHealth(atoi(sBuffer.c_str()));
+				mcpShark->mcpAttributes->SetHealth(atoi(sBuffer.c_str()));
 			}
 			else if (sBuffer == "SharkMinimumPoints:")
 			{
 				fInFile >> sBuffer;
-				mcpShark->mcAttributes.SetMinHealth(atoi(sBuffer.c_str()));
+				mcpShark->mcpAttributes->SetMinHealth(atoi(sBuffer.c_str()));
 			}
 			else if (sBuffer == "SharkFeedPoints:")
 			{
 				fInFile >> sBuffer;
-				mcDefaultFlockingFish.mcAttributes.SetHealth(atoi(sBuffer.c_str()));
+				mcDefaultFlockingFishAttributes.SetHealth(atoi(sBuffer.c_str()));
 			}
 			else if (sBuffer == "SharkNourishedPoints:")
 			{
 				fInFile >> sBuffer;
-				mcpShark->mcAIHelper.SetNourishedHealth(atoi(sBuffer.c_str()));
+				mcpShark->mspSharkBrain->iNourishedHealth = atoi(sBuffer.c_str());
 			}
 			else if (sBuffer == "SharkFullBellyPoints:")
 			{
 				fInFile >> sBuffer;
-				mcpShark->mcAIHelper.SetFullHealth(atoi(sBuffer.c_str()));
+				mcpShark->mspSharkBrain->iFullHealth = atoi(sBuffer.c_str());
 			}
 			else if (sBuffer == "SharkHealthDegradeDelay:")
 			{
 				fInFile >> sBuffer;
-				mcpShark->mcAIHelper.SetHealthDegradeDelay((unsigned long)(atof(sBuffer.c_str())* 1000.0f));
+				mcpShark->mspSharkBrain->ulHealthDegradeDelay = (unsigned long)(atof(sBuffer.c_str())* 1000.0f);
 			} 
 			else if (sBuffer == "SharkSenseFishRange:")
 			{
@@ -2900,22 +4262,22 @@ bool CGame::ReadInConfigurationFile(string _sFileName, bool _bOnlyGetGoalVariabl
 			else if (sBuffer == "SharkFeedRange:")
 			{
 				fInFile >> sBuffer;
-				mcpShark->mcAIHelper.SetFeedRange(atof(sBuffer.c_str()) * GiMETER);
+				mcpShark->mspSharkBrain->fFeedRange = atof(sBuffer.c_str()) * GiMETER;
 			}
 			else if (sBuffer == "SharkAttackRange:")
 			{
 				fInFile >> sBuffer;
-				mcpShark->mcAIHelper.SetAttackRange(atof(sBuffer.c_str()) * GiMETER);
+				mcpShark->mspSharkBrain->fAttackRange = atof(sBuffer.c_str()) * GiMETER;
 			}
 			else if (sBuffer == "SharkVelocityFraction:")
 			{
 				fInFile >> sBuffer;
-				mcpShark->mcAIHelper.SetVelocityCoefficient(atof(sBuffer.c_str()));
+				mcpShark->mspSharkBrain->fVelocityCoefficient = atof(sBuffer.c_str());
 			}
 			else if (sBuffer == "SharkHitDelay:")
 			{
 				fInFile >> sBuffer;
-				mcpShark->mcAIHelper.SetHitDelay((unsigned long)(atof(sBuffer.c_str()) * 1000.0f));
+				mcpShark->mspSharkBrain->ulHitDelay = (unsigned long)(atof(sBuffer.c_str()) * 1000.0f);
 			}
 			// Else this is an unrecognized command
 			else
@@ -2935,428 +4297,109 @@ bool CGame::ReadInConfigurationFile(string _sFileName, bool _bOnlyGetGoalVariabl
 	return true;
 }
 
-// Creates an Object of the specified type
-void CGame::CreateObject(CObject& _cObject)
+// Creates an Object of the specified type, using the values of its Species
+// NOTE: The Object must be in the Object Pool, since its Components are kept there
+bool CGame::CreateObject(CObject& _cObject)
 {
 	Vector3 sEnemyPosition = Vector3::ZERO;			// Used to hold the Enemy's initial position
 	float fEnemyLengthInMeters = 0.0f;				// How big the Enemy's Length should be in Meters
-	Vector3 sEnemySize = Vector3::ZERO;				// Holds the Enemy Meshes size
-	float fEnemySizeToMeterRatio = 0.0f;			// Holds the Enemy Mesh to Meter size ratio 
 	Vector3 sEnemyDimensionsScale = Vector3::ZERO;	// How much to Scale the Enemies Dimensions
 	ColourValue sEnemyColor;						// Holds the Enemies colour
-	bool bUseRandomColoredMaterial = false;			// Holds if the custom material should be applied to the Enemy or not
-	String sEnemyMesh;								// Holds the name of the Mesh the Object should use
 	float fEnemySpeed = 0.0f;						// Holds how fast the Enemy should move
 	float fEnemyRotationSpeed = 0.0f;				// Holds how fast the Enemy should rotate
-	bool bRandomlyOrientObject = true;				// Holds whether to randomly orient the Object or not
-	bool bUseAutoTracking = true;					// Holds whether to use Auto Tracking or not
+	SFishScene sSpareFishScene;						// Holds the spare Scene Node and Entity the Object uses (if it is a Fish)
+	bool bUseSpareFishScene = false;				// Holds whether the Object uses a spare Scene Node and Entity or not
 
-	// Create the Object Scene Node
-	_cObject.mcpSceneNode = mcpSceneManager->getRootSceneNode()->createChildSceneNode(_cObject.GetName() + "SceneNode");
+	// Get the Species of the Object
+	int iSpecies = _cObject.GetSpecificObjectType();
+	SSpecies const& sSpecies = mcSpeciesList.ReturnSpecies(iSpecies);
 
-	// Create an Object of the specified type
-	bUseRandomColoredMaterial = false;
-	switch(_cObject.GetSpecificObjectType())
+	// If the Object has no Species (or we are rendering and its Species has no Mesh), refuse to create it
+	// NOTE: This is checked before anything is created, so there is nothing to clean up
+	if (!mcSpeciesList.ReturnIfSpeciesIsDefined(iSpecies) || (!mbHeadless && sSpecies.sMesh.empty()))
 	{
-		case GiOBJECT_SPECIFIC_TYPE_SHARK:
-			// Specify the Enemy Mesh to use
-			sEnemyMesh = "Shark.mesh";
-
-			// Specify Enemy's Size (Length) in Meters
-			fEnemyLengthInMeters = 6.0;
-
-			// Randomly pick an amount to scale the Enemies Dimensions by
-			sEnemyDimensionsScale.x = 1.0;
-			sEnemyDimensionsScale.y = 1.0;
-			sEnemyDimensionsScale.z = 1.0;
-			
-			// Specify Enemies Speed (Sharks speed is manipulated by how much Health it has)
-			fEnemySpeed = ((mfLevelFriction / GiMETER) + 10.0) * GiMETER;
-			_cObject.SetDefaultAccelerationRate(fEnemySpeed);
-			_cObject.SetMaxVelocitySpeed(fEnemySpeed);
-			_cObject.SetMinVelocitySpeed(0.0);
-
-			// Specify Enemies Rotation Speed
-			fEnemyRotationSpeed = Math::RangeRandom(70.0, 130.0);
-			_cObject.SetDefaultRotationVelocitySpeed(fEnemyRotationSpeed);
-			_cObject.SetMaxRotationVelocitySpeed(fEnemyRotationSpeed);
-			_cObject.SetMinRotationVelocitySpeed(0.0);
-			_cObject.SetRotationVelocity(Vector3::UNIT_X, fEnemyRotationSpeed);
-
-			// Specify which directions the Enemy mesh faces by default
-			_cObject.SetMeshesDefaultForwardDirection(Vector3::UNIT_Z);
-			_cObject.SetMeshesDefaultUpDirection(Vector3::UNIT_Y);
-			_cObject.SetMeshesDefaultRightDirection(Vector3::UNIT_X);
-
-			// Specify how many Points this Enemy is worth
-			_cObject.mcAttributes.SetNumberOfPoints(0);
-		break;
-
-		default:
-		case GiOBJECT_SPECIFIC_TYPE_DANS_FISH:
-			// Specify the Enemy Mesh to use
-			sEnemyMesh = "DansFish.mesh";
-			bUseRandomColoredMaterial = true;
-
-			// Specify Enemy's Size (Length) in Meters
-			fEnemyLengthInMeters = 1.5;
-
-			// Randomly pick an amount to scale the Enemies Dimensions by
-			sEnemyDimensionsScale.x = Math::RangeRandom(0.75, 1.25);
-			sEnemyDimensionsScale.y = Math::RangeRandom(0.75, 1.25);
-			sEnemyDimensionsScale.z = Math::RangeRandom(0.75, 1.25);
-
-			// Specify Enemies Speed
-			fEnemySpeed = Math::RangeRandom((mfLevelFriction / GiMETER) + 0.5, (mfLevelFriction / GiMETER) + 2.0) * GiMETER;
-			_cObject.SetDefaultAccelerationRate(fEnemySpeed);
-			_cObject.SetMaxVelocitySpeed(fEnemySpeed);
-			_cObject.SetMinVelocitySpeed(0.0);
-
-			// Specify Enemies Rotation Speed
-			fEnemyRotationSpeed = Math::RangeRandom(30.0, 180.0);
-			_cObject.SetDefaultRotationVelocitySpeed(fEnemyRotationSpeed);
-			_cObject.SetMaxRotationVelocitySpeed(fEnemyRotationSpeed);
-			_cObject.SetMinRotationVelocitySpeed(0.0);
-			_cObject.SetRotationVelocity(Vector3::UNIT_X, fEnemyRotationSpeed);
-
-			// Specify which directions the Enemy mesh faces by default
-			_cObject.SetMeshesDefaultForwardDirection(Vector3::UNIT_Z);
-			_cObject.SetMeshesDefaultUpDirection(Vector3::UNIT_Y);
-			_cObject.SetMeshesDefaultRightDirection(Vector3::UNIT_X);
-
-			// Specify how many Points this Enemy is worth
-			_cObject.mcAttributes.SetNumberOfPoints(200);
-		break;
-
-		case GiOBJECT_SPECIFIC_TYPE_DANS_OCTOPUS:
-			// Specify the Enemy Mesh to use
-			sEnemyMesh = "DansOctopus.mesh";
-			bUseRandomColoredMaterial = true;
-
-			// Specify Enemy's Size (Length) in Meters
-			fEnemyLengthInMeters = 2.5;
-
-			// Randomly pick an amount to scale the Enemies Dimensions by
-			sEnemyDimensionsScale.x = Math::RangeRandom(0.75, 1.25);
-			sEnemyDimensionsScale.y = Math::RangeRandom(0.75, 1.25);
-			sEnemyDimensionsScale.z = Math::RangeRandom(0.75, 1.25);
-
-			// Specify Enemies Speed
-			fEnemySpeed = Math::RangeRandom((mfLevelFriction / GiMETER) + 4.0, (mfLevelFriction / GiMETER) + 6.0) * GiMETER;
-			_cObject.SetDefaultAccelerationRate(fEnemySpeed);
-			_cObject.SetMaxVelocitySpeed(fEnemySpeed);
-			_cObject.SetMinVelocitySpeed(0.0);
-
-			// Specify Enemies Rotation Speed
-			fEnemyRotationSpeed = Math::RangeRandom(30.0, 180.0);
-			_cObject.SetDefaultRotationVelocitySpeed(fEnemyRotationSpeed);
-			_cObject.SetMaxRotationVelocitySpeed(fEnemyRotationSpeed);
-			_cObject.SetMinRotationVelocitySpeed(0.0);
-			_cObject.SetRotationVelocity(Vector3::UNIT_X, fEnemyRotationSpeed);
-
-			// Specify which directions the Enemy mesh faces by default
-			_cObject.SetMeshesDefaultForwardDirection(Vector3::UNIT_Z);
-			_cObject.SetMeshesDefaultUpDirection(Vector3::UNIT_Y);
-			_cObject.SetMeshesDefaultRightDirection(Vector3::UNIT_X);
-
-			// Specify how many Points this Enemy is worth
-			_cObject.mcAttributes.SetNumberOfPoints(450);
-		break;
-
-		case GiOBJECT_SPECIFIC_TYPE_BLUE_TANGO_FISH:
-			// Specify the Enemy Mesh to use
-			sEnemyMesh = "BlueTangoFish.mesh";
-			bUseRandomColoredMaterial = true;
-
-			// Specify Enemy's Size (Length) in Meters
-			fEnemyLengthInMeters = 1.7;
-
-			// Randomly pick an amount to scale the Enemies Dimensions by
-			sEnemyDimensionsScale.x = Math::RangeRandom(0.75, 1.25);
-			sEnemyDimensionsScale.y = Math::RangeRandom(0.75, 1.25);
-			sEnemyDimensionsScale.z = Math::RangeRandom(0.75, 1.25);
-
-			// Specify Enemies Speed
-			fEnemySpeed = Math::RangeRandom((mfLevelFriction / GiMETER) + 2.5, (mfLevelFriction / GiMETER) + 3.0) * GiMETER;
-			_cObject.SetDefaultAccelerationRate(fEnemySpeed);
-			_cObject.SetMaxVelocitySpeed(fEnemySpeed);
-			_cObject.SetMinVelocitySpeed(0.0);
-
-			// Specify Enemies Rotation Speed
-			fEnemyRotationSpeed = Math::RangeRandom(30.0, 100.0);
-			_cObject.SetDefaultRotationVelocitySpeed(fEnemyRotationSpeed);
-			_cObject.SetMaxRotationVelocitySpeed(fEnemyRotationSpeed);
-			_cObject.SetMinRotationVelocitySpeed(0.0);
-			_cObject.SetRotationVelocity(Vector3::UNIT_X, fEnemyRotationSpeed);
-
-			// Specify which direction the Enemy mesh faces by default
-			_cObject.SetMeshesDefaultForwardDirection(Vector3::NEGATIVE_UNIT_X);
-			_cObject.SetMeshesDefaultUpDirection(Vector3::UNIT_Y);
-			_cObject.SetMeshesDefaultRightDirection(Vector3::NEGATIVE_UNIT_Z);
-
-			// Specify how many Points this Enemy is worth
-			_cObject.mcAttributes.SetNumberOfPoints(350);
-		break;
-
-		case GiOBJECT_SPECIFIC_TYPE_TURTLE:
-			// Specify the Enemy Mesh to use
-			sEnemyMesh = "Turtle.mesh";
-
-			// Specify Enemy's Size (Length) in Meters
-			fEnemyLengthInMeters = 3.0;
-
-			// Randomly pick an amount to scale the Enemies Dimensions by
-			sEnemyDimensionsScale.x = Math::RangeRandom(0.75, 1.25);
-			sEnemyDimensionsScale.y = Math::RangeRandom(0.75, 1.25);
-			sEnemyDimensionsScale.z = Math::RangeRandom(0.75, 1.25);
-			
-			// Specify Enemies Speed
-			fEnemySpeed = Math::RangeRandom((mfLevelFriction / GiMETER) + 0.25, (mfLevelFriction / GiMETER) + 1.0) * GiMETER;
-			_cObject.SetDefaultAccelerationRate(fEnemySpeed);
-			_cObject.SetMaxVelocitySpeed(fEnemySpeed);
-			_cObject.SetMinVelocitySpeed(0.0);
-
-			// Specify Enemies Rotation Speed
-			fEnemyRotationSpeed = Math::RangeRandom(30.0, 60.0);
-			_cObject.SetDefaultRotationVelocitySpeed(fEnemyRotationSpeed);
-			_cObject.SetMaxRotationVelocitySpeed(fEnemyRotationSpeed);
-			_cObject.SetMinRotationVelocitySpeed(0.0);
-			_cObject.SetRotationVelocity(Vector3::UNIT_X, fEnemyRotationSpeed);
-
-			// Specify which directions the Enemy mesh faces by default
-			_cObject.SetMeshesDefaultForwardDirection(Vector3::UNIT_Z);
-			_cObject.SetMeshesDefaultUpDirection(Vector3::UNIT_Y);
-			_cObject.SetMeshesDefaultRightDirection(Vector3::UNIT_X);
-
-			// Specify how many Points this Enemy is worth
-			_cObject.mcAttributes.SetNumberOfPoints(125);
-		break;
-
-		case GiOBJECT_SPECIFIC_TYPE_BLUE_FISH:
-			// Specify the Enemy Mesh to use
-			sEnemyMesh = "BlueFish.mesh";
-
-			// Specify Enemy's Size (Length) in Meters
-			fEnemyLengthInMeters = 1.2;
-
-			// Randomly pick an amount to scale the Enemies Dimensions by
-			sEnemyDimensionsScale.x = Math::RangeRandom(0.75, 1.25);
-			sEnemyDimensionsScale.y = Math::RangeRandom(0.75, 1.25);
-			sEnemyDimensionsScale.z = Math::RangeRandom(0.75, 1.25);
-			
-			// Specify Enemies Speed
-			fEnemySpeed = Math::RangeRandom((mfLevelFriction / GiMETER) + 4.0, (mfLevelFriction / GiMETER) + 5.0) * GiMETER;
-			_cObject.SetDefaultAccelerationRate(fEnemySpeed);
-			_cObject.SetMaxVelocitySpeed(fEnemySpeed);
-			_cObject.SetMinVelocitySpeed(0.0);
-
-			// Specify Enemies Rotation Speed
-			fEnemyRotationSpeed = Math::RangeRandom(80.0, 180.0);
-			_cObject.SetDefaultRotationVelocitySpeed(fEnemyRotationSpeed);
-			_cObject.SetMaxRotationVelocitySpeed(fEnemyRotationSpeed);
-			_cObject.SetMinRotationVelocitySpeed(0.0);
-			_cObject.SetRotationVelocity(Vector3::UNIT_X, fEnemyRotationSpeed);
-
-			// Specify which direction the Enemy mesh faces by default
-			_cObject.SetMeshesDefaultForwardDirection(Vector3::NEGATIVE_UNIT_X);
-			_cObject.SetMeshesDefaultUpDirection(Vector3::UNIT_Y);
-			_cObject.SetMeshesDefaultRightDirection(Vector3::NEGATIVE_UNIT_Z);
-
-			// Specify how many Points this Enemy is worth
-			_cObject.mcAttributes.SetNumberOfPoints(500);
-		break;
-
-		case GiOBJECT_SPECIFIC_TYPE_KILLER_WHALE:
-			// Specify the Enemy Mesh to use
-			sEnemyMesh = "KillerWhale.mesh";
-
-			// Orient the Enemy properly
-			_cObject.mcpSceneNode->pitch(Degree(-90));
-
-			// Specify Enemy's Size (Length) in Meters
-			fEnemyLengthInMeters = 7.0;
-
-			// Randomly pick an amount to scale the Enemies Dimensions by
-			sEnemyDimensionsScale.x = Math::RangeRandom(0.75, 1.25);
-			sEnemyDimensionsScale.y = Math::RangeRandom(0.75, 1.25);
-			sEnemyDimensionsScale.z = Math::RangeRandom(0.75, 1.25);
-		
-			// Specify Enemies Speed
-			fEnemySpeed = Math::RangeRandom((mfLevelFriction / GiMETER) + 5.0, (mfLevelFriction / GiMETER) + 8.0) * GiMETER;
-			_cObject.SetDefaultAccelerationRate(fEnemySpeed);
-			_cObject.SetMaxVelocitySpeed(fEnemySpeed);
-			_cObject.SetMinVelocitySpeed(0.0);
-
-			// Specify Enemies Rotation Speed
-			fEnemyRotationSpeed = Math::RangeRandom(70.0, 110.0);
-			_cObject.SetDefaultRotationVelocitySpeed(fEnemyRotationSpeed);
-			_cObject.SetMaxRotationVelocitySpeed(fEnemyRotationSpeed);
-			_cObject.SetMinRotationVelocitySpeed(0.0);
-			_cObject.SetRotationVelocity(Vector3::UNIT_X, fEnemyRotationSpeed);
-
-			// Specify which direction the Enemy mesh faces by default
-			_cObject.SetMeshesDefaultForwardDirection(Vector3::NEGATIVE_UNIT_X);
-			_cObject.SetMeshesDefaultUpDirection(Vector3::UNIT_Y);
-			_cObject.SetMeshesDefaultRightDirection(Vector3::NEGATIVE_UNIT_Z);
-
-			// Specify how many Points this Enemy is worth
-			_cObject.mcAttributes.SetNumberOfPoints(700);
-		break;
-
-		case GiOBJECT_SPECIFIC_TYPE_GOLDEN_FISH:
-			// Specify the Enemy Mesh to use
-			sEnemyMesh = "GoldenFish.mesh";
-
-			// Specify Enemy's Size (Length) in Meters
-			fEnemyLengthInMeters = 1.7;
-
-			// Randomly pick an amount to scale the Enemies Dimensions by
-			sEnemyDimensionsScale.x = Math::RangeRandom(1.0, 3.0);
-			sEnemyDimensionsScale.y = Math::RangeRandom(0.75, 1.25);
-			sEnemyDimensionsScale.z = Math::RangeRandom(0.75, 1.25);
-			
-			// Specify Enemies Speed
-			fEnemySpeed = Math::RangeRandom((mfLevelFriction / GiMETER) + 7.0, (mfLevelFriction / GiMETER) + 9.0) * GiMETER;
-			_cObject.SetDefaultAccelerationRate(fEnemySpeed);
-			_cObject.SetMaxVelocitySpeed(fEnemySpeed);
-			_cObject.SetMinVelocitySpeed(0.0);
-
-			// Specify Enemies Rotation Speed
-			fEnemyRotationSpeed = Math::RangeRandom(90.0, 120.0);
-			_cObject.SetDefaultRotationVelocitySpeed(fEnemyRotationSpeed);
-			_cObject.SetMaxRotationVelocitySpeed(fEnemyRotationSpeed);
-			_cObject.SetMinRotationVelocitySpeed(0.0);
-			_cObject.SetRotationVelocity(Vector3::UNIT_X, fEnemyRotationSpeed);
-
-			// Specify which directions the Enemy mesh faces by default
-			_cObject.SetMeshesDefaultForwardDirection(Vector3::UNIT_Z);
-			_cObject.SetMeshesDefaultUpDirection(Vector3::UNIT_Y);
-			_cObject.SetMeshesDefaultRightDirection(Vector3::UNIT_X);
-
-			// Specify how many Points this Enemy is worth
-			_cObject.mcAttributes.SetNumberOfPoints(1000);
-		break;
-
-		case GiOBJECT_SPECIFIC_TYPE_PAREXO_FISH:
-			// Specify the Enemy Mesh to use
-			sEnemyMesh = "ParexoFish.mesh";
-
-			// Specify Enemy's Size (Length) in Meters
-			fEnemyLengthInMeters = 2.0;
-
-			// Randomly pick an amount to scale the Enemies Dimensions by
-			sEnemyDimensionsScale.x = Math::RangeRandom(0.75, 1.25);
-			sEnemyDimensionsScale.y = Math::RangeRandom(0.75, 1.25);
-			sEnemyDimensionsScale.z = Math::RangeRandom(0.75, 1.25);
-			
-			// Specify Enemies Speed
-			fEnemySpeed = Math::RangeRandom((mfLevelFriction / GiMETER) + 2.0, (mfLevelFriction / GiMETER) + 4.0) * GiMETER;
-			_cObject.SetDefaultAccelerationRate(fEnemySpeed);
-			_cObject.SetMaxVelocitySpeed(fEnemySpeed);
-			_cObject.SetMinVelocitySpeed(0.0);
-
-			// Specify Enemies Rotation Speed
-			fEnemyRotationSpeed = Math::RangeRandom(150.0, 270.0);
-			_cObject.SetDefaultRotationVelocitySpeed(fEnemyRotationSpeed);
-			_cObject.SetMaxRotationVelocitySpeed(fEnemyRotationSpeed);
-			_cObject.SetMinRotationVelocitySpeed(0.0);
-			_cObject.SetRotationVelocity(Vector3::UNIT_X, fEnemyRotationSpeed);
-
-			// Specify which direction the Enemy mesh faces by default
-			_cObject.SetMeshesDefaultForwardDirection(Vector3::NEGATIVE_UNIT_X);
-			_cObject.SetMeshesDefaultUpDirection(Vector3::UNIT_Y);
-			_cObject.SetMeshesDefaultRightDirection(Vector3::NEGATIVE_UNIT_Z);
-
-			// Specify how many Points this Enemy is worth
-			_cObject.mcAttributes.SetNumberOfPoints(375);
-		break;
-
-		case GiOBJECT_SPECIFIC_TYPE_RING:
-			// Specify the Enemy Mesh to use
-			sEnemyMesh = "Ring.mesh";
-			bUseRandomColoredMaterial = true;
-
-			// Specify Objects Size (Length) in Meters
-			fEnemyLengthInMeters = 6.0;
-
-			// Randomly pick an amount to scale the Enemies Dimensions by
-			sEnemyDimensionsScale.x = 1.0;
-			sEnemyDimensionsScale.y = 1.0;
-			sEnemyDimensionsScale.z = 1.0;
-
-			// Specify Enemies Speed
-			_cObject.SetDefaultAccelerationRate(0.0);
-			_cObject.SetMaxVelocitySpeed(0.0);
-			_cObject.SetMinVelocitySpeed(0.0);
+		WriteToLogFile("ERROR: Could not create " + _cObject.GetName() + ", Species " + StringConverter::toString(iSpecies) + " is not defined (or has no Mesh) in the Species File");
+		return false;
+	}
 
-			// Specify Enemies Rotation Speed
-			_cObject.SetDefaultRotationVelocitySpeed(0.0);
-			_cObject.SetMaxRotationVelocitySpeed(0.0);
-			_cObject.SetMinRotationVelocitySpeed(0.0);
+	// If this is a Fish and there is a spare Scene Node and Entity for its type
+	int iSpecificType = _cObject.GetSpecificObjectType();
+	if (iSpecificType >= GiOBJECT_SPECIFIC_TYPE_FISH_INDEX_START && iSpecificType <= GiOBJECT_SPECIFIC_TYPE_FISH_INDEX_END &&
+		!mcaSpareFishSceneList[iSpecificType].empty())
+	{
+		// Take the spare out of the list
+		sSpareFishScene = mcaSpareFishSceneList[iSpecificType].back();
+		mcaSpareFishSceneList[iSpecificType].pop_back();
+		bUseSpareFishScene = true;
+
+		// Put the spare Scene Node back in the scene, undoing the last Fish's scaling and showing it again
+		_cObject.mcpSceneNode = sSpareFishScene.cpSceneNode;
+		mcpSceneManager->getRootSceneNode()->addChild(_cObject.mcpSceneNode);
+		_cObject.mcpSceneNode->setScale(Vector3::UNIT_SCALE);
+		_cObject.mcpSceneNode->setVisible(true);
+		_cObject.mcpEntity = sSpareFishScene.cpEntity;
+	}
+	// Else create the Object Scene Node
+	else
+	{
+		_cObject.mcpSceneNode = mcpSceneManager->getRootSceneNode()->createChildSceneNode(_cObject.GetName() + "SceneNode");
+	}
 
-			// Do not randomly orient this Object, and do not use Auto Tracking
-			bRandomlyOrientObject = false;
-			bUseAutoTracking = false;
+	// If the Mesh needs to be turned when it is created (i.e. it was modelled on its side)
+	if (sSpecies.fInitialPitch != 0.0f)
+	{
+		_cObject.Pitch(Degree(sSpecies.fInitialPitch));
+	}
 
-			// Specify which directions the Enemy mesh faces by default
-			_cObject.SetMeshesDefaultForwardDirection(Vector3::UNIT_Z);
-			_cObject.SetMeshesDefaultUpDirection(Vector3::UNIT_Y);
-			_cObject.SetMeshesDefaultRightDirection(Vector3::UNIT_X);
+	// Randomly pick an amount to scale the Objects Dimensions by
+	sEnemyDimensionsScale.x = Math::RangeRandom(sSpecies.sMinDimensionsScale.x, sSpecies.sMaxDimensionsScale.x);
+	sEnemyDimensionsScale.y = Math::RangeRandom(sSpecies.sMinDimensionsScale.y, sSpecies.sMaxDimensionsScale.y);
+	sEnemyDimensionsScale.z = Math::RangeRandom(sSpecies.sMinDimensionsScale.z, sSpecies.sMaxDimensionsScale.z);
 
-			// Specify how many Points this Enemy is worth
-			_cObject.mcAttributes.SetNumberOfPoints(100);
-		break;
+	// Specify the Objects Speed, which is how much faster than the Level Friction it can move (Objects which don't move have no Speed)
+	if (sSpecies.bMoves)
+	{
+		fEnemySpeed = Math::RangeRandom((mfLevelFriction / GiMETER) + sSpecies.fMinSpeedAboveFriction, (mfLevelFriction / GiMETER) + sSpecies.fMaxSpeedAboveFriction) * GiMETER;
+	}
+	_cObject.SetDefaultAccelerationRate(fEnemySpeed);
+	_cObject.SetMaxVelocitySpeed(fEnemySpeed);
+	_cObject.SetMinVelocitySpeed(0.0);
+
+	// Specify the Objects Rotation Speed
+	fEnemyRotationSpeed = Math::RangeRandom(sSpecies.fMinRotationSpeed, sSpecies.fMaxRotationSpeed);
+	_cObject.SetDefaultRotationVelocitySpeed(fEnemyRotationSpeed);
+	_cObject.SetMaxRotationVelocitySpeed(fEnemyRotationSpeed);
+	_cObject.SetMinRotationVelocitySpeed(0.0);
+
+	// If the Object should start off rotating
+	if (sSpecies.sRotationAxis != Vector3::ZERO)
+	{
+		_cObject.SetRotationVelocity(sSpecies.sRotationAxis, fEnemyRotationSpeed);
+	}
 
-		case GiOBJECT_SPECIFIC_TYPE_DIAMOND:
-			// Specify the Enemy Mesh to use
-			sEnemyMesh = "Diamond.mesh";
-			bUseRandomColoredMaterial = true;
+	// Specify which directions the Objects mesh faces by default
+	_cObject.SetMeshesDefaultForwardDirection(sSpecies.sForwardDirection);
+	_cObject.SetMeshesDefaultUpDirection(sSpecies.sUpDirection);
+	_cObject.SetMeshesDefaultRightDirection(sSpecies.sRightDirection);
 
-			// Specify Enemy's Size (Length) in Meters
-			fEnemyLengthInMeters = 3.0;
+	// Specify how many Points this Object is worth (giving it Attributes if it doesn't have them yet)
+	mcObjectPool.AddComponent(_cObject.msHandle, GiCOMPONENT_ATTRIBUTES);
+	_cObject.mcpAttributes->SetNumberOfPoints(sSpecies.iNumberOfPoints);
 
-			// Randomly pick an amount to scale the Enemies Dimensions by
-			sEnemyDimensionsScale.x = 1.0;
-			sEnemyDimensionsScale.y = 1.0;
-			sEnemyDimensionsScale.z = 1.0;
-			
-			// Specify Enemies Speed
-			_cObject.SetDefaultAccelerationRate(0.0);
-			_cObject.SetMaxVelocitySpeed(0.0);
-			_cObject.SetMinVelocitySpeed(0.0);
-
-			// Specify Enemies Rotation Speed
-			fEnemyRotationSpeed = Math::RangeRandom(45.0, 90.0);
-			_cObject.SetDefaultRotationVelocitySpeed(fEnemyRotationSpeed);
-			_cObject.SetMaxRotationVelocitySpeed(fEnemyRotationSpeed);
-			_cObject.SetMinRotationVelocitySpeed(0.0);
-			_cObject.SetRotationVelocity(Vector3::UNIT_Y, fEnemyRotationSpeed);
-
-			// Do not randomly orient this Object, and do not use Auto Tracking
-			bRandomlyOrientObject = false;
-			bUseAutoTracking = false;
-
-			// Specify which directions the Enemy mesh faces by default
-			_cObject.SetMeshesDefaultForwardDirection(Vector3::UNIT_Z);
-			_cObject.SetMeshesDefaultUpDirection(Vector3::UNIT_Y);
-			_cObject.SetMeshesDefaultRightDirection(Vector3::UNIT_X);
-
-			// Specify how many Points this Enemy is worth
-			_cObject.mcAttributes.SetNumberOfPoints(50);
-		break;
+	// If we are rendering, create the Object Entity and attach it to the Scene Node (a spare Scene Node already has one)
+	if (!mbHeadless && !bUseSpareFishScene)
+	{
+		_cObject.mcpEntity = mcpSceneManager->createEntity(_cObject.GetName() + "Entity", sSpecies.sMesh);
+		_cObject.mcpSceneNode->attachObject(_cObject.mcpEntity);
+		_cObject.mcpEntity->setCastShadows(true);
 	}
 
-	// Create the Object Entity and attach it to the Scene Node
-	_cObject.mcpEntity = mcpSceneManager->createEntity(_cObject.GetName() + "Entity", sEnemyMesh);
-	_cObject.mcpSceneNode->attachObject(_cObject.mcpEntity);
-	_cObject.mcpEntity->setCastShadows(true);
-
 	// Start moving the Object
 	_cObject.SetAcceleration(_cObject.GetMeshesDefaultForwardDirection() * _cObject.GetDefaultAccelerationRate());
 	_cObject.SetVelocitySpeed(_cObject.GetMaxVelocitySpeed());
 
-	// If this Object should use the Custom Material
-	if (bUseRandomColoredMaterial)
+	// If this Object should use the Custom Material (a spare Entity keeps the one it already has)
+	if (sSpecies.bUseRandomColoredMaterial && _cObject.mcpEntity != NULL && !bUseSpareFishScene)
 	{
 		// Randomly calculate the Objects colour
 		sEnemyColor = ColourValue(Math::RangeRandom(0, 1), Math::RangeRandom(0, 1), 0);
@@ -3378,38 +4421,66 @@ void CGame::CreateObject(CObject& _cObject)
 	sEnemyPosition.z = Math::RangeRandom(GiLEVEL_BACK + GiMETER, GiLEVEL_FRONT - GiMETER);
 
 	// Position the Enemy
-	_cObject.mcpSceneNode->translate(sEnemyPosition);
+	_cObject.Translate(sEnemyPosition);
 
 	// If the Object should be randomly oriented
-	if (bRandomlyOrientObject)
+	if (sSpecies.bRandomlyOrient)
 	{
 		// Orient the Enemy randomly (in case not using Auto-tracking)
-		_cObject.mcpSceneNode->yaw(Degree(Math::RangeRandom(0, 360)), Node::TS_WORLD);
+		_cObject.Yaw(Degree(Math::RangeRandom(0, 360)), Node::TS_WORLD);
+	}
+
+	// If the Species Mesh has not been measured yet, measure it from this Objects Entity (every Object of the Species uses the same Mesh)
+	if (!sSpecies.bMeshMetricsMeasured && _cObject.mcpEntity != NULL)
+	{
+		mcSpeciesList.SetMeshMetrics(iSpecies, GetObjectLengthToMeterRatio(&_cObject));
 	}
 
 	// Scale the Enemies to the specified size, then apply Dimension scaling to make them look a little different
-	fEnemySizeToMeterRatio = GetObjectLengthToMeterRatio(&_cObject);
-	fEnemyLengthInMeters = fEnemyLengthInMeters * fEnemySizeToMeterRatio;
+	// NOTE: If there is no Mesh (i.e. running Headless) the Object is treated as being 1 unit long, same as GetObjectLengthToMeterRatio()
+	fEnemyLengthInMeters = sSpecies.fLengthInMeters * ((sSpecies.bMeshMetricsMeasured) ? sSpecies.fLengthToMeterRatio : GiMETER);
 	_cObject.mcpSceneNode->scale(fEnemyLengthInMeters, fEnemyLengthInMeters, fEnemyLengthInMeters);
 	_cObject.mcpSceneNode->scale(sEnemyDimensionsScale);
 
+	// Find the largest Dimension scale, since the Bounding Radius must cover the Objects longest side
+	float fLargestDimensionScale = sEnemyDimensionsScale.x;
+	if (sEnemyDimensionsScale.y > fLargestDimensionScale)
+	{	fLargestDimensionScale = sEnemyDimensionsScale.y;}
+	if (sEnemyDimensionsScale.z > fLargestDimensionScale)
+	{	fLargestDimensionScale = sEnemyDimensionsScale.z;}
+
+	// Cache the Objects Bounding Radius so collision detection does not need to query the Entity
+	// NOTE: This is worked out from the Species Length (in world units) instead of the Mesh, so it is the same whether rendering or Headless
+	_cObject.SetBoundingRadius(sSpecies.fLengthInMeters * GiMETER * 0.5 * fLargestDimensionScale);
+
 	// Apply Level Friction to Object
 	_cObject.SetFriction(mfLevelFriction);
 
-	// Give Objects a Scene Node to use for Automatic Tracking
-	_cObject.SetExclusiveSceneNodeToUseForAutomaticTracking(mcpSceneManager->getRootSceneNode()->createChildSceneNode(_cObject.GetName() + "TrackingSceneNode"));
-	
 	// If this Object should use Auto Tracking
-	if (bUseAutoTracking)
+	if (sSpecies.bUseAutoTracking)
 	{
 		// Set this Object to use Auto Tracking
 		_cObject.SetIfObjectShouldMoveToDestinationAutomatically(true, true);
 	}
+
+	// Move the Scene Node to where the Object was placed
+	_cObject.SavePreviousTransform();
+	_cObject.SyncSceneNodeWithTransform();
+
+	// Return that the Object was created
+	return true;
 }
 
 // Returns how big the Length of the Object is compared to a Meter
+// NOTE: If the Object has no Entity (ie running Headless) it is treated as being 1 unit long
 float CGame::GetObjectLengthToMeterRatio(CObject* _cpObject)
 {
+	// If there is no mesh to measure
+	if (_cpObject->mcpEntity == NULL)
+	{
+		return GiMETER;
+	}
+
 	// Get the size of the Objects mesh
 	Vector3 sObjectSize = _cpObject->mcpEntity->getBoundingBox().getSize();
 
@@ -3441,27 +4512,76 @@ float CGame::GetObjectLengthToMeterRatio(CObject* _cpObject)
 	return (GiMETER / fObjectLength);
 }
 
+// Creates the spare Scene Nodes and Entities for each type of Fish (called when the Level is loaded)
+void CGame::CreateSpareFishScenes()
+{
+	CObject* cpaTempObject[GiNUMBER_OF_SPARE_FISH_SCENES_PER_TYPE];	// Temp Objects used to create the spares (they are put in the Object Pool, which holds their Components)
+
+	// Loop through each type of Fish
+	for (int iSpecificType = GiOBJECT_SPECIFIC_TYPE_FISH_INDEX_START; iSpecificType <= GiOBJECT_SPECIFIC_TYPE_FISH_INDEX_END; iSpecificType++)
+	{
+		int iSpare = 0;
+
+		// If this type of Fish has no Species no Fish of it can be created, so it needs no spares
+		if (!mcSpeciesList.ReturnIfSpeciesIsDefined(iSpecificType))
+		{
+			continue;
+		}
+
+		// Setup Fish which are never put in the Level
+		// NOTE: They are all created before any are destroyed, otherwise they would just reuse each others spares
+		for (iSpare = 0; iSpare < GiNUMBER_OF_SPARE_FISH_SCENES_PER_TYPE; iSpare++)
+		{
+			cpaTempObject[iSpare] = mcObjectPool.ReturnObject(mcObjectPool.InsertNewObject());
+			cpaTempObject[iSpare]->SetID(miTotalNumberOfObjectsCreated++);
+			cpaTempObject[iSpare]->SetName("SpareFish" + StringConverter::toString(cpaTempObject[iSpare]->GetID()));
+			cpaTempObject[iSpare]->SetGeneralObjectType(GiOBJECT_GENERAL_TYPE_ENEMY);
+			cpaTempObject[iSpare]->SetSpecificObjectType(iSpecificType);
+			CreateObject(*cpaTempObject[iSpare]);
+		}
+
+		// Destroy the Fish, which keeps their Scene Nodes and Entities as spares, and take them back out of the Object Pool
+		for (iSpare = 0; iSpare < GiNUMBER_OF_SPARE_FISH_SCENES_PER_TYPE; iSpare++)
+		{
+			DestroyObjectsSceneNode(cpaTempObject[iSpare]);
+			mcObjectPool.RemoveObject(cpaTempObject[iSpare]->msHandle);
+		}
+	}
+}
+
 // Function creates a new Flocking or Non-Flocking Fish and returns a pointer to it
 // NOTE: Using -1 for ObjectSpecificType will randomly pick which specific type of Fish to create
 CObject* CGame::CreateFish(bool _bIsFlockingFish, int _iObjectSpecificType)
 {
-	CObject cTempObject;						// Temp Object used to create the Fish
 	int iSpecificType = _iObjectSpecificType;	// The Specific Type of Fish to create
+
+	// Put a new Object in the Object Pool and set the Fish up in place (instead of setting up a Temp Object and copying it in)
+	CObject* cpFish = mcObjectPool.ReturnObject(mcObjectPool.InsertNewObject());
+
+	// Every Fish Performs its own AI
+	mcObjectPool.AddComponent(cpFish->msHandle, GiCOMPONENT_FISH_BRAIN);
 	
 	// If this should be a Flocking Fish
 	if (_bIsFlockingFish)
 	{
-		// Copy Flocking Fish parameters to this Fish
-		cTempObject = mcDefaultFlockingFish;
-
-		// Set how often this Fish's Neighbor list should be updated
-		cTempObject.mcAIHelper.SetUpdateTimeInterval((int)Math::RangeRandom(500, 1000));
+		// Give the Fish Flocking
+		mcObjectPool.AddComponent(cpFish->msHandle, GiCOMPONENT_FLOCKING);
+
+		// Copy Flocking Fish parameters to this Fish (only its Brain, Flocking, AI, and Attributes are set by the Configuration Files)
+		mcObjectPool.AddComponent(cpFish->msHandle, GiCOMPONENT_ATTRIBUTES);
+		*cpFish->mspFishBrain = msDefaultFishBrain;
+		*cpFish->mspFlocking = msDefaultFlocking;
+		cpFish->mcAIHelper.CopyFrom(mcDefaultFlockingFishAIHelper);
+		cpFish->mcpAttributes->CopyFrom(mcDefaultFlockingFishAttributes);
+
+		// Set how often this Fish looks further away for Fish to swim towards when it has no Neighbors to flock with
+		cpFish->mcAIHelper.SetUpdateTimeInterval((int)Math::RangeRandom(500, 1000));
 	}
 
 	// Set the Objects ID, Name, and General Type
-	cTempObject.SetID(miTotalNumberOfObjectsCreated++);
-	cTempObject.SetName("Enemy" + StringConverter::toString(cTempObject.GetID()));
-	cTempObject.SetGeneralObjectType(GiOBJECT_GENERAL_TYPE_ENEMY);
+	cpFish->SetID(miTotalNumberOfObjectsCreated++);
+	cpFish->SetName("Enemy" + StringConverter::toString(cpFish->GetID()));
+	cpFish->SetGeneralObjectType(GiOBJECT_GENERAL_TYPE_ENEMY);
 
 	// If we should randomly pick which specific type of Fish to create
 	if (iSpecificType == -1)
@@ -3481,19 +4601,26 @@ CObject* CGame::CreateFish(bool _bIsFlockingFish, int _iObjectSpecificType)
 	}
 
 	// Set the type of Fish to create
-	cTempObject.SetSpecificObjectType(iSpecificType);
-
-	// Setup the Fish
-	CreateObject(cTempObject);
+	cpFish->SetSpecificObjectType(iSpecificType);
 
-	// Insert the Object into the Object List
-	mcObjectList.push_front(cTempObject);
+	// Setup the Fish, and take it back out of the Object Pool if it could not be created
+	if (!CreateObject(*cpFish))
+	{
+		mcObjectPool.RemoveObject(cpFish->msHandle);
+		return NULL;
+	}
 
 	// If we just created a Flocking Fish
 	if (_bIsFlockingFish)
 	{
 		// Increment the Number of Flocking Fish
 		miFlockingFishCount++;
+
+		// Insert the Fish into the Spatial Grid so other Objects can find it as a Neighbor
+		cpFish->mspFlocking->iSpatialGridHandle = mcSpatialGrid.InsertObject(cpFish, cpFish->GetPosition(), cpFish->GetSpecificObjectType());
+
+		// Insert the Fish into the AI Scheduler so it periodically looks further away for Fish to swim towards
+		cpFish->mcAIHelper.miAISchedulerHandle = mcAIScheduler.InsertObject(cpFish, cpFish->mcAIHelper.GetUpdateTimeInterval(), mcpClock->ReturnSavedTime());
 	}
 	else
 	{
@@ -3501,29 +4628,92 @@ CObject* CGame::CreateFish(bool _bIsFlockingFish, int _iObjectSpecificType)
 		miNonFlockingFishCount++;	
 	}
 
+	// Insert the Fish into the Collision Grid so the Player and Shark can catch it
+	InsertObjectIntoCollisionGrid(cpFish);
+
 	// Return a pointer to the newly created Object
-	return &mcObjectList.front();
+	return cpFish;
+}
+
+// Function creates the given number of Flocking or Non-Flocking Fish of random types
+void CGame::CreateFishInBulk(bool _bIsFlockingFish, int _iNumberOfFish)
+{
+	// Make room in the Object Pool for all of the Fish at once, instead of growing it as each Fish is created
+	mcObjectPool.ReserveObjects(mcObjectPool.ReturnNumberOfObjects() + _iNumberOfFish);
+
+	// Loop through and create the Fish
+	for (int iFish = 0; iFish < _iNumberOfFish; iFish++)
+	{
+		CreateFish(_bIsFlockingFish);
+	}
+}
+
+// Function creates another Shark just like the first one and returns a pointer to it
+CObject* CGame::CreateExtraShark()
+{
+	// Put a new Object in the Object Pool and set the Shark up in place (Sharks are never Removed, so the pointer stays valid)
+	CObject* cpShark = mcObjectPool.ReturnObject(mcObjectPool.InsertNewObject());
+
+	// Set the Sharks ID, Name, and General Type
+	cpShark->SetID(miTotalNumberOfObjectsCreated++);
+	cpShark->SetName("Enemy" + StringConverter::toString(cpShark->GetID()));
+	cpShark->SetGeneralObjectType(GiOBJECT_GENERAL_TYPE_ENEMY);
+	cpShark->SetSpecificObjectType(GiOBJECT_SPECIFIC_TYPE_SHARK);
+
+	// Setup the Shark, and take it back out of the Object Pool if it could not be created
+	if (!CreateObject(*cpShark))
+	{
+		mcObjectPool.RemoveObject(cpShark->msHandle);
+		return NULL;
+	}
+
+	// Give the Shark its Brain
+	mcObjectPool.AddComponent(cpShark->msHandle, GiCOMPONENT_SHARK_BRAIN);
+
+	// Give it the same Brain, AI, Attributes, and External Forces as the first Shark (but not the first Sharks Hit Delay)
+	*cpShark->mspSharkBrain = *mcpShark->mspSharkBrain;
+	cpShark->mspSharkBrain->sHitDelayEvent = SEventHandle();
+	cpShark->mcAIHelper.CopyFrom(mcpShark->mcAIHelper);
+	cpShark->mcpAttributes->CopyFrom(*mcpShark->mcpAttributes);
+	cpShark->mcExternalForceList = mcpShark->mcExternalForceList;
+
+	// Set how often this Objects Neighbor list should be updated
+	cpShark->mcAIHelper.SetUpdateTimeInterval((int)Math::RangeRandom(750, 1250));
+
+	// Save a pointer to the Shark
+	mcSharkList.push_back(cpShark);
+
+	// Return a pointer to the newly created Shark
+	return cpShark;
 }
 
 // Function creates and returns a pointer to an Item
 CObject* CGame::CreateItem(int _iObjectSpecificType)
 {
-	CObject cTempObject;		// Temp Object used to create the Item
+	// Put a new Object in the Object Pool and set the Item up in place
+	CObject* cpItem = mcObjectPool.ReturnObject(mcObjectPool.InsertNewObject());
 
 	// Set the Objects ID, Name, and Type
-	cTempObject.SetID(miTotalNumberOfObjectsCreated++);
-	cTempObject.SetName("Item" + StringConverter::toString(cTempObject.GetID()));
-	cTempObject.SetGeneralObjectType(GiOBJECT_GENERAL_TYPE_ITEM);
-	cTempObject.SetSpecificObjectType(_iObjectSpecificType);
+	cpItem->SetID(miTotalNumberOfObjectsCreated++);
+	cpItem->SetName("Item" + StringConverter::toString(cpItem->GetID()));
+	cpItem->SetGeneralObjectType(GiOBJECT_GENERAL_TYPE_ITEM);
+	cpItem->SetSpecificObjectType(_iObjectSpecificType);
+
+	// Give the Item what it needs to be collected
+	mcObjectPool.AddComponent(cpItem->msHandle, GiCOMPONENT_COLLECTIBLE);
 
-	// Create the Item
-	CreateObject(cTempObject);
+	// Create the Item, and take it back out of the Object Pool if it could not be created
+	if (!CreateObject(*cpItem))
+	{
+		mcObjectPool.RemoveObject(cpItem->msHandle);
+		return NULL;
+	}
 
-	// Insert the Object into the Object List
-	mcObjectList.push_front(cTempObject);
+	// Insert the Item into the Collision Grid so the Player can get it
+	InsertObjectIntoCollisionGrid(cpItem);
 
 	// Return a pointer to the newly created Item
-	return &mcObjectList.front();
+	return cpItem;
 }
 
 
@@ -3702,7 +4892,12 @@ bool CGame::keyPressed(const OIS::KeyEvent& _cArg)
 
 			// TODO - Remove this developer cheat to instantly gain more health
 			case OIS::KC_H:
-				mcpPlayer->mcAttributes.SetHealthRelative(1);
+				mcpPlayer->mcpAttributes->SetHealthRelative(1);
+			break;
+
+			// Write out what the Profiler has recorded
+			case OIS::KC_P:
+				WriteProfileTrace();
 			break;
 
 			// Do nothing if it's an unrecognized key
@@ -4188,7 +5383,7 @@ bool MakePlayerFlash(void* _vpOptionalDataToPass)
 	CGame* cpGame = (CGame*)_vpOptionalDataToPass;
 
 	// If the Player is Dead or we are no longer in the Play Game State
-	if (cpGame->mcpPlayer->mcAttributes.ReturnHealth() < 1 || 
+	if (cpGame->mcpPlayer->mcpAttributes->ReturnHealth() < 1 || 
 		cpGame->mcGameStateManager.ReturnCurrentStateFunction() != cpGame->GameStatePlay)
 	{
 		// Stop flashing the Player
@@ -4202,5 +5397,36 @@ bool MakePlayerFlash(void* _vpOptionalDataToPass)
 	Light* cpPlayerSpotLight = cpGame->mcpSceneManager->getLight("PlayerSpotLight");
 	cpPlayerSpotLight->setVisible(!cpPlayerSpotLight->getVisible());
 
+	return true;
+}
+
+// Increments a Flocking Fish's Age (Scheduled every second for each Flocking Fish)
+bool AgeFlockingFish(void* _vpOptionalDataToPass)
+{
+	// Get the Fish
+	CObject* cpFish = (CObject*)_vpOptionalDataToPass;
+
+	// Increment Fish's Age
+	cpFish->mspFishBrain->fAge += 1;
+
+	return true;
+}
+
+// Makes the Shark lose a Health point (Scheduled every Health Degrade Delay)
+bool MakeSharkHungry(void* _vpOptionalDataToPass)
+{
+	// Get the Shark
+	CObject* cpShark = (CObject*)_vpOptionalDataToPass;
+
+	// Decrement Sharks Health
+	cpShark->mcpAttributes->SetHealthRelative(-1);
+
+	return true;
+}
+
+// Ends a Sharks Hit Delay, so it can attack the Player again
+// NOTE: The Shark avoids the Player for as long as this Event is Scheduled, so there is nothing else to do when it fires
+bool EndSharkHitDelay(void* _vpOptionalDataToPass)
+{
 	return true;
 }
\ No newline at end of file
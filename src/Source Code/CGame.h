@@ -6,9 +6,24 @@
 #include "CStateManager.h"
 #include "CCameraSystem.cpp"
 #include "CObject.h"
+#include "CObjectPool.h"
+#include "CSpatialHashGrid.h"
+#include "CFlockingKernel.h"
+#include "CKinematicIntegrator.h"
+#include "CJobSystem.h"
+#include "CAIScheduler.h"
+#include "CFishSchoolList.h"
+#include "CInfluenceGrid.h"
+#include "CBoundaryField.h"
+#include "CPopulationController.h"
+#include "CSpeciesList.h"
+#include "CWorldState.h"
+#include "SRandomNumberGenerator.h"
+#include "CProfiler.h"
 #include "UnitFunctions.cpp"
 #include "COgreText.h"
 #include <list>
+#include <algorithm>
 #include "OgreStringConverter.h"
 #include <fstream>
 #include <string>
@@ -52,25 +67,37 @@ const int GiNUMBER_OF_LEVELS	= 6;	// Levels 0 - 5 inclusive
 // Define the number of Points needed to earn an extra Health point
 const int GiPOINTS_NEEDED_FOR_EXTRA_HEALTH	= 2500;
 
+// Define how many Steps apart far away Fish are grouped into Schools
+const int GiFISH_SCHOOL_FORMING_INTERVAL	= 30;
+
+// Define the size of the Cells the Sharks' Influence is stored in
+const float GfSHARK_INFLUENCE_CELL_SIZE	= 15 * GiMETER;
+
+// Define how close to the edges of the ocean Flocking Fish start steering back into it
+const float GfBOUNDARY_AVOID_DISTANCE	= 2 * GiMETER;
+
+// Define how many spare Scene Nodes and Entities are created for each type of Fish when a Level is loaded
+//	(so spawning a Fish doesn't have to create them)
+const int GiNUMBER_OF_SPARE_FISH_SCENES_PER_TYPE	= 2;
+
+// Define the Commands which change which Objects are in the Level (applied in this order at the end of each Step)
+const int GiOBJECT_COMMAND_REMOVE		= 0;	// Remove the Object from the Level
+const int GiOBJECT_COMMAND_KILL			= 1;	// Take the Dead Object out of the Collision Grid, but leave it in the Level (Rings expand before being Removed)
+const int GiOBJECT_COMMAND_SPAWN_FISH	= 2;	// Spawn a new Fish of the same type as the Object
+
 // Makes the Player flash for a few seconds
 bool MakePlayerFlash(void* _vpOptionalDataToPass);
 
+// Increments a Flocking Fish's Age, and makes the Shark lose Health (Scheduled Events)
+bool AgeFlockingFish(void* _vpOptionalDataToPass);
+bool MakeSharkHungry(void* _vpOptionalDataToPass);
 
-/////////////////////////////////////////////////////////////////////
-// Structures
+// Ends a Sharks Hit Delay, so it can attack the Player again (Scheduled Event)
+bool EndSharkHitDelay(void* _vpOptionalDataToPass);
 
-// Holds a neighbor and it's distance
-struct SNeighbor
-{
-	CObject* cpNeighbor;
-	unsigned int uiDistanceSquared;
 
-	SNeighbor()
-	{
-		cpNeighbor = NULL;
-		uiDistanceSquared = 4200000000;	// Upper range of unsigned int
-	}
-};
+/////////////////////////////////////////////////////////////////////
+// Structures
 
 // Holds the Levels Goal criteria
 struct SGoal
@@ -97,6 +124,41 @@ struct SGoal
 	}
 };
 
+// Holds a change to which Objects are in the Level (Objects are spawned, killed, and removed while the AI
+//	and Collision Detection are looping through them, possibly on several Threads, so the changes are recorded
+//	and all made at once at the end of the Step by ApplyObjectCommands())
+struct SObjectCommand
+{
+	int iCommand;					// What to do (e.g. GiOBJECT_COMMAND_REMOVE)
+	SObjectHandle sHandle;			// Handle of the Object to change (the Parent Fish when spawning)
+	int iSpecificType;				// Specific Type of the Object (Commands on the same type of Object are made together)
+	int iObjectID;					// ID of the Object (so Commands are made in the same order no matter which Thread recorded them)
+	bool bIsFlockingFish;			// Tells if a Flocking or Non-Flocking Fish should be spawned (Spawn Commands only)
+
+	// Used to sort the Commands by what they do, then by the type of Object, then by the Object's ID
+	// NOTE: This way all of the Scene Nodes and Entities using the same Mesh are handled one after the other
+	bool operator<(SObjectCommand const& _sCommand) const
+	{
+		if (iCommand != _sCommand.iCommand)
+		{
+			return (iCommand < _sCommand.iCommand);
+		}
+		if (iSpecificType != _sCommand.iSpecificType)
+		{
+			return (iSpecificType < _sCommand.iSpecificType);
+		}
+		return (iObjectID < _sCommand.iObjectID);
+	}
+};
+
+// Holds the Scene Node and Entity of a removed Fish, kept so a new Fish of the same type can use them
+//	instead of creating its own
+struct SFishScene
+{
+	SceneNode* cpSceneNode;			// The Fish's Scene Node (detached from the scene while it is spare)
+	Entity* cpEntity;				// The Fish's Entity (NULL when running Headless)
+};
+
 
 /////////////////////////////////////////////////////////////////////
 // Game Class
@@ -143,21 +205,150 @@ public:
 	static void GameStatePlay(void* _vpOptionalDataToPass, EPurpose _ePurpose);
 
 
+	/////////////////////////////////////////////////////////////////
+	// Headless Simulation Functions
+
+	// Runs the given Level without a Render Window, Render System, or input for the given number of seconds
+	// NOTE: Used to benchmark and soak test the AI and physics; the results are written to the Log File
+	bool RunHeadless(int _iLevel, float _fSecondsToSimulate, float _fTimeStepInSeconds = (1.0f / 60.0f));
+
+
+	/////////////////////////////////////////////////////////////////
+	// Profiling Functions
+
+	// Writes the Zones recorded by the Profiler to the file in Chrome's Trace Event format (open it in about:tracing)
+	// NOTE: Nothing is recorded unless OCEAN_EXPLORER_PROFILER is defined
+	bool WriteProfileTrace(string _sFileName = "../../ProfileTrace.json");
+
+
 	/////////////////////////////////////////////////////////////////
 	// Helper Functions
 
 	// Sets up the initial scene of the level
 	bool SetupLevelScene();
 
+	// Sets up the Cameras, Lighting, and Ocean boundaries of the level (not used when running Headless)
+	void SetupLevelSurroundings(float _fPlayerViewDistance);
+
 	// Updates all of the Objects (Position, orientation, etc)
 	void UpdateObjects();
 
+	// Calculates the Flocking Direction and Speed of every living Flocking Fish at once
+	// NOTE: Should be called after the Neighbors are updated and before PerformAI()
+	void PerformFlocking();
+
 	// Perform AI on the given Object
-	void PerformAI(CObject* _cpObject);
+	// _iThreadIndex is the Job System Thread running the AI (any Object Commands it makes are recorded on that Thread)
+	void PerformAI(CObject* _cpObject, int _iThreadIndex = 0);
+
+	// Makes the Fish wander to random Destinations (the only AI done by Fish far from the Player and Shark)
+	// _sRandom is the Fish's random number Generator for this Step (see PerformAI())
+	void PerformWanderAI(CObject* _cpObject, SRandomNumberGenerator& _sRandom);
+
+	// Returns which AI Level Of Detail the Flocking Fish should be in, based on how close it is to the Player or Shark
+	int ReturnAILevelOfDetail(CObject* _cpFish) const;
+
+	// Returns the distance from the Position to whichever of the Player or closest Shark is closer
+	float ReturnDistanceToPlayerOrShark(Vector3 _sPosition) const;
+
+	// Stores every Sharks Position in the Shark Influence Grid (should be done once per Step, before any Fish AI)
+	void UpdateSharkInfluence();
+
+	// Perception stage: works out what each living Fish and Shark senses about the Sharks and the Player this Step
+	// NOTE: Should be done once per Step, after the Shark Influence is updated and the Schools are expanded
+	void UpdatePerception();
+
+	// Works out how far the Object is from the Player and if it can sense it (used by UpdatePerception())
+	void SensePlayer(CObject* _cpObject);
+
+	// Works out which of the Objects Neighbors is closest and if it can sense it (the rest of its Perception)
+	// NOTE: Should be done once per Step, after the Objects Neighbors are updated and before its AI is Performed
+	void SenseClosestNeighbor(CObject* _cpObject);
+
+	// Expands the Schools the Player or Shark have come close to back into individual Fish, groups far away
+	//	Flocking Fish into Schools, and moves the Schools
+	void UpdateFishSchools();
+
+	// Moves the Object to its new Position in the Spatial and Collision Grids (if it is in them)
+	void MoveObjectInGrids(CObject* _cpObject);
+
+	// Jobs run by the Job System to update the Neighbors of, and Perform the AI of, the Objects in
+	//	mcNeighborUpdateList and mcAIObjectList (_vpGame is a pointer to this class)
+	static void UpdateNeighborsJob(void* _vpGame, int _iStartIndex, int _iEndIndex, int _iThreadIndex);
+	static void PerformAIJob(void* _vpGame, int _iStartIndex, int _iEndIndex, int _iThreadIndex);
+
+	// Picks the Fish's closest Neighbor Candidates which are within its Sense Neighbor Range, and stores up to
+	//	_iMaxNeighbors of them in _saNeighbors (sorted from closest to farthest). Returns how many were stored
+	int ReturnNeighborsFromCandidates(CObject* _cpFish, int _iMaxNeighbors, SObjectHandle* _saNeighbors) const;
+
+	// Returns if the Fish may spawn a new Fish of the same type this Step (the ones which do are picked in UpdateObjects())
+	bool ReturnIfFishCanSpawn(CObject* _cpFish) const;
+
+	// Records that the Fish wants to spawn a new Fish of the same type (created later by ApplyObjectCommands())
+	void RequestFishSpawn(CObject* _cpParentFish, bool _bIsFlockingFish, int _iThreadIndex);
+
+	// Marks the Object as Dead, and records that it should be Removed from the Level (by ApplyObjectCommands())
+	// NOTE: The Object stays in the Level until then, so loops over the Objects are not changed while they run
+	void RequestObjectRemoval(CObject* _cpObject, int _iThreadIndex = 0);
+
+	// Marks the Object as Dead, and records that it should be taken out of the Collision Grid (by ApplyObjectCommands())
+	void RequestObjectKill(CObject* _cpObject, int _iThreadIndex = 0);
+
+	// Makes every Command recorded by every Thread this Step, sorted so Objects of the same type are handled together
+	// NOTE: Should only be called when no loops over the Objects are running (the end of the Step)
+	void ApplyObjectCommands();
+
+	// Creates the Fish which were Requested while Performing the AI (only as many as the Population Controller allows this Step)
+	void SpawnRequestedFish(vector<SObjectCommand>& _cSpawnCommandList);
+
+	// Schedules the Events which Age the Flocking Fish and make the Shark lose Health (called when the Level starts being played)
+	void ScheduleDegradationEvents();
+
+	// Schedules an Event for each of the Flocking Fish which Ages it every second
+	void ScheduleFlockingFishAging(vector<CObject*>& _cFlockingFishList);
+
+	// Starts the Job System with the number of AI Threads to use (if it is not already using that many)
+	void StartJobSystem();
 
 	// Perform collision detection between Player and other entities
 	void PerformCollisionDetection();
 
+	// Handles the Player capturing the Fish or getting the Item (the Object is marked to be Removed, or Killed if it is a Ring)
+	void PlayerCapturesObject(CObject* _cpObject);
+
+	// Expands the Rings the Player has retrieved, and Removes them once they have expanded for a second
+	void UpdateDyingRings();
+
+	// Inserts the Object into the Collision Grid so the Player and Shark can find it
+	void InsertObjectIntoCollisionGrid(CObject* _cpObject);
+
+	// Runs one Simulation Step of the given length (AI, movement, collisions, and the level time)
+	void StepSimulation(float _fTimeStepInSeconds);
+
+	// Writes every Objects State into the World State and Swaps its buffers, so the next Step's AI reads
+	//	where the Objects are at the end of this Step (see CWorldState)
+	void PublishWorldState();
+
+	// Runs as many fixed Simulation Steps as fit in the time since the last frame (up to the max per frame),
+	//	then syncs the Scene Nodes, blending them between the last two Steps so movement is smooth
+	void RunSimulationSteps(float _fTimeSinceLastFrame);
+
+	// Pushes the Position and Orientation of every Object to its Scene Node so it can be rendered
+	// _fInterpolation blends each Object between its Previous Transform (0.0) and its current one (1.0)
+	// NOTE: Should be called once per frame, after all simulation updates are done
+	void SyncObjectsToSceneNodes(float _fInterpolation = 1.0f);
+
+	// Destroys the Objects Entity and Scene Node (along with any of its children)
+	// NOTE: A Fish's Scene Node and Entity are kept as spares for the next Fish of the same type instead
+	void DestroyObjectsSceneNode(CObject* _cpObject);
+
+	// Removes the Object from the level (its Scene Node, Spatial Grid entry, and the Object itself)
+	// NOTE: Use RequestObjectRemoval() instead while the Objects are being looped through
+	void DestroyObject(CObject* _cpObject);
+
+	// Returns the closest of the Objects Neighbors which still exists, or NULL if there isn't one
+	CObject* ReturnClosestNeighbor(CObject* _cpObject) const;
+
 	// Update the Cameras Position and Orientation based on the mode being used
 	void UpdateCamera();
 
@@ -176,19 +367,31 @@ public:
 	// Reads in a configuration file and sets the appropriate variables
 	bool ReadInConfigurationFile(string _sFileName, bool _bOnlyGetGoalVariables = false);
 
-	// Creates an Object of the specified type
-	void CreateObject(CObject& _cObject);
+	// Creates an Object of the specified type, using the values of its Species
+	// NOTE: Fish use a spare Scene Node and Entity of the same type if there is one
+	// NOTE: Returns false (and creates nothing) if the Objects Species is not defined
+	bool CreateObject(CObject& _cObject);
+
+	// Creates the spare Scene Nodes and Entities for each type of Fish (called when the Level is loaded)
+	void CreateSpareFishScenes();
 
 	// Returns how big the Length of the Object is compared to a Meter
 	float GetObjectLengthToMeterRatio(CObject* _cpObject);
 
 	// Function creates a new Flocking or Non-Flocking Fish and returns a pointer to it
 	// NOTE: Using -1 for ObjectSpecificType will randomly pick which specific type of Fish to create
+	// NOTE: Returns NULL if the type of Fish has no Species
 	CObject* CreateFish(bool _bIsFlockingFish = true, int _iObjectSpecificType = -1);
 
-	// Function creates and returns a pointer to an Item
+	// Function creates the given number of Flocking or Non-Flocking Fish of random types
+	void CreateFishInBulk(bool _bIsFlockingFish, int _iNumberOfFish);
+
+	// Function creates and returns a pointer to an Item (or NULL if the type of Item has no Species)
 	CObject* CreateItem(int _iObjectSpecificType);
 
+	// Function creates another Shark just like the first one (mcpShark) and returns a pointer to it (or NULL if the Shark has no Species)
+	CObject* CreateExtraShark();
+
 
 	/////////////////////////////////////////////////////////////////
 	// Input Handler Functions
@@ -230,11 +433,20 @@ private:
 	
 	CClock* mcpClock;						// Holds a pointer to the Clock
 	CScheduler* mcpScheduler;				// Holds a pointer to the Scheduler
+	CProfiler* mcpProfiler;					// Holds a pointer to the Profiler
+	SEventHandle msPlayerFlashEvent;		// Handle to the Event making the Player flash after being attacked
 
 	CStateManager mcGameStateManager;		// Object to manage the Game States
 
+	bool mbHeadless;						// Tells if the Game is running without a Render Window or Render System
+
 	FrameEvent mcFrameEvent;				// Pointer to the current Frame Event
 
+	float mfSimulationTimeStep;				// Seconds Simulated by each fixed Simulation Step (0 steps by the frame time instead)
+	int miMaxSimulationStepsPerFrame;		// Most Simulation Steps to run in one frame (so a hitch doesn't make us fall further behind)
+	float mfSimulationTimeAccumulator;		// Seconds of frame time which have not been Simulated yet
+	float mfTimeStep;						// Seconds being Simulated by the current Simulation Step
+
 	Overlay* mcpDebugOverlay;				// Holds a pointer to the Overlay used to display the Debug HUD
 	bool mbShowDebugHUD;					// Tells whether or not to show the Debug HUD
 
@@ -250,6 +462,8 @@ private:
 
 	bool mbReverseYAxis;					// Tells whether the Y-axis should be Reversed or not
 	float mfMouseSpeed;						// Specifies the speed the of the Mouse
+	float mfPlayerCaptureFishRange;			// How close the Player must be to a Fish to catch it
+	float mfPlayerGetItemRange;				// How close the Player must be to an Item to get it
 
 	COgreText* mcpLevelTimeRemainingTextBox;// Holds a pointer to a TextArea to display how much time is remaining to complete the level
 	float mfLevelTime;						// Holds how much time the player has left to complete the level
@@ -278,11 +492,61 @@ private:
 	SceneNode* mcpDesiredSharkCameraTarget;		// Holds the position of where the SharkCamera should be looking
 
 	bool mbAllowMixedFlocking;				// Tells whether Flocking Fish should only Flock with their own kind or not
-	CObject mcDefaultFlockingFish;			// Model Flocking Fish to hold default configuration parameters
+	SFishBrain msDefaultFishBrain;			// Model Flocking Fish values (Brain, Flocking, AI, and Attributes) to hold default configuration parameters
+	SFlocking msDefaultFlocking;
+	CAIHelper mcDefaultFlockingFishAIHelper;
+	CAttributes mcDefaultFlockingFishAttributes;
+
+	CSpatialHashGrid mcSpatialGrid;			// Holds the Flocking Fish so their closest Neighbors can be found quickly
+	float mfSpatialGridCellSize;			// Size of the Spatial Grids Cells (0 uses the Fish Sense Neighbor Range)
+	float mfNeighborSkinDistance;			// Extra distance past their Sense Neighbor Range that Fish find Neighbor Candidates within
+	bool mbRebuildNeighborLists;			// Tells if every Fish's Neighbor Candidates are being found again this Step
+	unsigned long mulNumberOfNeighborListRebuilds;	// How many Steps the Neighbor Candidates have been found again in
+	CFlockingKernel mcFlockingKernel;		// Calculates the Flocking of all Flocking Fish at once
+	CKinematicIntegrator mcKinematicIntegrator;	// Moves all of the Objects which are controlling themselves at once
+	CWorldState mcWorldState;				// Snapshot of every Object at the end of the last Step, read by the AI instead of the Objects themselves
+	CBoundaryField mcBoundaryField;			// Tells Flocking Fish near the edges of the ocean which way to steer back into it
+
+	CSpatialHashGrid mcCollisionGrid;		// Holds every Fish and Item so only the ones near the Player and Shark are checked for collisions
+	float mfLargestCollisionRadius;			// Largest Bounding Radius of any Object put in the Collision Grid
+	vector<CObject*> mcCollisionCandidateList;	// Objects the Collision Grid found near the Player or Shark
+
+	CJobSystem mcJobSystem;					// Runs the Neighbor updates and Fish AI across all processors
+	int miNumberOfAIThreads;				// Number of Threads to run the AI on (0 uses one per processor)
+	vector<CObject*> mcNeighborUpdateList;	// Objects whose Neighbors are being updated this Step
+	vector<CObject*> mcAIObjectList;		// Fish whose AI is being Performed on the Job System this Step
+	vector<unsigned long> mcCandidatesExaminedList;	// Neighbor Candidates examined by each Thread this Step
+	vector<unsigned long> mcNeighborQueriesList;	// Neighbor queries done by each Thread this Step
+	vector< vector<SObjectCommand> > mcObjectCommandList;	// Object Commands recorded by each Thread this Step
+	vector<CObject*> mcaSpawnParentList[GiNUMBER_OF_POPULATIONS];	// Fish picked to spawn this Step, for each Population (no more than its Spawns due)
+
+	CPopulationController mcPopulationController;	// Decides how many Fish may spawn each Step to replace the ones which were removed
+	CSpeciesList mcSpeciesList;				// Holds the Mesh, size, speeds, Points, etc. of each Specific Type of Object (read in from the Species File)
+	vector<SFishScene> mcaSpareFishSceneList[GiOBJECT_SPECIFIC_TYPE_FISH_INDEX_END + 1];	// Spare Scene Nodes and Entities for each Specific Type of Fish
+
+	CAIScheduler mcAIScheduler;				// Decides which Objects get their periodic AI Update each Step (within the AI Update Budget)
+	vector<CObject*> mcScheduledUpdateList;	// Objects the AI Scheduler selected for their periodic Update this Step
+	vector<long long> mcScheduledUpdateTicksList;	// Ticks each Thread spent doing the periodic Updates this Step
+	vector<int> mcNumberOfScheduledUpdatesDoneList;	// Periodic Updates each Thread did this Step
+
+	CFishSchoolList mcFishSchoolList;		// Schools of far away Flocking Fish which are simulated as a single agent
+	float mfFishSchoolRadius;				// How close far away Fish must be to be grouped into a School (0 turns Schools off)
+	vector<CObject*> mcNewSchoolList;		// Fish being grouped into a new School
+
+	float mfAINearDistance;					// Flocking Fish closer than this to the Player or Shark do their full AI every Step
+	float mfAIFarDistance;					// Flocking Fish further than this from the Player and Shark only wander around
+	int miAIMidUpdateInterval;				// Flocking Fish in between do their full AI once every this many Steps
+	unsigned long mulNumberOfAISteps;		// How many Steps the AI has been Performed in (used to spread out the Mid Fish's AI)
+	unsigned int muiAIRandomSeed;			// Seed of the Objects' AI random numbers this Level (mixed with each Objects Slot and the Step number)
+	unsigned long mulaNumberOfFishInEachAILevelOfDetail[GiNUMBER_OF_AI_LEVELS_OF_DETAIL];	// Total Flocking Fish in each AI Level Of Detail over all Steps
 
 	CObject* mcpPlayer;						// Pointer to the Players Object
-	CObject* mcpShark;						// Pointer to the Shark Object
-	list<CObject> mcObjectList;				// Holds a list of all Objects
+	CObject* mcpShark;						// Pointer to the first Shark Object (the one the Shark Camera and HUD follow)
+	vector<CObject*> mcSharkList;			// Pointers to every Shark Object (Sharks are never Removed, so they stay valid)
+	vector<Vector3> mcSharkPositionList;	// Every Sharks Position this Step
+	int miNumberOfSharks;					// Number of Sharks in the Level
+	CInfluenceGrid mcSharkInfluenceGrid;	// Tells the Fish where the closest Shark is, and how to get away from the Sharks, without checking every Shark
+	CObjectPool mcObjectPool;				// Holds all of the Objects
 
 	int miLevel;							// The Level being played
 	SGoal msLevelGoal;						// The Goal of the Level
@@ -0,0 +1,191 @@
+#include "CInfluenceGrid.h"
+#include <cmath>		// Needed for floorf() and sqrtf() functions
+
+//---------- Contructors and Setup Functions ----------
+
+// Default Constructor
+CInfluenceGrid::CInfluenceGrid()
+{
+	miNumberOfCellsX = miNumberOfCellsY = miNumberOfCellsZ = 0;
+	mfCellSize = 1.0f;
+	mfInverseCellSize = 1.0f;
+	msMinimum = Ogre::Vector3::ZERO;
+	mfInfluenceRange = 0.0f;
+	miNumberOfPreditors = 0;
+}
+
+// Destructor
+CInfluenceGrid::~CInfluenceGrid()
+{
+	mcCellList.clear();
+}
+
+// Sets the box the Grid covers and the size of its Cells
+void CInfluenceGrid::SetBounds(Ogre::Vector3 _sMinimum, Ogre::Vector3 _sMaximum, float _fCellSize)
+{
+	// Make sure the Cell Size is valid
+	if (_fCellSize <= 0.0f)
+	{
+		return;
+	}
+
+	mfCellSize = _fCellSize;
+	mfInverseCellSize = 1.0f / mfCellSize;
+	msMinimum = _sMinimum;
+
+	// Find how many Cells are needed to cover the box (at least one along each axis)
+	Ogre::Vector3 sSize = _sMaximum - _sMinimum;
+	miNumberOfCellsX = (int)ceilf(sSize.x * mfInverseCellSize);
+	miNumberOfCellsY = (int)ceilf(sSize.y * mfInverseCellSize);
+	miNumberOfCellsZ = (int)ceilf(sSize.z * mfInverseCellSize);
+	miNumberOfCellsX = (miNumberOfCellsX > 0) ? miNumberOfCellsX : 1;
+	miNumberOfCellsY = (miNumberOfCellsY > 0) ? miNumberOfCellsY : 1;
+	miNumberOfCellsZ = (miNumberOfCellsZ > 0) ? miNumberOfCellsZ : 1;
+
+	// Create the Cells with no Preditors in them
+	mcCellList.clear();
+	mcCellList.resize(miNumberOfCellsX * miNumberOfCellsY * miNumberOfCellsZ);
+	UpdateInfluence(vector<Ogre::Vector3>());
+}
+
+// Sets how far away a Preditor adds to a Cell's Presence and Away Direction
+void CInfluenceGrid::SetInfluenceRange(float _fInfluenceRange)
+{
+	mfInfluenceRange = (_fInfluenceRange > 0.0f) ? _fInfluenceRange : 0.0f;
+}
+
+// Returns how far away a Preditor adds to a Cell's Presence and Away Direction
+float CInfluenceGrid::GetInfluenceRange() const
+{
+	return mfInfluenceRange;
+}
+
+
+
+//---------- Update Functions ----------
+
+// Fills in every Cell from the Preditors' Positions
+void CInfluenceGrid::UpdateInfluence(vector<Ogre::Vector3> const& _cPreditorPositionList)
+{
+	int iNumberOfPreditors = (int)_cPreditorPositionList.size();
+	int iCell = 0;
+
+	miNumberOfPreditors = iNumberOfPreditors;
+
+	// Loop through every Cell
+	for (int iZ = 0; iZ < miNumberOfCellsZ; iZ++)
+	{
+		for (int iY = 0; iY < miNumberOfCellsY; iY++)
+		{
+			for (int iX = 0; iX < miNumberOfCellsX; iX++, iCell++)
+			{
+				SInfluenceCell& sCell = mcCellList[iCell];
+				Ogre::Vector3 sCellCentre = msMinimum + (Ogre::Vector3(iX + 0.5f, iY + 0.5f, iZ + 0.5f) * mfCellSize);
+				float fClosestDistanceSquared = 0.0f;
+				float fSecondClosestDistanceSquared = 0.0f;
+
+				// Empty the Cell
+				sCell.sClosestPreditorPosition = Ogre::Vector3::ZERO;
+				sCell.sSecondClosestPreditorPosition = Ogre::Vector3::ZERO;
+				sCell.sAwayDirection = Ogre::Vector3::ZERO;
+				sCell.fPresence = 0.0f;
+
+				// Loop through the Preditors
+				for (int iPreditor = 0; iPreditor < iNumberOfPreditors; iPreditor++)
+				{
+					Ogre::Vector3 sAway = sCellCentre - _cPreditorPositionList[iPreditor];
+					float fDistanceSquared = sAway.squaredLength();
+
+					// If this is the closest Preditor to the Cell so far
+					if (iPreditor == 0 || fDistanceSquared < fClosestDistanceSquared)
+					{
+						// The old closest Preditor becomes the second closest
+						sCell.sSecondClosestPreditorPosition = sCell.sClosestPreditorPosition;
+						fSecondClosestDistanceSquared = fClosestDistanceSquared;
+
+						sCell.sClosestPreditorPosition = _cPreditorPositionList[iPreditor];
+						fClosestDistanceSquared = fDistanceSquared;
+					}
+					// Else if this is the second closest Preditor to the Cell so far
+					else if (iPreditor == 1 || fDistanceSquared < fSecondClosestDistanceSquared)
+					{
+						sCell.sSecondClosestPreditorPosition = _cPreditorPositionList[iPreditor];
+						fSecondClosestDistanceSquared = fDistanceSquared;
+					}
+
+					// If the Preditor is within the Influence Range, add how close it is to the Presence and Away Direction
+					if (fDistanceSquared < (mfInfluenceRange * mfInfluenceRange))
+					{
+						float fDistance = sqrtf(fDistanceSquared);
+						float fWeight = 1.0f - (fDistance / mfInfluenceRange);
+						sCell.fPresence += fWeight;
+						if (fDistance > 0.0001f)
+						{
+							sCell.sAwayDirection += sAway * (fWeight / fDistance);
+						}
+					}
+				}
+
+				// Store the Away Direction normalised so it doesn't need to be done on every lookup
+				sCell.sAwayDirection.normalise();
+			}
+		}
+	}
+}
+
+// Returns how many Preditors were given to the last UpdateInfluence()
+int CInfluenceGrid::ReturnNumberOfPreditors() const
+{
+	return miNumberOfPreditors;
+}
+
+
+
+//---------- Query Functions ----------
+
+// Stores the Position of the Preditor closest to the Position in _sPreditorPosition
+bool CInfluenceGrid::ReturnClosestPreditor(Ogre::Vector3 _sPosition, Ogre::Vector3& _sPreditorPosition) const
+{
+	// If there are no Preditors (or no Cells)
+	if (miNumberOfPreditors == 0 || mcCellList.empty())
+	{
+		return false;
+	}
+
+	SInfluenceCell const& sCell = mcCellList[ReturnCellIndex(_sPosition)];
+
+	// Use whichever of the Cell's two closest Preditors is closer to the Position
+	_sPreditorPosition = sCell.sClosestPreditorPosition;
+	if (miNumberOfPreditors > 1 &&
+		_sPosition.squaredDistance(sCell.sSecondClosestPreditorPosition) < _sPosition.squaredDistance(_sPreditorPosition))
+	{
+		_sPreditorPosition = sCell.sSecondClosestPreditorPosition;
+	}
+	return true;
+}
+
+// Returns how strongly the Preditors within the Influence Range are present at the Position
+float CInfluenceGrid::ReturnPresence(Ogre::Vector3 _sPosition) const
+{
+	return mcCellList.empty() ? 0.0f : mcCellList[ReturnCellIndex(_sPosition)].fPresence;
+}
+
+// Returns the Direction away from the Preditors within the Influence Range of the Position
+Ogre::Vector3 CInfluenceGrid::ReturnAwayDirection(Ogre::Vector3 _sPosition) const
+{
+	return mcCellList.empty() ? Ogre::Vector3::ZERO : mcCellList[ReturnCellIndex(_sPosition)].sAwayDirection;
+}
+
+// Returns the Index of the Cell the Position is in
+int CInfluenceGrid::ReturnCellIndex(Ogre::Vector3 const& _sPosition) const
+{
+	// Find the Cell along each axis, using the closest Cell if the Position is outside of the Grid
+	int iX = (int)floorf((_sPosition.x - msMinimum.x) * mfInverseCellSize);
+	int iY = (int)floorf((_sPosition.y - msMinimum.y) * mfInverseCellSize);
+	int iZ = (int)floorf((_sPosition.z - msMinimum.z) * mfInverseCellSize);
+	iX = (iX < 0) ? 0 : ((iX >= miNumberOfCellsX) ? (miNumberOfCellsX - 1) : iX);
+	iY = (iY < 0) ? 0 : ((iY >= miNumberOfCellsY) ? (miNumberOfCellsY - 1) : iY);
+	iZ = (iZ < 0) ? 0 : ((iZ >= miNumberOfCellsZ) ? (miNumberOfCellsZ - 1) : iZ);
+
+	return (((iZ * miNumberOfCellsY) + iY) * miNumberOfCellsX) + iX;
+}
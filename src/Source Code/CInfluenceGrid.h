@@ -0,0 +1,97 @@
+/////////////////////////////////////////////////////////////////////
+// CInfluenceGrid.h (and CInfluenceGrid.cpp)
+// Written by Daniel Schroeder
+// Created on October 17, 2026
+// Last Updated October 17, 2026
+//-------------------------------------------------------------------
+//   The CInfluenceGrid class holds where the Preditors (e.g. Sharks)
+// are in a coarse grid of Cells covering the Level, so any number of
+// Fish can find out about every Preditor without each Fish checking
+// each Preditor. UpdateInfluence() is called once per Step with every
+// Preditor's Position, and fills in each Cell with:
+//	- The two Preditors closest to the Cell (so the exact distance to the
+//	  closest one can be found, however far away it is)
+//	- The Presence of the Preditors within the Influence Range (higher
+//	  the more, and the closer, Preditors there are)
+//	- The Direction away from the Preditors within the Influence Range
+//	  (weighted by how close they are)
+//   Looking any of these up is just finding which Cell a Position is in.
+// Updating costs (number of Cells * number of Preditors), no matter how
+// many Fish use the Grid.
+// NOTE: The closest Preditor is picked from the two closest to the Cell's
+//		 centre, so for Positions near the edge of a Cell it may not be the
+//		 very closest when three Preditors are about the same distance away.
+/////////////////////////////////////////////////////////////////////
+
+#ifndef CINFLUENCE_GRID_H
+#define CINFLUENCE_GRID_H
+
+#include <Ogre.h>		// Include OGRE
+#include <vector>
+using namespace std;
+
+class CInfluenceGrid
+{
+public:
+
+	//---------- Contructors and Setup Functions ----------
+
+	CInfluenceGrid();									// Default Constructor
+	~CInfluenceGrid();									// Destructor
+
+	// Sets the box the Grid covers and the size of its Cells (Positions outside of the box use the closest Cell)
+	// NOTE: Removes all Preditors from the Grid
+	void SetBounds(Ogre::Vector3 _sMinimum, Ogre::Vector3 _sMaximum, float _fCellSize);
+
+	// Set/Get how far away a Preditor adds to a Cell's Presence and Away Direction
+	void SetInfluenceRange(float _fInfluenceRange);
+	float GetInfluenceRange() const;
+
+
+	//---------- Update Functions ----------
+
+	// Fills in every Cell from the Preditors' Positions (should be called once per Step)
+	void UpdateInfluence(vector<Ogre::Vector3> const& _cPreditorPositionList);
+
+	// Returns how many Preditors were given to the last UpdateInfluence()
+	int ReturnNumberOfPreditors() const;
+
+
+	//---------- Query Functions ----------
+
+	// Stores the Position of the Preditor closest to the Position in _sPreditorPosition
+	// Returns false if there are no Preditors
+	bool ReturnClosestPreditor(Ogre::Vector3 _sPosition, Ogre::Vector3& _sPreditorPosition) const;
+
+	// Returns how strongly the Preditors within the Influence Range are present at the Position (0 if there are none)
+	float ReturnPresence(Ogre::Vector3 _sPosition) const;
+
+	// Returns the Direction away from the Preditors within the Influence Range of the Position (normalised, or zero if there are none)
+	Ogre::Vector3 ReturnAwayDirection(Ogre::Vector3 _sPosition) const;
+
+private:
+
+	// Holds what is known about the Preditors around one Cell
+	struct SInfluenceCell
+	{
+		Ogre::Vector3 sClosestPreditorPosition;	// Position of the Preditor closest to the Cell's centre
+		Ogre::Vector3 sSecondClosestPreditorPosition;	// Position of the Preditor second closest to the Cell's centre (if there are at least two)
+		Ogre::Vector3 sAwayDirection;			// Direction away from the Preditors within the Influence Range (normalised)
+		float fPresence;						// Sum of how close (0 to 1) each Preditor within the Influence Range is
+	};
+
+	// Returns the Index of the Cell the Position is in
+	int ReturnCellIndex(Ogre::Vector3 const& _sPosition) const;
+
+	vector<SInfluenceCell> mcCellList;		// Holds the Cells (X changes fastest, then Y, then Z)
+	int miNumberOfCellsX;					// How many Cells there are along each axis
+	int miNumberOfCellsY;
+	int miNumberOfCellsZ;
+	float mfCellSize;						// Size of each Cell
+	float mfInverseCellSize;				// 1 / Cell Size
+	Ogre::Vector3 msMinimum;				// Smallest corner of the box the Grid covers
+	float mfInfluenceRange;					// How far away a Preditor adds to a Cell's Presence and Away Direction
+	int miNumberOfPreditors;				// How many Preditors were given to the last Update
+};
+
+#endif
@@ -0,0 +1,422 @@
+#include "CJobSystem.h"
+#ifdef _WIN32
+	#include <process.h>	// Needed for _beginthreadex() function
+#else
+	#include <unistd.h>		// Needed for sysconf() function when not running on Windows
+#endif
+
+//---------- Contructors and Setup Functions ----------
+
+// Default Constructor
+CJobSystem::CJobSystem()
+{
+	miNumberOfThreads = 1;
+	mbStarted = false;
+	mbStopping = false;
+	mlNumberOfChunksRemaining = 0;
+	mlNumberOfChunksStolen = 0;
+
+	// Create the Queue and Lock for the calling Thread, so ParallelFor() works even if Start() is never called
+	mcQueueList.resize(1);
+	#ifdef _WIN32
+		InitializeCriticalSection(&mcaQueueLocks[0]);
+	#else
+		pthread_mutex_init(&mcaQueueLocks[0], NULL);
+	#endif
+}
+
+// Destructor
+CJobSystem::~CJobSystem()
+{
+	Stop();
+
+	// Destroy the calling Thread's Lock
+	#ifdef _WIN32
+		DeleteCriticalSection(&mcaQueueLocks[0]);
+	#else
+		pthread_mutex_destroy(&mcaQueueLocks[0]);
+	#endif
+}
+
+// Creates the worker Threads
+bool CJobSystem::Start(int _iNumberOfThreads)
+{
+	int iThread = 0;
+
+	// Stop any Threads which are already running
+	Stop();
+
+	// If the number of Threads should be based on the number of processors
+	if (_iNumberOfThreads <= 0)
+	{
+		_iNumberOfThreads = ReturnNumberOfProcessors();
+	}
+
+	// Make sure the number of Threads is valid
+	if (_iNumberOfThreads > GiMAX_NUMBER_OF_JOB_THREADS)
+	{
+		_iNumberOfThreads = GiMAX_NUMBER_OF_JOB_THREADS;
+	}
+
+	// If no worker Threads are needed
+	if (_iNumberOfThreads <= 1)
+	{
+		return true;
+	}
+
+	// Create the Semaphores
+	#ifdef _WIN32
+		mhaSemaphores[eWorkAvailable] = CreateSemaphore(NULL, 0, 0x7FFFFFFF, NULL);
+		mhaSemaphores[eAllChunksDone] = CreateSemaphore(NULL, 0, 0x7FFFFFFF, NULL);
+		if (mhaSemaphores[eWorkAvailable] == NULL || mhaSemaphores[eAllChunksDone] == NULL)
+		{
+			if (mhaSemaphores[eWorkAvailable] != NULL)
+			{	CloseHandle(mhaSemaphores[eWorkAvailable]);}
+			if (mhaSemaphores[eAllChunksDone] != NULL)
+			{	CloseHandle(mhaSemaphores[eAllChunksDone]);}
+			return false;
+		}
+	#else
+		if (sem_init(&mhaSemaphores[eWorkAvailable], 0, 0) != 0)
+		{
+			return false;
+		}
+		if (sem_init(&mhaSemaphores[eAllChunksDone], 0, 0) != 0)
+		{
+			sem_destroy(&mhaSemaphores[eWorkAvailable]);
+			return false;
+		}
+	#endif
+	mbStarted = true;
+
+	// Create the Queue and Lock for each worker Thread
+	mcQueueList.resize(_iNumberOfThreads);
+	for (iThread = 1; iThread < _iNumberOfThreads; iThread++)
+	{
+		#ifdef _WIN32
+			InitializeCriticalSection(&mcaQueueLocks[iThread]);
+		#else
+			pthread_mutex_init(&mcaQueueLocks[iThread], NULL);
+		#endif
+	}
+
+	// Create the worker Threads
+	mbStopping = false;
+	miNumberOfThreads = 1;
+	for (iThread = 1; iThread < _iNumberOfThreads; iThread++)
+	{
+		msaThreadInfo[iThread].cpJobSystem = this;
+		msaThreadInfo[iThread].iThreadIndex = iThread;
+
+		#ifdef _WIN32
+			mhaThreads[iThread] = (HANDLE)_beginthreadex(NULL, 0, WorkerThread, &msaThreadInfo[iThread], 0, NULL);
+			bool bThreadCreated = (mhaThreads[iThread] != 0);
+		#else
+			bool bThreadCreated = (pthread_create(&mhaThreads[iThread], NULL, WorkerThread, &msaThreadInfo[iThread]) == 0);
+		#endif
+
+		// If the Thread could not be created, stop the ones which were
+		if (!bThreadCreated)
+		{
+			// Destroy the Lock of each worker Thread which was not created
+			for (int iLock = iThread; iLock < _iNumberOfThreads; iLock++)
+			{
+				#ifdef _WIN32
+					DeleteCriticalSection(&mcaQueueLocks[iLock]);
+				#else
+					pthread_mutex_destroy(&mcaQueueLocks[iLock]);
+				#endif
+			}
+			mcQueueList.resize(iThread);
+
+			Stop();
+			return false;
+		}
+
+		miNumberOfThreads++;
+	}
+
+	return true;
+}
+
+// Stops and destroys the worker Threads
+void CJobSystem::Stop()
+{
+	int iThread = 0;
+
+	// If the Job System was not Started
+	if (!mbStarted)
+	{
+		return;
+	}
+
+	// Tell the worker Threads to exit, and wake them up so they see it
+	mbStopping = true;
+	SignalSemaphore(eWorkAvailable, miNumberOfThreads - 1);
+
+	// Wait for each worker Thread to exit, then destroy it
+	for (iThread = 1; iThread < miNumberOfThreads; iThread++)
+	{
+		#ifdef _WIN32
+			WaitForSingleObject(mhaThreads[iThread], INFINITE);
+			CloseHandle(mhaThreads[iThread]);
+		#else
+			pthread_join(mhaThreads[iThread], NULL);
+		#endif
+	}
+
+	// Destroy the worker Threads' Locks
+	for (iThread = 1; iThread < miNumberOfThreads; iThread++)
+	{
+		#ifdef _WIN32
+			DeleteCriticalSection(&mcaQueueLocks[iThread]);
+		#else
+			pthread_mutex_destroy(&mcaQueueLocks[iThread]);
+		#endif
+	}
+
+	// Destroy the Semaphores
+	#ifdef _WIN32
+		CloseHandle(mhaSemaphores[eWorkAvailable]);
+		CloseHandle(mhaSemaphores[eAllChunksDone]);
+	#else
+		sem_destroy(&mhaSemaphores[eWorkAvailable]);
+		sem_destroy(&mhaSemaphores[eAllChunksDone]);
+	#endif
+
+	// Only the calling Thread is left
+	miNumberOfThreads = 1;
+	mcQueueList.resize(1);
+	mbStarted = false;
+	mbStopping = false;
+}
+
+// Returns how many Threads are used to run Jobs (including the calling Thread)
+int CJobSystem::ReturnNumberOfThreads() const
+{
+	return miNumberOfThreads;
+}
+
+// Returns how many processors this computer has
+int CJobSystem::ReturnNumberOfProcessors()
+{
+	#ifdef _WIN32
+		SYSTEM_INFO sSystemInfo;
+		GetSystemInfo(&sSystemInfo);
+		return (int)sSystemInfo.dwNumberOfProcessors;
+	#else
+		long lNumberOfProcessors = sysconf(_SC_NPROCESSORS_ONLN);
+		return (lNumberOfProcessors > 0) ? (int)lNumberOfProcessors : 1;
+	#endif
+}
+
+
+
+//---------- Job Functions ----------
+
+// Runs the Job on items 0 to _iNumberOfItems - 1, split into Chunks, across all Threads
+void CJobSystem::ParallelFor(int _iNumberOfItems, int _iChunkSize, JobFunction _pJobFunction, void* _vpData)
+{
+	// If there is nothing to do
+	if (_iNumberOfItems <= 0)
+	{
+		return;
+	}
+
+	// Make sure the Chunk Size is valid
+	if (_iChunkSize < 1)
+	{
+		_iChunkSize = 1;
+	}
+
+	// If there are no worker Threads, or only one Chunk, just run the Job on this Thread
+	if (miNumberOfThreads <= 1 || _iNumberOfItems <= _iChunkSize)
+	{
+		_pJobFunction(_vpData, 0, _iNumberOfItems, 0);
+		return;
+	}
+
+	// Split the items into Chunks and deal them out to the Threads' Queues
+	int iNumberOfChunks = (_iNumberOfItems + _iChunkSize - 1) / _iChunkSize;
+	mlNumberOfChunksRemaining = iNumberOfChunks;
+	for (int iChunk = 0; iChunk < iNumberOfChunks; iChunk++)
+	{
+		SJobChunk sChunk;
+		sChunk.pJobFunction = _pJobFunction;
+		sChunk.vpData = _vpData;
+		sChunk.iStartIndex = iChunk * _iChunkSize;
+		sChunk.iEndIndex = sChunk.iStartIndex + _iChunkSize;
+		if (sChunk.iEndIndex > _iNumberOfItems)
+		{
+			sChunk.iEndIndex = _iNumberOfItems;
+		}
+
+		int iQueue = iChunk % miNumberOfThreads;
+		LockQueue(iQueue);
+		mcQueueList[iQueue].push_back(sChunk);
+		UnlockQueue(iQueue);
+	}
+
+	// Wake up the worker Threads
+	SignalSemaphore(eWorkAvailable, miNumberOfThreads - 1);
+
+	// Help run the Chunks on this Thread
+	RunChunks(0);
+
+	// Wait for the Chunks the worker Threads are still running to finish
+	WaitForSemaphore(eAllChunksDone);
+}
+
+// Returns how many Chunks have been stolen from another Thread's Queue since the Job System was Started
+unsigned long CJobSystem::ReturnNumberOfChunksStolen() const
+{
+	return (unsigned long)mlNumberOfChunksStolen;
+}
+
+
+
+//---------- Private Functions ----------
+
+// The function each worker Thread runs until the Job System is Stopped
+#ifdef _WIN32
+unsigned int __stdcall CJobSystem::WorkerThread(void* _vpThreadInfo)
+#else
+void* CJobSystem::WorkerThread(void* _vpThreadInfo)
+#endif
+{
+	SThreadInfo* spThreadInfo = (SThreadInfo*)_vpThreadInfo;
+	CJobSystem* cpJobSystem = spThreadInfo->cpJobSystem;
+
+	// Loop until the Job System is Stopped
+	while (true)
+	{
+		// Wait until there is work to do
+		cpJobSystem->WaitForSemaphore(eWorkAvailable);
+
+		// If we should exit
+		if (cpJobSystem->mbStopping)
+		{
+			break;
+		}
+
+		// Run Chunks until there are none left
+		cpJobSystem->RunChunks(spThreadInfo->iThreadIndex);
+	}
+
+	return 0;
+}
+
+// Runs Chunks (from the Thread's own Queue first, then stolen from the others) until there are none left
+void CJobSystem::RunChunks(int _iThreadIndex)
+{
+	SJobChunk sChunk;
+
+	// While there are Chunks left to run
+	while (TakeChunk(_iThreadIndex, sChunk))
+	{
+		// Run the Job on this Chunk
+		sChunk.pJobFunction(sChunk.vpData, sChunk.iStartIndex, sChunk.iEndIndex, _iThreadIndex);
+
+		// If this was the last Chunk, let the calling Thread know they are all done
+		if (DecrementNumberOfChunksRemaining() == 0)
+		{
+			SignalSemaphore(eAllChunksDone, 1);
+		}
+	}
+}
+
+// Takes a Chunk from the back of the Thread's own Queue, or the front of another Thread's Queue
+bool CJobSystem::TakeChunk(int _iThreadIndex, SJobChunk& _sChunk)
+{
+	// Take the newest Chunk from our own Queue
+	LockQueue(_iThreadIndex);
+	if (!mcQueueList[_iThreadIndex].empty())
+	{
+		_sChunk = mcQueueList[_iThreadIndex].back();
+		mcQueueList[_iThreadIndex].pop_back();
+		UnlockQueue(_iThreadIndex);
+		return true;
+	}
+	UnlockQueue(_iThreadIndex);
+
+	// Our Queue is empty, so try stealing the oldest Chunk from each of the other Threads' Queues
+	for (int iOffset = 1; iOffset < miNumberOfThreads; iOffset++)
+	{
+		int iVictim = (_iThreadIndex + iOffset) % miNumberOfThreads;
+
+		LockQueue(iVictim);
+		if (!mcQueueList[iVictim].empty())
+		{
+			_sChunk = mcQueueList[iVictim].front();
+			mcQueueList[iVictim].pop_front();
+			UnlockQueue(iVictim);
+
+			// Record that a Chunk was stolen
+			#ifdef _WIN32
+				InterlockedIncrement(&mlNumberOfChunksStolen);
+			#else
+				__sync_add_and_fetch(&mlNumberOfChunksStolen, 1);
+			#endif
+			return true;
+		}
+		UnlockQueue(iVictim);
+	}
+
+	// There are no Chunks left in any Queue
+	return false;
+}
+
+// Locks the Thread's Queue so only this Thread can use it
+void CJobSystem::LockQueue(int _iQueueIndex)
+{
+	#ifdef _WIN32
+		EnterCriticalSection(&mcaQueueLocks[_iQueueIndex]);
+	#else
+		pthread_mutex_lock(&mcaQueueLocks[_iQueueIndex]);
+	#endif
+}
+
+// Unlocks the Thread's Queue so other Threads can use it
+void CJobSystem::UnlockQueue(int _iQueueIndex)
+{
+	#ifdef _WIN32
+		LeaveCriticalSection(&mcaQueueLocks[_iQueueIndex]);
+	#else
+		pthread_mutex_unlock(&mcaQueueLocks[_iQueueIndex]);
+	#endif
+}
+
+// Lets _iCount Threads waiting on the Semaphore continue
+void CJobSystem::SignalSemaphore(int _iSemaphore, int _iCount)
+{
+	#ifdef _WIN32
+		ReleaseSemaphore(mhaSemaphores[_iSemaphore], _iCount, NULL);
+	#else
+		for (int iIndex = 0; iIndex < _iCount; iIndex++)
+		{
+			sem_post(&mhaSemaphores[_iSemaphore]);
+		}
+	#endif
+}
+
+// Waits until the Semaphore is Signalled
+void CJobSystem::WaitForSemaphore(int _iSemaphore)
+{
+	#ifdef _WIN32
+		WaitForSingleObject(mhaSemaphores[_iSemaphore], INFINITE);
+	#else
+		// Keep waiting if the wait was interrupted by a signal
+		while (sem_wait(&mhaSemaphores[_iSemaphore]) != 0)
+		{}
+	#endif
+}
+
+// Records that a Chunk finished and returns how many are still left
+int CJobSystem::DecrementNumberOfChunksRemaining()
+{
+	#ifdef _WIN32
+		return (int)InterlockedDecrement(&mlNumberOfChunksRemaining);
+	#else
+		return (int)__sync_sub_and_fetch(&mlNumberOfChunksRemaining, 1);
+	#endif
+}
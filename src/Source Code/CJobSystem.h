@@ -0,0 +1,140 @@
+/////////////////////////////////////////////////////////////////////
+// CJobSystem.h (and CJobSystem.cpp)
+// Written by Daniel Schroeder
+// Created on October 17, 2026
+// Last Updated October 17, 2026
+//-------------------------------------------------------------------
+//   The CJobSystem class runs a Job over a range of items (usually
+// Objects) using a Thread on every processor. ParallelFor() splits the
+// range into Chunks and hands them out evenly to each Thread's Queue
+// (the calling Thread is Thread 0 and does work too). When a Thread
+// runs out of Chunks it steals them from the other Threads' Queues, so
+// the Threads stay busy even when some Chunks take longer than others.
+//   ParallelFor() does not return until every Chunk has been run, so
+// anything the Jobs wrote can be used right after it returns.
+//   Example:
+//		static void UpdateJob(void* _vpData, int _iStart, int _iEnd, int _iThread)
+//		{	for (int i = _iStart; i < _iEnd; i++) ((CObject*)_vpData)[i].Update(...); }
+//		cJobSystem.ParallelFor(iNumberOfObjects, 16, UpdateJob, caObjects);
+// NOTE: ParallelFor() must only be called from the Thread that called
+//		 Start(), and must not be called from inside a Job.
+// NOTE: Jobs must not write to anything another Chunk may read or write
+//		 (e.g. each Chunk only writes to its own items), and must not
+//		 create or destroy Ogre Scene Nodes or Entities.
+/////////////////////////////////////////////////////////////////////
+
+#ifndef CJOB_SYSTEM_H
+#define CJOB_SYSTEM_H
+
+#ifdef _WIN32
+	#include <windows.h>	// Needed for Threads, Critical Sections, and Semaphores
+#else
+	#include <pthread.h>	// Needed for Threads and Mutexes when not running on Windows
+	#include <semaphore.h>	// Needed for Semaphores when not running on Windows
+#endif
+#include <deque>
+#include <vector>
+using namespace std;
+
+// Most Threads the Job System will use
+const int GiMAX_NUMBER_OF_JOB_THREADS = 64;
+
+// Function run on each Chunk of a ParallelFor(); it should handle items _iStartIndex to _iEndIndex - 1.
+// _iThreadIndex (0 to ReturnNumberOfThreads() - 1) tells which Thread is running it, so each Thread can use its own scratch data
+typedef void (*JobFunction)(void* _vpData, int _iStartIndex, int _iEndIndex, int _iThreadIndex);
+
+class CJobSystem
+{
+public:
+
+	//---------- Contructors and Setup Functions ----------
+
+	CJobSystem();										// Default Constructor
+	~CJobSystem();										// Destructor
+
+	// Creates the worker Threads. _iNumberOfThreads includes the calling Thread (0 uses one Thread per processor,
+	//	1 runs everything on the calling Thread). Returns false if the Threads could not be created
+	bool Start(int _iNumberOfThreads = 0);
+
+	// Stops and destroys the worker Threads
+	void Stop();
+
+	// Returns how many Threads are used to run Jobs (including the calling Thread)
+	int ReturnNumberOfThreads() const;
+
+	// Returns how many processors this computer has
+	static int ReturnNumberOfProcessors();
+
+
+	//---------- Job Functions ----------
+
+	// Runs the Job on items 0 to _iNumberOfItems - 1, split into Chunks of _iChunkSize items, across all Threads
+	// NOTE: Does not return until the Job has been run on every item
+	void ParallelFor(int _iNumberOfItems, int _iChunkSize, JobFunction _pJobFunction, void* _vpData);
+
+	// Returns how many Chunks have been stolen from another Thread's Queue since the Job System was Started
+	unsigned long ReturnNumberOfChunksStolen() const;
+
+private:
+
+	// Holds one Chunk of a ParallelFor()
+	struct SJobChunk
+	{
+		JobFunction pJobFunction;	// The Job to run
+		void* vpData;				// The data to pass to the Job
+		int iStartIndex;			// The first item in the Chunk
+		int iEndIndex;				// One past the last item in the Chunk
+	};
+
+	// Holds what a worker Thread needs to know when it starts
+	struct SThreadInfo
+	{
+		CJobSystem* cpJobSystem;	// The Job System the Thread belongs to
+		int iThreadIndex;			// The Thread's Index (1 and up, the calling Thread is 0)
+	};
+
+	// The function each worker Thread runs until the Job System is Stopped
+	#ifdef _WIN32
+		static unsigned int __stdcall WorkerThread(void* _vpThreadInfo);
+	#else
+		static void* WorkerThread(void* _vpThreadInfo);
+	#endif
+
+	// Runs Chunks (from the Thread's own Queue first, then stolen from the others) until there are none left
+	void RunChunks(int _iThreadIndex);
+
+	// Takes a Chunk from the back of the Thread's own Queue, or the front of another Thread's Queue
+	// Returns false if there are no Chunks left in any Queue
+	bool TakeChunk(int _iThreadIndex, SJobChunk& _sChunk);
+
+	// Platform specific Locking and Signalling functions
+	void LockQueue(int _iQueueIndex);
+	void UnlockQueue(int _iQueueIndex);
+	void SignalSemaphore(int _iSemaphore, int _iCount);
+	void WaitForSemaphore(int _iSemaphore);
+	int DecrementNumberOfChunksRemaining();
+
+	// Semaphores
+	enum { eWorkAvailable = 0, eAllChunksDone = 1 };
+
+	int miNumberOfThreads;								// How many Threads run Jobs (including the calling Thread)
+	bool mbStarted;										// Tells if the worker Threads and Semaphores have been created
+	volatile bool mbStopping;							// Tells the worker Threads to exit
+	vector< deque<SJobChunk> > mcQueueList;				// Each Thread's Queue of Chunks
+	SThreadInfo msaThreadInfo[GiMAX_NUMBER_OF_JOB_THREADS];	// Info passed to each worker Thread
+
+	volatile long mlNumberOfChunksRemaining;			// How many Chunks of the current ParallelFor() have not finished
+	volatile long mlNumberOfChunksStolen;				// How many Chunks have been stolen
+
+	#ifdef _WIN32
+		HANDLE mhaThreads[GiMAX_NUMBER_OF_JOB_THREADS];						// The worker Threads
+		CRITICAL_SECTION mcaQueueLocks[GiMAX_NUMBER_OF_JOB_THREADS];		// Lock for each Thread's Queue
+		HANDLE mhaSemaphores[2];											// Work Available and All Chunks Done Semaphores
+	#else
+		pthread_t mhaThreads[GiMAX_NUMBER_OF_JOB_THREADS];					// The worker Threads
+		pthread_mutex_t mcaQueueLocks[GiMAX_NUMBER_OF_JOB_THREADS];			// Lock for each Thread's Queue
+		sem_t mhaSemaphores[2];												// Work Available and All Chunks Done Semaphores
+	#endif
+};
+
+#endif
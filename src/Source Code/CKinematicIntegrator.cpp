@@ -0,0 +1,591 @@
+#include "CKinematicIntegrator.h"
+#include "CObject.h"
+#include <cmath>			// Needed for sqrtf() function
+
+#ifdef KINEMATIC_INTEGRATOR_USE_SSE
+	#include <xmmintrin.h>	// Needed for SSE intrinsics
+#endif
+
+// Vectors shorter than this are not normalised (same as Ogre's Vector3::normalise())
+const float GfINTEGRATOR_MINIMUM_LENGTH_TO_NORMALISE = 1e-08f;
+
+
+/////////////////////////////////////////////////////////////////////
+// Local Helper Functions
+
+// Slows the Velocity towards zero by the Friction Impact, without letting it change direction (same as CObject::Update())
+static float ApplyFrictionScalar(float _fVelocity, float _fFrictionImpact)
+{
+	// If moving in the positive direction, slow down but don't go past zero
+	if (_fVelocity > 0.0f)
+	{
+		_fVelocity -= _fFrictionImpact;
+		if (_fVelocity < 0.0f)
+		{
+			_fVelocity = 0.0f;
+		}
+	}
+	// Else if moving in the negative direction, slow down but don't go past zero
+	else if (_fVelocity < 0.0f)
+	{
+		_fVelocity += _fFrictionImpact;
+		if (_fVelocity > 0.0f)
+		{
+			_fVelocity = 0.0f;
+		}
+	}
+
+	return _fVelocity;
+}
+
+#ifdef KINEMATIC_INTEGRATOR_USE_SSE
+// Returns _sIfTrue in the lanes where the Mask is set, and _sIfFalse in the others
+static inline __m128 SelectSSE(__m128 _sMask, __m128 _sIfTrue, __m128 _sIfFalse)
+{
+	return _mm_or_ps(_mm_and_ps(_sMask, _sIfTrue), _mm_andnot_ps(_sMask, _sIfFalse));
+}
+
+// Slows the 4 Velocities towards zero by the Friction Impacts, without letting them change direction
+static inline __m128 ApplyFrictionSSE(__m128 _sVelocity, __m128 _sFrictionImpact)
+{
+	__m128 sZero = _mm_setzero_ps();
+	__m128 sSlowedPositive = _mm_max_ps(_mm_sub_ps(_sVelocity, _sFrictionImpact), sZero);
+	__m128 sSlowedNegative = _mm_min_ps(_mm_add_ps(_sVelocity, _sFrictionImpact), sZero);
+
+	// Velocities which are zero are left alone
+	return SelectSSE(_mm_cmpgt_ps(_sVelocity, sZero), sSlowedPositive,
+					 SelectSSE(_mm_cmplt_ps(_sVelocity, sZero), sSlowedNegative, _sVelocity));
+}
+#endif
+
+
+
+//---------- Contructors and Setup Functions ----------
+
+// Default Constructor
+CKinematicIntegrator::CKinematicIntegrator()
+{
+	// Use SSE by default
+	mbUseSIMD = true;
+
+	// Don't keep the Objects inside of any box until one is given
+	msMinimum = Ogre::Vector3(-Ogre::Math::POS_INFINITY, -Ogre::Math::POS_INFINITY, -Ogre::Math::POS_INFINITY);
+	msMaximum = Ogre::Vector3(Ogre::Math::POS_INFINITY, Ogre::Math::POS_INFINITY, Ogre::Math::POS_INFINITY);
+
+	Purge();
+	ResetStatistics();
+}
+
+// Destructor
+CKinematicIntegrator::~CKinematicIntegrator()
+{
+	Purge();
+}
+
+// Removes all Objects from the Integrator (the arrays keep their memory so they do not need to be reallocated next Step)
+void CKinematicIntegrator::Purge()
+{
+	mcObjectList.clear();
+	msVelocityLists.Clear();
+	msRotationVelocityLists.Clear();
+	mcPositionXList.clear(); mcPositionYList.clear(); mcPositionZList.clear();
+	mcOldPositionXList.clear(); mcOldPositionYList.clear(); mcOldPositionZList.clear();
+	mcForceXList.clear(); mcForceYList.clear(); mcForceZList.clear();
+	mcOrientationWList.clear(); mcOrientationXList.clear(); mcOrientationYList.clear(); mcOrientationZList.clear();
+
+	miNumberOfObjects = 0;
+}
+
+// Set if SSE should be used to Integrate the Objects
+void CKinematicIntegrator::SetIfSIMDShouldBeUsed(bool _bUseSIMD)
+{
+	mbUseSIMD = _bUseSIMD;
+}
+
+// Return if SSE is being used to Integrate the Objects
+bool CKinematicIntegrator::ReturnIfSIMDIsBeingUsed() const
+{
+#ifdef KINEMATIC_INTEGRATOR_USE_SSE
+	return mbUseSIMD;
+#else
+	return false;
+#endif
+}
+
+// Sets the box the Objects must stay inside of
+void CKinematicIntegrator::SetBounds(Ogre::Vector3 _sMinimum, Ogre::Vector3 _sMaximum)
+{
+	msMinimum = _sMinimum;
+	msMaximum = _sMaximum;
+}
+
+
+
+//---------- Object Functions ----------
+
+// Returns if the Object can be Integrated here, or if it must be updated with CObject::Update()
+bool CKinematicIntegrator::ReturnIfObjectCanBeIntegrated(CObject const* _cpObject) const
+{
+	// If the Object is moving to or facing a Destination automatically, CObject::Update() has to track it
+	if (_cpObject->mbMoveToDestinationAutomatically || _cpObject->mbFaceDestinationAutomatically)
+	{
+		return false;
+	}
+
+	// If the Object was tracking something which has been Removed, CObject::Update() has to forget about it
+	if (!_cpObject->mbDestinationReached && !_cpObject->msCurrentDestination.ReturnIfValid())
+	{
+		return false;
+	}
+
+	// If any of the Objects External Forces are relative to the Object itself (they must be applied before it Rotates)
+	list<SExternalForce>::const_iterator cForceIterator;
+	for (cForceIterator = _cpObject->mcExternalForceList.begin(); cForceIterator != _cpObject->mcExternalForceList.end(); cForceIterator++)
+	{
+		if (cForceIterator->sTransformSpace == Ogre::Node::TS_LOCAL)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+// Copies the Objects Movement values into the Integrator and returns its Index (or -1 if it can't be Integrated here)
+int CKinematicIntegrator::AddObject(CObject* _cpObject)
+{
+	// If the Object must be updated with CObject::Update()
+	if (!ReturnIfObjectCanBeIntegrated(_cpObject))
+	{
+		mulNumberOfObjectsRejected++;
+		return -1;
+	}
+
+	// Read the Objects Movement values from its Kinematics and Transform Components
+	SKinematics const& sKinematics = *_cpObject->mspKinematics;
+	STransform const& sTransform = *_cpObject->mspTransform;
+
+	// Store the Objects Movement and Rotation Velocities (unused Accelerations and Frictions are stored as zero so they have no effect)
+	msVelocityLists.Add(sKinematics.sUnitVelocity * sKinematics.fSpeed,
+		sKinematics.bUseMovementAcceleration ? (sKinematics.sUnitAcceleration * sKinematics.fAccelerationRate) : Ogre::Vector3::ZERO,
+		sKinematics.bUseMovementFriction ? sKinematics.fFriction : 0.0f,
+		sKinematics.fMinVelocity, sKinematics.fMaxVelocity);
+	msRotationVelocityLists.Add(sKinematics.sUnitRotationVelocity * sKinematics.fRotationSpeed,
+		sKinematics.bUseRotationAcceleration ? (sKinematics.sUnitRotationAcceleration * sKinematics.fRotationAccelerationRate) : Ogre::Vector3::ZERO,
+		sKinematics.bUseRotationFriction ? sKinematics.fRotationFriction : 0.0f,
+		sKinematics.fMinRotationVelocity, sKinematics.fMaxRotationVelocity);
+
+	// Store the Objects Position (its Orientation is stored once it has Rotated)
+	Ogre::Vector3 sPosition = sTransform.sPosition;
+	mcPositionXList.push_back(sPosition.x);
+	mcPositionYList.push_back(sPosition.y);
+	mcPositionZList.push_back(sPosition.z);
+	mcOldPositionXList.push_back(sPosition.x);
+	mcOldPositionYList.push_back(sPosition.y);
+	mcOldPositionZList.push_back(sPosition.z);
+	mcOrientationWList.push_back(1.0f);
+	mcOrientationXList.push_back(0.0f);
+	mcOrientationYList.push_back(0.0f);
+	mcOrientationZList.push_back(0.0f);
+
+	// Add up the Objects External Forces
+	Ogre::Vector3 sForce = Ogre::Vector3::ZERO;
+	list<SExternalForce>::const_iterator cForceIterator;
+	for (cForceIterator = _cpObject->mcExternalForceList.begin(); cForceIterator != _cpObject->mcExternalForceList.end(); cForceIterator++)
+	{
+		sForce += cForceIterator->sForce;
+	}
+	mcForceXList.push_back(sForce.x);
+	mcForceYList.push_back(sForce.y);
+	mcForceZList.push_back(sForce.z);
+
+	mcObjectList.push_back(_cpObject);
+	return miNumberOfObjects++;
+}
+
+// Returns how many Objects are in the Integrator
+int CKinematicIntegrator::ReturnNumberOfObjects() const
+{
+	return miNumberOfObjects;
+}
+
+// Returns the Object at the given Index
+CObject* CKinematicIntegrator::ReturnObject(int _iIndex) const
+{
+	return mcObjectList[_iIndex];
+}
+
+
+
+//---------- Integration Functions ----------
+
+// Moves and Rotates every Object in the Integrator, and writes their new Position and Velocities back to them
+void CKinematicIntegrator::Integrate(float _fTimeStep)
+{
+	int iIndex = 0;
+
+	// If there is nothing to Integrate
+	if (miNumberOfObjects == 0)
+	{
+		return;
+	}
+
+	// Find if SSE should be used this Step
+	bool bUseSIMD = ReturnIfSIMDIsBeingUsed();
+	if (bUseSIMD)
+	{
+		// Pad the arrays so every group of 4 Objects is complete
+		PadArraysToMultipleOfFour();
+	}
+
+
+	//---------- Update the Velocities ----------
+
+#ifdef KINEMATIC_INTEGRATOR_USE_SSE
+	// If SSE should be used, update the Velocities of 4 Objects at a time
+	if (bUseSIMD)
+	{
+		for (iIndex = 0; iIndex < miNumberOfObjects; iIndex += 4)
+		{
+			IntegrateVelocitySIMD(msVelocityLists, iIndex, _fTimeStep);
+			IntegrateVelocitySIMD(msRotationVelocityLists, iIndex, _fTimeStep);
+		}
+	}
+	else
+#endif
+	{
+		for (iIndex = 0; iIndex < miNumberOfObjects; iIndex++)
+		{
+			IntegrateVelocityScalar(msVelocityLists, iIndex, _fTimeStep);
+			IntegrateVelocityScalar(msRotationVelocityLists, iIndex, _fTimeStep);
+		}
+	}
+
+
+	//---------- Store the new Velocities and Rotate the Objects ----------
+
+	// NOTE: Few Objects Rotate on their own each Step (Fish are pointed in their new Direction by their AI), so this is done one Object at a time
+	for (iIndex = 0; iIndex < miNumberOfObjects; iIndex++)
+	{
+		CObject* cpObject = mcObjectList[iIndex];
+		SKinematics& sKinematics = *cpObject->mspKinematics;
+		Ogre::Vector3 sRotationVelocity = msRotationVelocityLists.ReturnVelocity(iIndex);
+
+		// Record how much time passed between the last two Updates
+		sKinematics.fDurationSinceLastUpdateInSeconds = _fTimeStep;
+
+		// Set the Objects new Velocities
+		sKinematics.sUnitVelocity = msVelocityLists.ReturnVelocity(iIndex);
+		sKinematics.fSpeed = sKinematics.sUnitVelocity.normalise();
+		sKinematics.sUnitRotationVelocity = sRotationVelocity;
+		sKinematics.fRotationSpeed = sKinematics.sUnitRotationVelocity.normalise();
+
+		// Rotate the Object (in the same order as CObject::Update())
+		if (sRotationVelocity.y != 0.0f)
+		{
+			cpObject->Yaw(Ogre::Degree(sRotationVelocity.y * _fTimeStep), sKinematics.sYawRelativeTo);
+		}
+		if (sRotationVelocity.x != 0.0f)
+		{
+			cpObject->Pitch(Ogre::Degree(sRotationVelocity.x * _fTimeStep), sKinematics.sPitchRelativeTo);
+		}
+		if (sRotationVelocity.z != 0.0f)
+		{
+			cpObject->Roll(Ogre::Degree(sRotationVelocity.z * _fTimeStep), sKinematics.sRollRelativeTo);
+		}
+
+		// If the Object moves relative to itself, store its new Orientation to move it relative to
+		if (sKinematics.sTranslationRelativeTo == Ogre::Node::TS_LOCAL)
+		{
+			Ogre::Quaternion sOrientation = cpObject->mspTransform->sOrientation;
+			mcOrientationWList[iIndex] = sOrientation.w;
+			mcOrientationXList[iIndex] = sOrientation.x;
+			mcOrientationYList[iIndex] = sOrientation.y;
+			mcOrientationZList[iIndex] = sOrientation.z;
+		}
+	}
+
+
+	//---------- Move the Objects ----------
+
+#ifdef KINEMATIC_INTEGRATOR_USE_SSE
+	// If SSE should be used, move 4 Objects at a time
+	if (bUseSIMD)
+	{
+		for (iIndex = 0; iIndex < miNumberOfObjects; iIndex += 4)
+		{
+			MoveObjectSIMD(iIndex, _fTimeStep);
+		}
+	}
+	else
+#endif
+	{
+		for (iIndex = 0; iIndex < miNumberOfObjects; iIndex++)
+		{
+			MoveObjectScalar(iIndex, _fTimeStep);
+		}
+	}
+
+	// Store the Objects new Positions and update their animations
+	for (iIndex = 0; iIndex < miNumberOfObjects; iIndex++)
+	{
+		CObject* cpObject = mcObjectList[iIndex];
+		cpObject->mspTransform->sPosition = Ogre::Vector3(mcPositionXList[iIndex], mcPositionYList[iIndex], mcPositionZList[iIndex]);
+
+		// If this Object has an animation which is enabled right now
+		if (cpObject->mcpAnimationState != NULL && cpObject->mcpAnimationState->getEnabled())
+		{
+			// Update the animation
+			cpObject->mcpAnimationState->addTime(_fTimeStep);
+		}
+	}
+
+	// Record how many Objects were Integrated
+	mulNumberOfObjectsIntegrated += miNumberOfObjects;
+}
+
+
+
+//---------- Statistics Functions ----------
+
+// Resets the Statistics
+void CKinematicIntegrator::ResetStatistics()
+{
+	mulNumberOfObjectsIntegrated = 0;
+	mulNumberOfObjectsRejected = 0;
+}
+
+// Returns how many Objects were Integrated here since the last Reset
+unsigned long CKinematicIntegrator::ReturnNumberOfObjectsIntegrated() const
+{
+	return mulNumberOfObjectsIntegrated;
+}
+
+// Returns how many Objects had to use CObject::Update() since the last Reset
+unsigned long CKinematicIntegrator::ReturnNumberOfObjectsRejected() const
+{
+	return mulNumberOfObjectsRejected;
+}
+
+
+
+//---------- Private Functions ----------
+
+// Removes all entries
+void CKinematicIntegrator::SVelocityLists::Clear()
+{
+	cXList.clear(); cYList.clear(); cZList.clear();
+	cAccelerationXList.clear(); cAccelerationYList.clear(); cAccelerationZList.clear();
+	cFrictionList.clear();
+	cMinSpeedList.clear(); cMaxSpeedList.clear();
+}
+
+// Adds an entry
+void CKinematicIntegrator::SVelocityLists::Add(Ogre::Vector3 _sVelocity, Ogre::Vector3 _sAcceleration, float _fFriction, float _fMinSpeed, float _fMaxSpeed)
+{
+	cXList.push_back(_sVelocity.x);
+	cYList.push_back(_sVelocity.y);
+	cZList.push_back(_sVelocity.z);
+	cAccelerationXList.push_back(_sAcceleration.x);
+	cAccelerationYList.push_back(_sAcceleration.y);
+	cAccelerationZList.push_back(_sAcceleration.z);
+	cFrictionList.push_back(_fFriction);
+	cMinSpeedList.push_back(_fMinSpeed);
+	cMaxSpeedList.push_back(_fMaxSpeed);
+}
+
+// Pads the lists with entries which don't move so their size is _uiSize
+void CKinematicIntegrator::SVelocityLists::Resize(unsigned int _uiSize)
+{
+	cXList.resize(_uiSize, 0.0f); cYList.resize(_uiSize, 0.0f); cZList.resize(_uiSize, 0.0f);
+	cAccelerationXList.resize(_uiSize, 0.0f); cAccelerationYList.resize(_uiSize, 0.0f); cAccelerationZList.resize(_uiSize, 0.0f);
+	cFrictionList.resize(_uiSize, 0.0f);
+	cMinSpeedList.resize(_uiSize, 0.0f); cMaxSpeedList.resize(_uiSize, 0.0f);
+}
+
+// Returns the Velocity at the given Index
+Ogre::Vector3 CKinematicIntegrator::SVelocityLists::ReturnVelocity(int _iIndex) const
+{
+	return Ogre::Vector3(cXList[_iIndex], cYList[_iIndex], cZList[_iIndex]);
+}
+
+// Updates the Velocities of a single Object without using SSE
+// NOTE: Any change made here must also be made in IntegrateVelocitySIMD() (in the same order) so the results stay the same
+void CKinematicIntegrator::IntegrateVelocityScalar(SVelocityLists& _sLists, int _iIndex, float _fTimeStep)
+{
+	// Calculate the new Velocity from the Acceleration
+	// Acceleration = (Vfinal - Vinitial) / Time   =>  Vfinal = (A * T) + Vinitial
+	float fX = (_sLists.cAccelerationXList[_iIndex] * _fTimeStep) + _sLists.cXList[_iIndex];
+	float fY = (_sLists.cAccelerationYList[_iIndex] * _fTimeStep) + _sLists.cYList[_iIndex];
+	float fZ = (_sLists.cAccelerationZList[_iIndex] * _fTimeStep) + _sLists.cZList[_iIndex];
+
+	// Slow down each axis by the Friction
+	float fFrictionImpact = _sLists.cFrictionList[_iIndex] * _fTimeStep;
+	fX = ApplyFrictionScalar(fX, fFrictionImpact);
+	fY = ApplyFrictionScalar(fY, fFrictionImpact);
+	fZ = ApplyFrictionScalar(fZ, fFrictionImpact);
+
+	// If the Object is moving too fast or too slow, make it move at its Max or Min Speed
+	float fLength = sqrtf((fX * fX) + (fY * fY) + (fZ * fZ));
+	float fMaxSpeed = _sLists.cMaxSpeedList[_iIndex];
+	float fMinSpeed = _sLists.cMinSpeedList[_iIndex];
+	if (fLength > fMaxSpeed || fLength < fMinSpeed)
+	{
+		float fNewSpeed = (fLength > fMaxSpeed) ? fMaxSpeed : fMinSpeed;
+
+		// Only normalise if the Velocity is long enough (same as Ogre's Vector3::normalise())
+		if (fLength > GfINTEGRATOR_MINIMUM_LENGTH_TO_NORMALISE)
+		{
+			float fInverseLength = 1.0f / fLength;
+			fX *= fInverseLength;
+			fY *= fInverseLength;
+			fZ *= fInverseLength;
+		}
+		fX *= fNewSpeed;
+		fY *= fNewSpeed;
+		fZ *= fNewSpeed;
+	}
+
+	_sLists.cXList[_iIndex] = fX;
+	_sLists.cYList[_iIndex] = fY;
+	_sLists.cZList[_iIndex] = fZ;
+}
+
+// Updates the Velocities of the 4 Objects starting at the given Index using SSE
+// NOTE: Any change made here must also be made in IntegrateVelocityScalar() (in the same order) so the results stay the same
+void CKinematicIntegrator::IntegrateVelocitySIMD(SVelocityLists& _sLists, int _iFirstIndex, float _fTimeStep)
+{
+#ifdef KINEMATIC_INTEGRATOR_USE_SSE
+	int iIndex = _iFirstIndex;
+	__m128 sTimeStep = _mm_set1_ps(_fTimeStep);
+
+	// Calculate the new Velocities from the Accelerations
+	__m128 sX = _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(&_sLists.cAccelerationXList[iIndex]), sTimeStep), _mm_loadu_ps(&_sLists.cXList[iIndex]));
+	__m128 sY = _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(&_sLists.cAccelerationYList[iIndex]), sTimeStep), _mm_loadu_ps(&_sLists.cYList[iIndex]));
+	__m128 sZ = _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(&_sLists.cAccelerationZList[iIndex]), sTimeStep), _mm_loadu_ps(&_sLists.cZList[iIndex]));
+
+	// Slow down each axis by the Friction
+	__m128 sFrictionImpact = _mm_mul_ps(_mm_loadu_ps(&_sLists.cFrictionList[iIndex]), sTimeStep);
+	sX = ApplyFrictionSSE(sX, sFrictionImpact);
+	sY = ApplyFrictionSSE(sY, sFrictionImpact);
+	sZ = ApplyFrictionSSE(sZ, sFrictionImpact);
+
+	// Find which Objects are moving too fast or too slow
+	__m128 sLength = _mm_sqrt_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(sX, sX), _mm_mul_ps(sY, sY)), _mm_mul_ps(sZ, sZ)));
+	__m128 sMaxSpeed = _mm_loadu_ps(&_sLists.cMaxSpeedList[iIndex]);
+	__m128 sMinSpeed = _mm_loadu_ps(&_sLists.cMinSpeedList[iIndex]);
+	__m128 sTooFast = _mm_cmpgt_ps(sLength, sMaxSpeed);
+	__m128 sOutOfRange = _mm_or_ps(sTooFast, _mm_cmplt_ps(sLength, sMinSpeed));
+	__m128 sNewSpeed = SelectSSE(sTooFast, sMaxSpeed, sMinSpeed);
+
+	// Normalise the Velocities which are long enough, then make them move at their Max or Min Speed
+	__m128 sLongEnough = _mm_cmpgt_ps(sLength, _mm_set1_ps(GfINTEGRATOR_MINIMUM_LENGTH_TO_NORMALISE));
+	__m128 sInverseLength = _mm_div_ps(_mm_set1_ps(1.0f), sLength);
+	__m128 sClampedX = _mm_mul_ps(SelectSSE(sLongEnough, _mm_mul_ps(sX, sInverseLength), sX), sNewSpeed);
+	__m128 sClampedY = _mm_mul_ps(SelectSSE(sLongEnough, _mm_mul_ps(sY, sInverseLength), sY), sNewSpeed);
+	__m128 sClampedZ = _mm_mul_ps(SelectSSE(sLongEnough, _mm_mul_ps(sZ, sInverseLength), sZ), sNewSpeed);
+
+	// Only use the clamped Velocities for the Objects which were out of range
+	_mm_storeu_ps(&_sLists.cXList[iIndex], SelectSSE(sOutOfRange, sClampedX, sX));
+	_mm_storeu_ps(&_sLists.cYList[iIndex], SelectSSE(sOutOfRange, sClampedY, sY));
+	_mm_storeu_ps(&_sLists.cZList[iIndex], SelectSSE(sOutOfRange, sClampedZ, sZ));
+#endif
+}
+
+// Moves a single Object and keeps it inside the Bounds without using SSE
+// NOTE: Any change made here must also be made in MoveObjectSIMD() (in the same order) so the results stay the same
+void CKinematicIntegrator::MoveObjectScalar(int _iIndex, float _fTimeStep)
+{
+	int iIndex = _iIndex;
+
+	// Find how far the Object moves this Step (relative to its Orientation, which is the identity if it moves in world space)
+	Ogre::Vector3 sDistance = msVelocityLists.ReturnVelocity(iIndex) * _fTimeStep;
+	Ogre::Quaternion sOrientation(mcOrientationWList[iIndex], mcOrientationXList[iIndex], mcOrientationYList[iIndex], mcOrientationZList[iIndex]);
+
+	// Apply the External Forces, then move the Object
+	Ogre::Vector3 sPosition(mcPositionXList[iIndex], mcPositionYList[iIndex], mcPositionZList[iIndex]);
+	sPosition += Ogre::Vector3(mcForceXList[iIndex], mcForceYList[iIndex], mcForceZList[iIndex]) * _fTimeStep;
+	sPosition += sOrientation * sDistance;
+
+	// If the Object has gone past the Bounds along an axis, move it back to where it was along that axis
+	if (sPosition.x < msMinimum.x || sPosition.x > msMaximum.x)
+	{
+		sPosition.x = mcOldPositionXList[iIndex];
+	}
+	if (sPosition.y < msMinimum.y || sPosition.y > msMaximum.y)
+	{
+		sPosition.y = mcOldPositionYList[iIndex];
+	}
+	if (sPosition.z < msMinimum.z || sPosition.z > msMaximum.z)
+	{
+		sPosition.z = mcOldPositionZList[iIndex];
+	}
+
+	mcPositionXList[iIndex] = sPosition.x;
+	mcPositionYList[iIndex] = sPosition.y;
+	mcPositionZList[iIndex] = sPosition.z;
+}
+
+// Moves the 4 Objects starting at the given Index and keeps them inside the Bounds using SSE
+// NOTE: Any change made here must also be made in MoveObjectScalar() (in the same order) so the results stay the same
+void CKinematicIntegrator::MoveObjectSIMD(int _iFirstIndex, float _fTimeStep)
+{
+#ifdef KINEMATIC_INTEGRATOR_USE_SSE
+	int iIndex = _iFirstIndex;
+	__m128 sTimeStep = _mm_set1_ps(_fTimeStep);
+	__m128 sTwo = _mm_set1_ps(2.0f);
+
+	// Find how far the Objects move this Step
+	__m128 sDistanceX = _mm_mul_ps(_mm_loadu_ps(&msVelocityLists.cXList[iIndex]), sTimeStep);
+	__m128 sDistanceY = _mm_mul_ps(_mm_loadu_ps(&msVelocityLists.cYList[iIndex]), sTimeStep);
+	__m128 sDistanceZ = _mm_mul_ps(_mm_loadu_ps(&msVelocityLists.cZList[iIndex]), sTimeStep);
+
+	// Rotate the Distances by the Objects Orientations (same as Ogre's Quaternion * Vector3)
+	// uv = q x v, uuv = q x uv, result = v + (uv * 2w) + (uuv * 2)
+	__m128 sQW = _mm_loadu_ps(&mcOrientationWList[iIndex]);
+	__m128 sQX = _mm_loadu_ps(&mcOrientationXList[iIndex]);
+	__m128 sQY = _mm_loadu_ps(&mcOrientationYList[iIndex]);
+	__m128 sQZ = _mm_loadu_ps(&mcOrientationZList[iIndex]);
+	__m128 sUVX = _mm_sub_ps(_mm_mul_ps(sQY, sDistanceZ), _mm_mul_ps(sQZ, sDistanceY));
+	__m128 sUVY = _mm_sub_ps(_mm_mul_ps(sQZ, sDistanceX), _mm_mul_ps(sQX, sDistanceZ));
+	__m128 sUVZ = _mm_sub_ps(_mm_mul_ps(sQX, sDistanceY), _mm_mul_ps(sQY, sDistanceX));
+	__m128 sUUVX = _mm_sub_ps(_mm_mul_ps(sQY, sUVZ), _mm_mul_ps(sQZ, sUVY));
+	__m128 sUUVY = _mm_sub_ps(_mm_mul_ps(sQZ, sUVX), _mm_mul_ps(sQX, sUVZ));
+	__m128 sUUVZ = _mm_sub_ps(_mm_mul_ps(sQX, sUVY), _mm_mul_ps(sQY, sUVX));
+	__m128 sTwoW = _mm_mul_ps(sTwo, sQW);
+	sDistanceX = _mm_add_ps(_mm_add_ps(sDistanceX, _mm_mul_ps(sUVX, sTwoW)), _mm_mul_ps(sUUVX, sTwo));
+	sDistanceY = _mm_add_ps(_mm_add_ps(sDistanceY, _mm_mul_ps(sUVY, sTwoW)), _mm_mul_ps(sUUVY, sTwo));
+	sDistanceZ = _mm_add_ps(_mm_add_ps(sDistanceZ, _mm_mul_ps(sUVZ, sTwoW)), _mm_mul_ps(sUUVZ, sTwo));
+
+	// Apply the External Forces, then move the Objects
+	__m128 sX = _mm_add_ps(_mm_loadu_ps(&mcPositionXList[iIndex]), _mm_mul_ps(_mm_loadu_ps(&mcForceXList[iIndex]), sTimeStep));
+	__m128 sY = _mm_add_ps(_mm_loadu_ps(&mcPositionYList[iIndex]), _mm_mul_ps(_mm_loadu_ps(&mcForceYList[iIndex]), sTimeStep));
+	__m128 sZ = _mm_add_ps(_mm_loadu_ps(&mcPositionZList[iIndex]), _mm_mul_ps(_mm_loadu_ps(&mcForceZList[iIndex]), sTimeStep));
+	sX = _mm_add_ps(sX, sDistanceX);
+	sY = _mm_add_ps(sY, sDistanceY);
+	sZ = _mm_add_ps(sZ, sDistanceZ);
+
+	// If an Object has gone past the Bounds along an axis, move it back to where it was along that axis
+	__m128 sOutOfBoundsX = _mm_or_ps(_mm_cmplt_ps(sX, _mm_set1_ps(msMinimum.x)), _mm_cmpgt_ps(sX, _mm_set1_ps(msMaximum.x)));
+	__m128 sOutOfBoundsY = _mm_or_ps(_mm_cmplt_ps(sY, _mm_set1_ps(msMinimum.y)), _mm_cmpgt_ps(sY, _mm_set1_ps(msMaximum.y)));
+	__m128 sOutOfBoundsZ = _mm_or_ps(_mm_cmplt_ps(sZ, _mm_set1_ps(msMinimum.z)), _mm_cmpgt_ps(sZ, _mm_set1_ps(msMaximum.z)));
+	_mm_storeu_ps(&mcPositionXList[iIndex], SelectSSE(sOutOfBoundsX, _mm_loadu_ps(&mcOldPositionXList[iIndex]), sX));
+	_mm_storeu_ps(&mcPositionYList[iIndex], SelectSSE(sOutOfBoundsY, _mm_loadu_ps(&mcOldPositionYList[iIndex]), sY));
+	_mm_storeu_ps(&mcPositionZList[iIndex], SelectSSE(sOutOfBoundsZ, _mm_loadu_ps(&mcOldPositionZList[iIndex]), sZ));
+#endif
+}
+
+// Pads the arrays with Objects which don't move so their size is a multiple of 4
+void CKinematicIntegrator::PadArraysToMultipleOfFour()
+{
+	unsigned int uiPaddedSize = (unsigned int)((miNumberOfObjects + 3) & ~3);
+
+	// Padding Objects have no Velocity, Force, or Speed limits, and the identity Orientation
+	msVelocityLists.Resize(uiPaddedSize);
+	msRotationVelocityLists.Resize(uiPaddedSize);
+	mcPositionXList.resize(uiPaddedSize, 0.0f); mcPositionYList.resize(uiPaddedSize, 0.0f); mcPositionZList.resize(uiPaddedSize, 0.0f);
+	mcOldPositionXList.resize(uiPaddedSize, 0.0f); mcOldPositionYList.resize(uiPaddedSize, 0.0f); mcOldPositionZList.resize(uiPaddedSize, 0.0f);
+	mcForceXList.resize(uiPaddedSize, 0.0f); mcForceYList.resize(uiPaddedSize, 0.0f); mcForceZList.resize(uiPaddedSize, 0.0f);
+	mcOrientationWList.resize(uiPaddedSize, 1.0f);
+	mcOrientationXList.resize(uiPaddedSize, 0.0f); mcOrientationYList.resize(uiPaddedSize, 0.0f); mcOrientationZList.resize(uiPaddedSize, 0.0f);
+}
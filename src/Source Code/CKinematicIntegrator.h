@@ -0,0 +1,151 @@
+/////////////////////////////////////////////////////////////////////
+// CKinematicIntegrator.h (and CKinematicIntegrator.cpp)
+// Written by Daniel Schroeder
+// Created on October 17, 2026
+// Last Updated October 17, 2026
+//-------------------------------------------------------------------
+//   The CKinematicIntegrator class does the same work as CObject::Update()
+// for many Objects at once. Each Step the Objects Kinematics Components
+// (see SComponents.h) are copied into packed arrays (one array per value
+// instead of one Object per entry), then the
+// Acceleration, Friction, and Min/Max Speed clamps of their Velocity and
+// Rotation Velocity, their External Forces, their movement, and keeping
+// them inside the Bounds are all calculated for 4 Objects at a time using
+// SSE. Only rotating the Objects (which few of them do each Step) is done
+// one Object at a time.
+//   Only Objects which are controlling themselves can be Added (i.e. they
+// are not moving to or facing a Destination automatically) and whose
+// External Forces are all in world space. AddObject() returns -1 for any
+// other Object, and it should be updated with CObject::Update() instead.
+//   A scalar version of the same calculations is used when SSE is not
+// available (or turned off), and both match CObject::Update() to within
+// float rounding.
+//   Example:
+//		cIntegrator.Purge();
+//		... For each Object, if (cIntegrator.AddObject(cpObject) == -1) cpObject->Update(fTimeStep);
+//		cIntegrator.Integrate(fTimeStep);
+/////////////////////////////////////////////////////////////////////
+
+#ifndef CKINEMATIC_INTEGRATOR_H
+#define CKINEMATIC_INTEGRATOR_H
+
+class CObject;			// Objects are written back to after they are Integrated
+#include <Ogre.h>		// Include OGRE
+#include <vector>
+using namespace std;
+
+// Use SSE if the compiler is targeting a processor which has it
+#if defined(_M_IX86) || defined(_M_X64) || defined(__SSE__)
+	#define KINEMATIC_INTEGRATOR_USE_SSE
+#endif
+
+class CKinematicIntegrator
+{
+public:
+
+	//---------- Contructors and Setup Functions ----------
+
+	CKinematicIntegrator();								// Default Constructor
+	~CKinematicIntegrator();							// Destructor
+
+	// Removes all Objects from the Integrator (should be done at the start of each Step)
+	void Purge();
+
+	// Set/Return if SSE should be used to Integrate the Objects
+	// NOTE: SSE will not be used if it was not compiled in, even if set to true
+	void SetIfSIMDShouldBeUsed(bool _bUseSIMD = true);
+	bool ReturnIfSIMDIsBeingUsed() const;
+
+	// Sets the box the Objects must stay inside of
+	// NOTE: An Object which moves outside of the box along an axis is put back where it was along that axis (same as UpdateObjects() does)
+	void SetBounds(Ogre::Vector3 _sMinimum, Ogre::Vector3 _sMaximum);
+
+
+	//---------- Object Functions ----------
+
+	// Returns if the Object can be Integrated here, or if it must be updated with CObject::Update()
+	bool ReturnIfObjectCanBeIntegrated(CObject const* _cpObject) const;
+
+	// Copies the Objects Movement values into the Integrator and returns its Index (or -1 if it can't be Integrated here)
+	int AddObject(CObject* _cpObject);
+
+	// Returns how many Objects are in the Integrator
+	int ReturnNumberOfObjects() const;
+
+	// Returns the Object at the given Index
+	CObject* ReturnObject(int _iIndex) const;
+
+
+	//---------- Integration Functions ----------
+
+	// Moves and Rotates every Object in the Integrator, and writes their new Position and Velocities back to them
+	void Integrate(float _fTimeStep);
+
+
+	//---------- Statistics Functions ----------
+
+	// Resets the Statistics
+	void ResetStatistics();
+
+	// Returns how many Objects were Integrated here, and how many had to use CObject::Update(), since the last Reset
+	unsigned long ReturnNumberOfObjectsIntegrated() const;
+	unsigned long ReturnNumberOfObjectsRejected() const;
+
+private:
+
+	// Holds the packed values of one of the Objects Velocities (Movement or Rotation)
+	struct SVelocityLists
+	{
+		vector<float> cXList, cYList, cZList;							// Velocity
+		vector<float> cAccelerationXList, cAccelerationYList, cAccelerationZList;	// Acceleration (zero if it is not being used)
+		vector<float> cFrictionList;									// Friction (zero if it is not being used)
+		vector<float> cMinSpeedList, cMaxSpeedList;						// Min and Max Speed
+
+		// Removes all entries
+		void Clear();
+
+		// Adds an entry
+		void Add(Ogre::Vector3 _sVelocity, Ogre::Vector3 _sAcceleration, float _fFriction, float _fMinSpeed, float _fMaxSpeed);
+
+		// Pads the lists with entries which don't move so their size is _uiSize
+		void Resize(unsigned int _uiSize);
+
+		// Returns the Velocity at the given Index
+		Ogre::Vector3 ReturnVelocity(int _iIndex) const;
+	};
+
+	// Updates the Velocities of a single Object without using SSE
+	void IntegrateVelocityScalar(SVelocityLists& _sLists, int _iIndex, float _fTimeStep);
+
+	// Updates the Velocities of the 4 Objects starting at the given Index using SSE
+	void IntegrateVelocitySIMD(SVelocityLists& _sLists, int _iFirstIndex, float _fTimeStep);
+
+	// Moves a single Object and keeps it inside the Bounds without using SSE
+	void MoveObjectScalar(int _iIndex, float _fTimeStep);
+
+	// Moves the 4 Objects starting at the given Index and keeps them inside the Bounds using SSE
+	void MoveObjectSIMD(int _iFirstIndex, float _fTimeStep);
+
+	// Pads the arrays with Objects which don't move so their size is a multiple of 4
+	void PadArraysToMultipleOfFour();
+
+	// Object Data (one entry per Object)
+	vector<CObject*> mcObjectList;										// Objects in the Integrator
+	SVelocityLists msVelocityLists;										// Objects Movement Velocity
+	SVelocityLists msRotationVelocityLists;								// Objects Rotation Velocity
+	vector<float> mcPositionXList, mcPositionYList, mcPositionZList;	// Objects Position
+	vector<float> mcOldPositionXList, mcOldPositionYList, mcOldPositionZList;	// Objects Position before it moved
+	vector<float> mcForceXList, mcForceYList, mcForceZList;				// Sum of the Objects External Forces (per second)
+	vector<float> mcOrientationWList, mcOrientationXList, mcOrientationYList, mcOrientationZList;	// Orientation to move the Object relative to (identity if not moving relative to itself)
+
+	int miNumberOfObjects;						// How many Objects are in the Integrator (not counting padding)
+
+	Ogre::Vector3 msMinimum, msMaximum;			// The box the Objects must stay inside of
+
+	unsigned long mulNumberOfObjectsIntegrated;	// Objects Integrated here since the last Reset
+	unsigned long mulNumberOfObjectsRejected;	// Objects which had to use CObject::Update() since the last Reset
+
+	bool mbUseSIMD;								// Tells if SSE should be used
+};
+
+#endif
@@ -1,7 +1,11 @@
 #include "CObject.h"
+#include "CWorldState.h"
 #include <cmath>		// Needed for floorf() function	
 using namespace std;
 
+// Initialize the World State (CGame gives it one)
+CWorldState const* CObject::SmcpWorldState = NULL;
+
 
 //---------- Contructors and Copy Functions ----------
 
@@ -46,7 +50,6 @@ void CObject::CopyFrom(CObject const& cObjectToCopyFrom)
 	mcpAnimationState = cObjectToCopyFrom.mcpAnimationState;
 	mcDestinationList = cObjectToCopyFrom.mcDestinationList;
 	mcExternalForceList = cObjectToCopyFrom.mcExternalForceList;
-	mcAttributes.CopyFrom(cObjectToCopyFrom.mcAttributes);
 	mcAIHelper.CopyFrom(cObjectToCopyFrom.mcAIHelper);
 
 	// Copy Private data
@@ -55,43 +58,11 @@ void CObject::CopyFrom(CObject const& cObjectToCopyFrom)
 	msMeshUpDirection = cObjectToCopyFrom.GetMeshesDefaultUpDirection();
 	msMeshRightDirection = cObjectToCopyFrom.GetMeshesDefaultRightDirection();
 
-	// Copy Movement data
-	msUnitVelocity = cObjectToCopyFrom.GetVelocityDirection();
-	msUnitAcceleration = cObjectToCopyFrom.GetAccelerationDirection();
-	mfSpeed = cObjectToCopyFrom.GetVelocitySpeed();
-	mfAccelerationRate = cObjectToCopyFrom.GetAccelerationRate();
-	mfFriction = cObjectToCopyFrom.GetFriction();
-	mfMinVelocity = cObjectToCopyFrom.GetMinVelocitySpeed();
-	mfMaxVelocity = cObjectToCopyFrom.GetMaxVelocitySpeed();
-	mfDefaultVelocity = cObjectToCopyFrom.GetDefaultVelocitySpeed();
-	mfMinAcceleration = cObjectToCopyFrom.GetMinAccelerationRate();
-	mfMaxAcceleration = cObjectToCopyFrom.GetMaxAccelerationRate();
-	mfDefaultAcceleration = cObjectToCopyFrom.GetDefaultAccelerationRate();
-	mbUseMovementAcceleration = cObjectToCopyFrom.GetIfMovementAccelerationIsBeingUsed();
-	mbUseMovementFriction = cObjectToCopyFrom.GetIfMovementFrictionIsBeingUsed();
-
-	msUnitRotationVelocity = cObjectToCopyFrom.GetRotationVelocityDirection();
-	msUnitRotationAcceleration = cObjectToCopyFrom.GetRotationAccelerationDirection();
-	mfRotationSpeed = cObjectToCopyFrom.GetRotationVelocitySpeed();
-	mfRotationAccelerationRate = cObjectToCopyFrom.GetRotationAccelerationRate();
-	mfRotationFriction = cObjectToCopyFrom.GetRotationFriction();;
-	mfMinRotationVelocity = cObjectToCopyFrom.GetMinRotationVelocitySpeed();
-	mfMaxRotationVelocity = cObjectToCopyFrom.GetMaxRotationVelocitySpeed();
-	mfDefaultRotationVelocity = cObjectToCopyFrom.GetDefaultRotationVelocitySpeed();
-	mfMinRotationAcceleration = cObjectToCopyFrom.GetMinRotationAccelerationRate();
-	mfMaxRotationAcceleration = cObjectToCopyFrom.GetMaxRotationAccelerationRate();
-	mfDefaultRotationAcceleration = cObjectToCopyFrom.GetDefaultRotationAccelerationRate();
-	mbUseRotationAcceleration = cObjectToCopyFrom.GetIfRotationAccelerationIsBeingUsed();
-	mbUseRotationFriction = cObjectToCopyFrom.GetIfRotationFrictionIsBeingUsed();
-
-	mTranslationRelativeTo = cObjectToCopyFrom.GetWhatTranslationIsRelativeTo();
-	mPitchRelativeTo = cObjectToCopyFrom.GetWhatPitchIsRelativeTo();
-	mYawRelativeTo = cObjectToCopyFrom.GetWhatYawIsRelativeTo();
-	mRollRelativeTo = cObjectToCopyFrom.GetWhatRollIsRelativeTo();
+	// NOTE: The Components (Transform, Kinematics, Attributes, etc.) belong to the Object Pool, so they are not copied
+	//		 (the Pool gives each of its Objects pointers to their own Components)
 
 	// Copy Automatic Tracking data	
-	mcpAutoTrackingSceneNode = cObjectToCopyFrom.GetExclusiveSceneNodeUsedForAutomaticTracking();
-	mcpDestination = GetCurrentDestination();
+	msCurrentDestination = cObjectToCopyFrom.msCurrentDestination;
 	mbMoveToDestinationAutomatically = cObjectToCopyFrom.GetIfObjectShouldMoveToDestinationAutomatically();
 	mbFaceDestinationAutomatically = cObjectToCopyFrom.GetIfObjectShouldFaceDestinationAutomatically();
 
@@ -111,35 +82,25 @@ void CObject::Purge()
 	mcpEntity = NULL;
 	mcpSceneNode = NULL;
 	mcpAnimationState = NULL;
-	mcDestinationList.clear();
+	mcDestinationList.Purge();
 	mcExternalForceList.clear();
-	mcAttributes.Purge();
 	mcAIHelper.Purge();
+	msHandle = SObjectHandle();
+
+	// The Object Pool gives the Object its Components again when it is reused
+	mspTransform = NULL;
+	mspKinematics = NULL;
+	mspFishBrain = NULL;
+	mspFlocking = NULL;
+	mspSharkBrain = NULL;
+	mspCollectible = NULL;
+	mcpAttributes = NULL;
 	
 	// Reset private data
 
 	msMeshForwardDirection = msMeshUpDirection = msMeshRightDirection = Ogre::Vector3::ZERO;
 
-	msUnitVelocity = msUnitAcceleration = Ogre::Vector3::ZERO;
-	mfSpeed = mfAccelerationRate = mfFriction = 0.0f;
-	mfMinVelocity = mfMaxVelocity = mfDefaultVelocity = 0.0f;
-	mfMinAcceleration = mfMaxAcceleration = mfDefaultAcceleration = 0.0f;
-	mbUseMovementAcceleration = mbUseMovementFriction = true;
-
-	msUnitRotationVelocity = msUnitRotationAcceleration = Ogre::Vector3::ZERO;
-	mfRotationSpeed = mfRotationAccelerationRate = mfRotationFriction = 0.0f;
-	mfMinRotationVelocity = mfMaxRotationVelocity = mfDefaultRotationVelocity = 0.0f;
-	mfMinRotationAcceleration = mfMaxRotationAcceleration = mfDefaultRotationAcceleration = 0.0f;
-	mbUseRotationAcceleration = mbUseRotationFriction = true;
-
-	mTranslationRelativeTo = Ogre::Node::TS_LOCAL;
-	mPitchRelativeTo = Ogre::Node::TS_LOCAL;
-	mYawRelativeTo = Ogre::Node::TS_LOCAL;
-	mRollRelativeTo = Ogre::Node::TS_LOCAL;
-
-	mcpAutoTrackingSceneNode = NULL;
-
-	mcpDestination = NULL;
+	msCurrentDestination = SDestination();
 	mfDistanceToDestination = 0.0f;
 	msDirectionToDestination = Ogre::Vector3::ZERO;
 
@@ -149,8 +110,6 @@ void CObject::Purge()
 	msName = "";
 	miID = miGeneralObjectType = miSpecificObjectType = miState = 0;
 	mbCollision = false;
-
-	mfDurationSinceLastUpdateInSeconds = 0.0f;
 }
 
 
@@ -160,49 +119,49 @@ void CObject::Purge()
 // Set what this Objects Translation (relative movement) should be Relative To
 void CObject::SetWhatTranslationShouldBeRelativeTo(Ogre::Node::TransformSpace RelativeTo)
 {
-	mTranslationRelativeTo = RelativeTo;
+	mspKinematics->sTranslationRelativeTo = RelativeTo;
 }
 
 // Return what this Objects Translation (relative movement) should be Relative To
 Ogre::Node::TransformSpace CObject::GetWhatTranslationIsRelativeTo() const
 {
-	return mTranslationRelativeTo;
+	return mspKinematics->sTranslationRelativeTo;
 }
 
 // Set what this Objects Pitch (X-axis rotation) should be Relative To
 void CObject::SetWhatPitchShouldBeRelativeTo(Ogre::Node::TransformSpace RelativeTo)
 {
-	mPitchRelativeTo = RelativeTo;
+	mspKinematics->sPitchRelativeTo = RelativeTo;
 }
 
 // Return what this Objects Pitch (X-axis rotation) should be Relative To
 Ogre::Node::TransformSpace CObject::GetWhatPitchIsRelativeTo() const
 {
-	return mPitchRelativeTo;
+	return mspKinematics->sPitchRelativeTo;
 }
 
 // Set what this Objects Yaw (Y-axis rotation) should be Relative To
 void CObject::SetWhatYawShouldBeRelativeTo(Ogre::Node::TransformSpace RelativeTo)
 {
-	mYawRelativeTo = RelativeTo;
+	mspKinematics->sYawRelativeTo = RelativeTo;
 }
 
 // Return what this Objects Yaw (Y-axis rotation) should be Relative To
 Ogre::Node::TransformSpace CObject::GetWhatYawIsRelativeTo() const
 {
-	return mYawRelativeTo;
+	return mspKinematics->sYawRelativeTo;
 }
 
 // Set what this Objects Roll (Z-axis rotation) should be Relative To
 void CObject::SetWhatRollShouldBeRelativeTo(Ogre::Node::TransformSpace RelativeTo)
 {
-	mRollRelativeTo = RelativeTo;
+	mspKinematics->sRollRelativeTo = RelativeTo;
 }
 
 // Return what this Objects Roll (Z-axis rotation) should be Relative To
 Ogre::Node::TransformSpace CObject::GetWhatRollIsRelativeTo() const
 {
-	return mRollRelativeTo;
+	return mspKinematics->sRollRelativeTo;
 }
 
 // Set what all of this Objects movements should be Relative To
@@ -211,10 +170,10 @@ void CObject::SetWhatAllMovementsShouldBeRelativeTo(Ogre::Node::TransformSpace T
 													Ogre::Node::TransformSpace YawRelativeTo,
 													Ogre::Node::TransformSpace RollRelativeTo)
 {
-	mTranslationRelativeTo = TranslationRelativeTo;
-	mPitchRelativeTo = PitchRelativeTo;
-	mYawRelativeTo = YawRelativeTo;
-	mRollRelativeTo = RollRelativeTo;
+	mspKinematics->sTranslationRelativeTo = TranslationRelativeTo;
+	mspKinematics->sPitchRelativeTo = PitchRelativeTo;
+	mspKinematics->sYawRelativeTo = YawRelativeTo;
+	mspKinematics->sRollRelativeTo = RollRelativeTo;
 }
 
 
@@ -267,86 +226,86 @@ Ogre::Vector3 CObject::GetMeshesDefaultRightDirection() const
 // Set Velocity (Magnitude of vector is used as Speed)
 void CObject::SetVelocity(Ogre::Vector3 sVelocity)
 {
-	mfSpeed = sVelocity.normalise();
-	msUnitVelocity = sVelocity;
+	mspKinematics->fSpeed = sVelocity.normalise();
+	mspKinematics->sUnitVelocity = sVelocity;
 }
 
 // Set Velocity
 void CObject::SetVelocity(Ogre::Vector3 sDirection, float fSpeed)
 {
 	sDirection.normalise();
-	msUnitVelocity = sDirection;
-	mfSpeed = fSpeed;
+	mspKinematics->sUnitVelocity = sDirection;
+	mspKinematics->fSpeed = fSpeed;
 }
 
 // Get Velocity Direction
 Ogre::Vector3 CObject::GetVelocityDirection() const
 {
-	return msUnitVelocity;
+	return mspKinematics->sUnitVelocity;
 }
 
 // Get Velocity with magnitude
 Ogre::Vector3 CObject::GetVelocity() const
 {
-	return msUnitVelocity * mfSpeed;
+	return mspKinematics->sUnitVelocity * mspKinematics->fSpeed;
 }
 
 // Set the Objects Velocity to the sum of its current Velocity and the given Velocity
 void CObject::SetVelocityRelative(Ogre::Vector3 sVelocityToAdd)
 {
-	Ogre::Vector3 sVelocity = msUnitVelocity * mfSpeed;
+	Ogre::Vector3 sVelocity = mspKinematics->sUnitVelocity * mspKinematics->fSpeed;
 	sVelocity += sVelocityToAdd;
 	
-	mfSpeed = sVelocity.normalise();
-	msUnitVelocity = sVelocity;
+	mspKinematics->fSpeed = sVelocity.normalise();
+	mspKinematics->sUnitVelocity = sVelocity;
 }
 
 // Set Speed
 void CObject::SetVelocitySpeed(float fSpeed)
 {
-	mfSpeed = fSpeed;
+	mspKinematics->fSpeed = fSpeed;
 }
 
 // Get Speed
 float CObject::GetVelocitySpeed() const
 {
-	return mfSpeed;
+	return mspKinematics->fSpeed;
 }
 
 // Set Min Speed
 void CObject::SetMinVelocitySpeed(float fMinSpeed)
 {
-	mfMinVelocity = fMinSpeed;
+	mspKinematics->fMinVelocity = fMinSpeed;
 }
 
 // Get Min Speed
 float CObject::GetMinVelocitySpeed() const
 {
-	return mfMinVelocity;
+	return mspKinematics->fMinVelocity;
 }
 
 // Set Max Speed
 void CObject::SetMaxVelocitySpeed(float fMaxSpeed)
 {
-	mfMaxVelocity = fMaxSpeed;
+	mspKinematics->fMaxVelocity = fMaxSpeed;
 }
 
 // Get Max Speed
 float CObject::GetMaxVelocitySpeed() const
 {
-	return mfMaxVelocity;
+	return mspKinematics->fMaxVelocity;
 }
 
 // Set Default Speed
 void CObject::SetDefaultVelocitySpeed(float fDefaultSpeed)
 {
-	mfDefaultVelocity = fDefaultSpeed;
+	mspKinematics->fDefaultVelocity = fDefaultSpeed;
 }
 
 // Get Default Speed
 float CObject::GetDefaultVelocitySpeed() const
 {
-	return mfDefaultVelocity;
+	return mspKinematics->fDefaultVelocity;
 }
 
 
@@ -357,98 +316,98 @@ float CObject::GetDefaultVelocitySpeed() const
 // NOTE: When Update() is called Velocity is automatically increased/decreased by current Acceleration
 void CObject::SetAcceleration(Ogre::Vector3 sAcceleration)
 {
-	mfAccelerationRate = sAcceleration.normalise();
-	msUnitAcceleration = sAcceleration;
+	mspKinematics->fAccelerationRate = sAcceleration.normalise();
+	mspKinematics->sUnitAcceleration = sAcceleration;
 }
 
 // Set Acceleration
 void CObject::SetAcceleration(Ogre::Vector3 sDirection, float fAccelerationRate)
 {
 	sDirection.normalise();
-	msUnitAcceleration = sDirection;
-	mfAccelerationRate = fAccelerationRate;
+	mspKinematics->sUnitAcceleration = sDirection;
+	mspKinematics->fAccelerationRate = fAccelerationRate;
 }
 
 // Get Acceleration Direction
 Ogre::Vector3 CObject::GetAccelerationDirection() const
 {
-	return msUnitAcceleration;
+	return mspKinematics->sUnitAcceleration;
 }
 
 // Get Acceleration with magnitude
 Ogre::Vector3 CObject::GetAcceleration() const
 {
-	return msUnitAcceleration * mfAccelerationRate;
+	return mspKinematics->sUnitAcceleration * mspKinematics->fAccelerationRate;
 }
 
 // Set the Objects Acceleration to the sum of its current Acceleration and the given Acceleration
 void CObject::SetAccelerationRelative(Ogre::Vector3 sAccelerationToAdd)
 {
-	Ogre::Vector3 sAcceleration = msUnitAcceleration * mfAccelerationRate;
+	Ogre::Vector3 sAcceleration = mspKinematics->sUnitAcceleration * mspKinematics->fAccelerationRate;
 	sAcceleration += sAccelerationToAdd;
 	
-	mfAccelerationRate = sAcceleration.normalise();
-	msUnitVelocity = sAcceleration;
+	mspKinematics->fAccelerationRate = sAcceleration.normalise();
+	mspKinematics->sUnitVelocity = sAcceleration;
 }
 
 // Set the Acceleration Rate
 void CObject::SetAccelerationRate(float fRate)
 {
-	mfAccelerationRate = fRate;
+	mspKinematics->fAccelerationRate = fRate;
 }
 
 // Get the Acceleration Rate
 float CObject::GetAccelerationRate() const
 {
-	return mfAccelerationRate;
+	return mspKinematics->fAccelerationRate;
 }
 
 // Set Min Accelertion Rate
 void CObject::SetMinAccelerationRate(float fMinRate)
 {
-	mfMinAcceleration = fMinRate;
+	mspKinematics->fMinAcceleration = fMinRate;
 }
 
 // Get Min Accelertion Rate
 float CObject::GetMinAccelerationRate() const
 {
-	return mfMinAcceleration;
+	return mspKinematics->fMinAcceleration;
 }
 
 // Set Max Acceleration Rate
 void CObject::SetMaxAccelerationRate(float fMaxRate)
 {
-	mfMaxAcceleration = fMaxRate;
+	mspKinematics->fMaxAcceleration = fMaxRate;
 }
 
 // Get Max Acceleration Rate
 float CObject::GetMaxAccelerationRate() const
 {
-	return mfMaxAcceleration;
+	return mspKinematics->fMaxAcceleration;
 }
 
 // Set Default Acceleration Rate
 void CObject::SetDefaultAccelerationRate(float fDefaultRate)
 {
-	mfDefaultAcceleration = fDefaultRate;
+	mspKinematics->fDefaultAcceleration = fDefaultRate;
 }
 
 // Get Default Acceleration Rate
 float CObject::GetDefaultAccelerationRate() const
 {
-	return mfDefaultAcceleration;
+	return mspKinematics->fDefaultAcceleration;
 }
 
 // Set if Movement Accelerations should be used or not (true by default)
 void CObject::SetIfMovementAccelerationShouldBeUsed(bool _bUseMovementAcceleration)
 {
-	mbUseMovementAcceleration = _bUseMovementAcceleration;
+	mspKinematics->bUseMovementAcceleration = _bUseMovementAcceleration;
 }
 
 // Get if Movement Accelerations should be used or not (true by default)
 bool CObject::GetIfMovementAccelerationIsBeingUsed() const
 {
-	return mbUseMovementAcceleration;
+	return mspKinematics->bUseMovementAcceleration;
 }
 
 
@@ -459,25 +418,25 @@ bool CObject::GetIfMovementAccelerationIsBeingUsed() const
 // NOTE: Specified friction X will slow object down by X pixels per second
 void CObject::SetFriction(float fFrictionPerSecond)
 {
-	mfFriction = fFrictionPerSecond;
+	mspKinematics->fFriction = fFrictionPerSecond;
 }
 
 // Get Friction
 float CObject::GetFriction() const
 {
-	return mfFriction;
+	return mspKinematics->fFriction;
 }
 
 // Set if Movement Friction should be used or not (true by default)
 void CObject::SetIfMovementFrictionShouldBeUsed(bool bUseMovementFriction)
 {
-	mbUseMovementFriction = bUseMovementFriction;
+	mspKinematics->bUseMovementFriction = bUseMovementFriction;
 }
 
 // Get if Movement Friction should be used or not (true by default)
 bool CObject::GetIfMovementFrictionIsBeingUsed() const
 {
-	return mbUseMovementFriction;
+	return mspKinematics->bUseMovementFriction;
 }
 
 
@@ -489,86 +448,86 @@ bool CObject::GetIfMovementFrictionIsBeingUsed() const
 // Set Rotation Velocity (Magnitude of vector is used as number of Degrees to Rotate Per Second)
 void CObject::SetRotationVelocity(Ogre::Vector3 sRotationVelocity)
 {
-	mfRotationSpeed = sRotationVelocity.normalise();
-	msUnitRotationVelocity = sRotationVelocity;
+	mspKinematics->fRotationSpeed = sRotationVelocity.normalise();
+	mspKinematics->sUnitRotationVelocity = sRotationVelocity;
 }
 
 // Set Rotation Velocity
 void CObject::SetRotationVelocity(Ogre::Vector3 sRotation, float fRotationSpeedInDegreesPerSecond)
 {
 	sRotation.normalise();
-	msUnitRotationVelocity = sRotation;
-	mfRotationSpeed = fRotationSpeedInDegreesPerSecond;
+	mspKinematics->sUnitRotationVelocity = sRotation;
+	mspKinematics->fRotationSpeed = fRotationSpeedInDegreesPerSecond;
 }
 
 // Get Rotation Velocity
 Ogre::Vector3 CObject::GetRotationVelocityDirection() const
 {
-	return msUnitRotationVelocity;
+	return mspKinematics->sUnitRotationVelocity;
 }
 
 // Get Rotation Velocity (Magnitude of vector is used as number of Degrees to Rotate Per Second)
 Ogre::Vector3 CObject::GetRotationVelocity() const
 {
-	return msUnitRotationVelocity * mfRotationSpeed;
+	return mspKinematics->sUnitRotationVelocity * mspKinematics->fRotationSpeed;
 }
 
 // Set the Objects Rotation Velocity to the sum of its current Rotation Velocity and the given Velocity
 void CObject::SetRotationVelocityRelative(Ogre::Vector3 sVelocityToAdd)
 {
-	Ogre::Vector3 sRotationVelocity = msUnitRotationVelocity * mfRotationSpeed;
+	Ogre::Vector3 sRotationVelocity = mspKinematics->sUnitRotationVelocity * mspKinematics->fRotationSpeed;
 	sRotationVelocity += sVelocityToAdd;
 	
-	mfRotationSpeed = sRotationVelocity.normalise();
-	msUnitRotationVelocity = sRotationVelocity;
+	mspKinematics->fRotationSpeed = sRotationVelocity.normalise();
+	mspKinematics->sUnitRotationVelocity = sRotationVelocity;
 }
 
 // Set Rotation Speed
 void CObject::SetRotationVelocitySpeed(float fSpeedInDegreesPerSecond)
 {
-	mfRotationSpeed = fSpeedInDegreesPerSecond;
+	mspKinematics->fRotationSpeed = fSpeedInDegreesPerSecond;
 }
 
 // Get Rotation Speed
 float CObject::GetRotationVelocitySpeed() const
 {
-	return mfRotationSpeed;
+	return mspKinematics->fRotationSpeed;
 }
 
 // Set the Min Rotation Angle to Rotate per Second
 void CObject::SetMinRotationVelocitySpeed(float fSpeedInDegreesPerSecond)
 {
-	mfMinRotationVelocity = fSpeedInDegreesPerSecond;
+	mspKinematics->fMinRotationVelocity = fSpeedInDegreesPerSecond;
 }
 
 // Get the Min Rotation Angle to Rotate per Second
 float CObject::GetMinRotationVelocitySpeed() const
 {
-	return mfMinRotationVelocity;
+	return mspKinematics->fMinRotationVelocity;
 }
 
 // Set the Max Rotation Angle to Rotate per Second
 void CObject::SetMaxRotationVelocitySpeed(float fSpeedInDegreesPerSecond)
 {
-	mfMaxRotationVelocity = fSpeedInDegreesPerSecond;
+	mspKinematics->fMaxRotationVelocity = fSpeedInDegreesPerSecond;
 }
 
 // Get the Max Rotation Angle to Rotate per Second
 float CObject::GetMaxRotationVelocitySpeed() const
 {
-	return mfMaxRotationVelocity;
+	return mspKinematics->fMaxRotationVelocity;
 }
 
 // Set the Default Rotation Angle to Rotate per Second
 void CObject::SetDefaultRotationVelocitySpeed(float fSpeedInDegreesPerSecond)
 {
-	mfDefaultRotationVelocity = fSpeedInDegreesPerSecond;
+	mspKinematics->fDefaultRotationVelocity = fSpeedInDegreesPerSecond;
 }
 
 // Get the Default Rotation Angle to Rotate per Second
 float CObject::GetDefaultRotationVelocitySpeed() const
 {
-	return mfDefaultRotationVelocity;
+	return mspKinematics->fDefaultRotationVelocity;
 }
 
 
@@ -579,98 +538,98 @@ float CObject::GetDefaultRotationVelocitySpeed() const
 // NOTE: When Update() is called Velocity is automatically increased/decreased by current Acceleration
 void CObject::SetRotationAcceleration(Ogre::Vector3 sRotationAcceleration)
 {
-	mfRotationAccelerationRate = sRotationAcceleration.normalise();
-	msUnitRotationAcceleration = sRotationAcceleration;
+	mspKinematics->fRotationAccelerationRate = sRotationAcceleration.normalise();
+	mspKinematics->sUnitRotationAcceleration = sRotationAcceleration;
 }
 
 // Set Rotation Acceleration
 void CObject::SetRotationAcceleration(Ogre::Vector3 sRotation, float fRotationAccelerationInDegreesPerSecond)
 {
 	sRotation.normalise();
-	msUnitRotationAcceleration = sRotation;
-	mfRotationAccelerationRate = fRotationAccelerationInDegreesPerSecond;
+	mspKinematics->sUnitRotationAcceleration = sRotation;
+	mspKinematics->fRotationAccelerationRate = fRotationAccelerationInDegreesPerSecond;
 }
 
 // Get Rotation Acceleration
 Ogre::Vector3 CObject::GetRotationAccelerationDirection() const
 {
-	return msUnitRotationAcceleration;
+	return mspKinematics->sUnitRotationAcceleration;
 }
 
 // Get Rotation Acceleration (Magnitude of vector is rotational acceleration in Degrees Per Second)
 Ogre::Vector3 CObject::GetRotationAcceleration() const
 {
-	return msUnitRotationAcceleration * mfRotationAccelerationRate;
+	return mspKinematics->sUnitRotationAcceleration * mspKinematics->fRotationAccelerationRate;
 }
 
 // Set the Objects Rotation Acceleration to the sum of its current Rotation Acceleration and the given Acceleration
 void CObject::SetRotationAccelerationRelative(Ogre::Vector3 sAccelerationToAdd)
 {
-	Ogre::Vector3 sRotationAcceleration = msUnitRotationAcceleration * mfRotationAccelerationRate;
+	Ogre::Vector3 sRotationAcceleration = mspKinematics->sUnitRotationAcceleration * mspKinematics->fRotationAccelerationRate;
 	sRotationAcceleration += sAccelerationToAdd;
 	
-	mfRotationAccelerationRate = sRotationAcceleration.normalise();
-	msUnitRotationVelocity = sRotationAcceleration;
+	mspKinematics->fRotationAccelerationRate = sRotationAcceleration.normalise();
+	mspKinematics->sUnitRotationVelocity = sRotationAcceleration;
 }
 
 // Set Rotation Acceleration Rate
 void CObject::SetRotationAccelerationRate(float fAccelerationInDegreesPerSecond)
 {
-	mfRotationAccelerationRate = fAccelerationInDegreesPerSecond;
+	mspKinematics->fRotationAccelerationRate = fAccelerationInDegreesPerSecond;
 }
 
 // Get Rotation Acceleration Rate
 float CObject::GetRotationAccelerationRate() const
 {
-	return mfRotationAccelerationRate;
+	return mspKinematics->fRotationAccelerationRate;
 }
 
 // Set the Min Rotation Angle to Accelerate by per Second
 void CObject::SetMinRotationAccelerationRate(float fAccelerationInDegreesPerSecond)
 {
-	mfMinRotationAcceleration = fAccelerationInDegreesPerSecond;
+	mspKinematics->fMinRotationAcceleration = fAccelerationInDegreesPerSecond;
 }
 
 // Get the Min Rotation Angle to Accelerate by per Second
 float CObject::GetMinRotationAccelerationRate() const
 {
-	return mfMinRotationAcceleration;
+	return mspKinematics->fMinRotationAcceleration;
 }
 
 // Set the Max Rotation Angle to Accelerate by per Second
 void CObject::SetMaxRotationAccelerationRate(float fAccelerationInDegreesPerSecond)
 {
-	mfMaxRotationAcceleration = fAccelerationInDegreesPerSecond;
+	mspKinematics->fMaxRotationAcceleration = fAccelerationInDegreesPerSecond;
 }
 
 // Get the Max Rotation Angle to Accelerate by per Second
 float CObject::GetMaxRotationAccelerationRate() const
 {
-	return mfMaxRotationAcceleration;
+	return mspKinematics->fMaxRotationAcceleration;
 }
 
 // Set the Default Rotation Angle to Accelerate by per Second
 void CObject::SetDefaultRotationAccelerationRate(float fAccelerationInDegreesPerSecond)
 {
-	mfDefaultRotationAcceleration = fAccelerationInDegreesPerSecond;
+	mspKinematics->fDefaultRotationAcceleration = fAccelerationInDegreesPerSecond;
 }
 
 // Get the Default Rotation Angle to Accelerate by per Second
 float CObject::GetDefaultRotationAccelerationRate() const
 {
-	return mfDefaultRotationAcceleration;
+	return mspKinematics->fDefaultRotationAcceleration;
 }
 
 // Set if Rotation Accelerations should be used or not (true by default)
 void CObject::SetIfRotationAccelerationShouldBeUsed(bool bUseRotationAcceleration)
 {
-	mbUseRotationAcceleration = bUseRotationAcceleration;
+	mspKinematics->bUseRotationAcceleration = bUseRotationAcceleration;
 }
 
 // Get if Rotation Accelerations should be used or not (true by default)
 bool CObject::GetIfRotationAccelerationIsBeingUsed() const
 {
-	return mbUseRotationAcceleration;
+	return mspKinematics->bUseRotationAcceleration;
 }
 
 
@@ -681,25 +640,25 @@ bool CObject::GetIfRotationAccelerationIsBeingUsed() const
 // NOTE: Specified friction Pitch will slow object down by Pitch pixels per second
 void CObject::SetRotationFriction(float fRotationFriction)
 {
-	mfRotationFriction = fRotationFriction;
+	mspKinematics->fRotationFriction = fRotationFriction;
 }
 
 // Get Rotation Friction
 float CObject::GetRotationFriction() const
 {
-	return mfRotationFriction;
+	return mspKinematics->fRotationFriction;
 }
 
 // Set if Rotation Friction should be used or not (true by default)
 void CObject::SetIfRotationFrictionShouldBeUsed(bool bUseRotationFriction)
 {
-	mbUseRotationFriction = bUseRotationFriction;
+	mspKinematics->bUseRotationFriction = bUseRotationFriction;
 }
 
 // Get if Rotation Friction should be used or not (true by default)
 bool CObject::GetIfRotationFrictionIsBeingUsed() const
 {
-	return mbUseRotationFriction;
+	return mspKinematics->bUseRotationFriction;
 }
 
 
@@ -720,13 +679,14 @@ void CObject::Update(unsigned long ulAmountOfTimeSinceLastUpdate)
 // Updates Objects Position
 // Moves Object by specified Velocity amounts, which is calculated using the Acceleration values
 // NOTE: This should be called every frame
+// NOTE: CKinematicIntegrator does the same work for many Objects at once, so any change made here must also be made there
 void CObject::Update(float fAmountOfTimeSinceLastUpdateInSeconds)
 {
 	// Temp local variables
-	Ogre::Vector3 sVelocity = msUnitVelocity * mfSpeed;
-	Ogre::Vector3 sRotationVelocity = msUnitRotationVelocity * mfRotationSpeed;
-	Ogre::Vector3 sAcceleration = msUnitAcceleration * mfAccelerationRate;
-	Ogre::Vector3 sRotationAcceleration = msUnitRotationAcceleration * mfRotationAccelerationRate;
+	Ogre::Vector3 sVelocity = mspKinematics->sUnitVelocity * mspKinematics->fSpeed;
+	Ogre::Vector3 sRotationVelocity = mspKinematics->sUnitRotationVelocity * mspKinematics->fRotationSpeed;
+	Ogre::Vector3 sAcceleration = mspKinematics->sUnitAcceleration * mspKinematics->fAccelerationRate;
+	Ogre::Vector3 sRotationAcceleration = mspKinematics->sUnitRotationAcceleration * mspKinematics->fRotationAccelerationRate;
 
 	Ogre::Vector3 sNewVelocity = sVelocity;
 	Ogre::Vector3 sNewRotationVelocity = sRotationVelocity;
@@ -735,13 +695,13 @@ void CObject::Update(float fAmountOfTimeSinceLastUpdateInSeconds)
 	float fLength = 0.0f;
 
 	// Record how much time passed between the last two Update() calls
-	mfDurationSinceLastUpdateInSeconds = fAmountOfTimeSinceLastUpdateInSeconds;
+	mspKinematics->fDurationSinceLastUpdateInSeconds = fAmountOfTimeSinceLastUpdateInSeconds;
 
 
 	//---------- Calculate how much to move ----------
 
 	// If Movement Acceleration is being used
-	if (mbUseMovementAcceleration)
+	if (mspKinematics->bUseMovementAcceleration)
 	{
 		// Calculate new Velocities from Accelerations
 		// Acceleration = (Vfinal - Vinitial) / Time   =>  Vfinal = (A * T) + Vinitial 
@@ -751,10 +711,10 @@ void CObject::Update(float fAmountOfTimeSinceLastUpdateInSeconds)
 	}
 
 	// If Rotation Friction is being used
-	if (mbUseMovementFriction)
+	if (mspKinematics->bUseMovementFriction)
 	{
 		// Calculate how much impact Friction should have
-		fFrictionImpact = mfFriction * fAmountOfTimeSinceLastUpdateInSeconds;
+		fFrictionImpact = mspKinematics->fFriction * fAmountOfTimeSinceLastUpdateInSeconds;
 
 
 		// Process Friction impact (Do nothing if Velocity is zero)
@@ -830,18 +790,18 @@ void CObject::Update(float fAmountOfTimeSinceLastUpdateInSeconds)
 	fLength = sNewVelocity.length();
 	
 	// If the Object is moving too fast
-	if (fLength > mfMaxVelocity)
+	if (fLength > mspKinematics->fMaxVelocity)
 	{
 		// Make the Object move at its max speed
 		sNewVelocity.normalise();
-		sNewVelocity *= mfMaxVelocity;
+		sNewVelocity *= mspKinematics->fMaxVelocity;
 	}
 	// Else if the Object is moving too slow
-	else if (fLength < mfMinVelocity)
+	else if (fLength < mspKinematics->fMinVelocity)
 	{
 		// Make the Object move at its min speed
 		sNewVelocity.normalise();
-		sNewVelocity *= mfMinVelocity;
+		sNewVelocity *= mspKinematics->fMinVelocity;
 	}
 
 
@@ -856,7 +816,7 @@ void CObject::Update(float fAmountOfTimeSinceLastUpdateInSeconds)
 		for (cForceIterator = mcExternalForceList.begin(); cForceIterator != mcExternalForceList.end(); cForceIterator++)
 		{
 			// Add the External Force to the Objects velocity
-			mcpSceneNode->translate(cForceIterator->sForce * fAmountOfTimeSinceLastUpdateInSeconds, cForceIterator->sTransformSpace);
+			Translate(cForceIterator->sForce * fAmountOfTimeSinceLastUpdateInSeconds, cForceIterator->sTransformSpace);
 		}
 	}
 
@@ -864,14 +824,14 @@ void CObject::Update(float fAmountOfTimeSinceLastUpdateInSeconds)
 	// Set New Velocities
 	sVelocity = sNewVelocity;
 
-	msUnitVelocity = sVelocity;
-	mfSpeed = msUnitVelocity.normalise();
+	mspKinematics->sUnitVelocity = sVelocity;
+	mspKinematics->fSpeed = mspKinematics->sUnitVelocity.normalise();
 
 
 	//---------- Calculate how much to Rotate ----------
 
 	// If Rotation Acceleration is being used
-	if (mbUseRotationAcceleration)
+	if (mspKinematics->bUseRotationAcceleration)
 	{
 		// Calculate new Rotation Velocities from Accelerations
 		// Acceleration = (Vfinal - Vinitial) / Time   =>  Vfinal = (A * T) + Vinitial 
@@ -881,10 +841,10 @@ void CObject::Update(float fAmountOfTimeSinceLastUpdateInSeconds)
 	}
 
 	// If Rotation Friction is being used
-	if (mbUseRotationFriction)
+	if (mspKinematics->bUseRotationFriction)
 	{
 		// Calculate how much impact Rotation Friction should have
-		fFrictionImpact = mfRotationFriction * fAmountOfTimeSinceLastUpdateInSeconds;
+		fFrictionImpact = mspKinematics->fRotationFriction * fAmountOfTimeSinceLastUpdateInSeconds;
 
 
 		// Process Rotation Friction impact (Do nothing if Velocity is zero)
@@ -960,29 +920,36 @@ void CObject::Update(float fAmountOfTimeSinceLastUpdateInSeconds)
 	fLength = sNewRotationVelocity.length();
 	
 	// If the Object is rotating too fast
-	if (fLength > mfMaxRotationVelocity)
+	if (fLength > mspKinematics->fMaxRotationVelocity)
 	{
 		// Make the Object rotate at its max speed
 		sNewRotationVelocity.normalise();
-		sNewRotationVelocity *= mfMaxRotationVelocity;
+		sNewRotationVelocity *= mspKinematics->fMaxRotationVelocity;
 	}
 	// Else if the Object is rotating too slow
-	else if (fLength < mfMinRotationVelocity)
+	else if (fLength < mspKinematics->fMinRotationVelocity)
 	{
 		// Make the Object rotate at its min speed
 		sNewRotationVelocity.normalise();
-		sNewRotationVelocity *= mfMinRotationVelocity;
+		sNewRotationVelocity *= mspKinematics->fMinRotationVelocity;
 	}
 
 	// Set New Rotation Velocities
 	sRotationVelocity = sNewRotationVelocity;
 
-	msUnitRotationVelocity = sRotationVelocity;
-	mfRotationSpeed = msUnitRotationVelocity.normalise();
+	mspKinematics->sUnitRotationVelocity = sRotationVelocity;
+	mspKinematics->fRotationSpeed = mspKinematics->sUnitRotationVelocity.normalise();
 
 
 	//---------- Update Object according to if it's being automatically controlled or not ----------
 
+	// If the Object we were tracking has been Removed (its Scene Node was destroyed along with it)
+	if (!mbDestinationReached && !msCurrentDestination.ReturnIfValid())
+	{
+		// Forget about it and move on to the next Destination
+		mbDestinationReached = true;
+	}
+
 	// If the Object should face the Destination
 	if (mbFaceDestinationAutomatically)
 	{
@@ -1004,23 +971,23 @@ void CObject::Update(float fAmountOfTimeSinceLastUpdateInSeconds)
 		// Calculate new Relative Rotation from Velocities
 		// Velocity = Distance / Time  =>  D = V * T
 	//	SetOrientationRelative((mfPitchVelocity * fAmountOfTimeSinceLastUpdateInSeconds), (mfYawVelocity * fAmountOfTimeSinceLastUpdateInSeconds),
-	//						   (mfRollVelocity * fAmountOfTimeSinceLastUpdateInSeconds), mTranslationRelativeTo);
+	//						   (mfRollVelocity * fAmountOfTimeSinceLastUpdateInSeconds), mspKinematics->sTranslationRelativeTo);
 		// If the Object should Yaw
 		if (sRotationVelocity.y != 0.0)
 		{
-			mcpSceneNode->yaw(Ogre::Degree(sRotationVelocity.y * fAmountOfTimeSinceLastUpdateInSeconds), mYawRelativeTo);
+			Yaw(Ogre::Degree(sRotationVelocity.y * fAmountOfTimeSinceLastUpdateInSeconds), mspKinematics->sYawRelativeTo);
 		}
 
 		// If the Object should Pitch
 		if (sRotationVelocity.x != 0.0)
 		{
-			mcpSceneNode->pitch(Ogre::Degree(sRotationVelocity.x * fAmountOfTimeSinceLastUpdateInSeconds), mPitchRelativeTo);
+			Pitch(Ogre::Degree(sRotationVelocity.x * fAmountOfTimeSinceLastUpdateInSeconds), mspKinematics->sPitchRelativeTo);
 		}
 
 		// If the Object should Roll
 		if (sRotationVelocity.z != 0.0)
 		{
-			mcpSceneNode->roll(Ogre::Degree(sRotationVelocity.z * fAmountOfTimeSinceLastUpdateInSeconds), mRollRelativeTo);
+			Roll(Ogre::Degree(sRotationVelocity.z * fAmountOfTimeSinceLastUpdateInSeconds), mspKinematics->sRollRelativeTo);
 		}
 	}
 
@@ -1028,7 +995,7 @@ void CObject::Update(float fAmountOfTimeSinceLastUpdateInSeconds)
 	if (mbMoveToDestinationAutomatically)
 	{
 		// If we have reached the Destination (or don't have one to move towards)
-		if (mbDestinationReached || mcpDestination == NULL)
+		if (mbDestinationReached)
 		{
 			// Get the Next Destination
 			GetNextDestination();
@@ -1037,10 +1004,10 @@ void CObject::Update(float fAmountOfTimeSinceLastUpdateInSeconds)
 		else
 		{
 			// Calculate how far to move this frame
-			float fAmountToMove = mfSpeed * fAmountOfTimeSinceLastUpdateInSeconds;
+			float fAmountToMove = mspKinematics->fSpeed * fAmountOfTimeSinceLastUpdateInSeconds;
 
 			// Calculate the Direction and Distance to the Destination
-			msDirectionToDestination = mcpDestination->getWorldPosition() - mcpSceneNode->getWorldPosition();
+			msDirectionToDestination = ReturnCurrentDestinationPosition() - mspTransform->sPosition;
 			mfDistanceToDestination = msDirectionToDestination.normalise();
 
 			// Subtract the Distance moved this frame from the Distance to the Destination
@@ -1050,11 +1017,10 @@ void CObject::Update(float fAmountOfTimeSinceLastUpdateInSeconds)
 			if (mfDistanceToDestination <= 0.0f)
 			{
 				// Move the Object to the Destination and reset the Destination
-				mcpSceneNode->setPosition(mcpDestination->getWorldPosition());
+				SetPosition(ReturnCurrentDestinationPosition());
 
 				// Mark that we reached the Destination
 				mbDestinationReached = true;
-				mcpDestination = NULL;
 
 				// Get the next Destination to go to
 				GetNextDestination();
@@ -1066,12 +1032,12 @@ void CObject::Update(float fAmountOfTimeSinceLastUpdateInSeconds)
 				if (mbFaceDestinationAutomatically)
 				{
 					// Move the Object forward
-					mcpSceneNode->translate(msMeshForwardDirection * fAmountToMove, Ogre::Node::TS_LOCAL);
+					Translate(msMeshForwardDirection * fAmountToMove, Ogre::Node::TS_LOCAL);
 				}
 				else
 				{
 					// Move towards the Destination
-					mcpSceneNode->translate(msDirectionToDestination * fAmountToMove);
+					Translate(msDirectionToDestination * fAmountToMove);
 				}
 			}
 		}
@@ -1082,13 +1048,12 @@ void CObject::Update(float fAmountOfTimeSinceLastUpdateInSeconds)
 		// Calculate new Relative Position from Velocities
 		// Velocity = Distance / Time  =>  D = V * T
 	//	MoveToRelative((mfXVelocity * fAmountOfTimeSinceLastUpdateInSeconds), (mfYVelocity * fAmountOfTimeSinceLastUpdateInSeconds),
-	//				   (mfZVelocity * fAmountOfTimeSinceLastUpdateInSeconds), mTranslationRelativeTo);
+	//				   (mfZVelocity * fAmountOfTimeSinceLastUpdateInSeconds), mspKinematics->sTranslationRelativeTo);
 
 		// If the Object should move
 		if (sVelocity.x != 0.0 || sVelocity.y != 0.0 || sVelocity.z != 0.0)
 		{
-			mcpSceneNode->translate((sVelocity.x * fAmountOfTimeSinceLastUpdateInSeconds), (sVelocity.y * fAmountOfTimeSinceLastUpdateInSeconds),
-									(sVelocity.z * fAmountOfTimeSinceLastUpdateInSeconds), mTranslationRelativeTo);
+			Translate(sVelocity * fAmountOfTimeSinceLastUpdateInSeconds, mspKinematics->sTranslationRelativeTo);
 		}
 	}
 
@@ -1106,13 +1071,148 @@ void CObject::Update(float fAmountOfTimeSinceLastUpdateInSeconds)
 
 
 
+//---------- Transform Functions ----------
+
+// Sets the Objects Position in the world
+void CObject::SetPosition(Ogre::Vector3 _sPosition)
+{
+	mspTransform->sPosition = _sPosition;
+}
+
+// Returns the Objects Position in the world
+Ogre::Vector3 CObject::GetPosition() const
+{
+	return mspTransform->sPosition;
+}
+
+// Sets the Objects Orientation in the world
+void CObject::SetOrientation(Ogre::Quaternion _sOrientation)
+{
+	mspTransform->sOrientation = _sOrientation;
+}
+
+// Returns the Objects Orientation in the world
+Ogre::Quaternion CObject::GetOrientation() const
+{
+	return mspTransform->sOrientation;
+}
+
+// Moves the Object by the given Distance, relative to the given Transform Space
+// NOTE: Objects Scene Nodes are children of the root Scene Node, so Parent and World space are the same
+void CObject::Translate(Ogre::Vector3 _sDistance, Ogre::Node::TransformSpace _RelativeTo)
+{
+	// If the Distance is relative to the Objects own axes
+	if (_RelativeTo == Ogre::Node::TS_LOCAL)
+	{
+		// Rotate the Distance into world space before moving
+		mspTransform->sPosition += mspTransform->sOrientation * _sDistance;
+	}
+	// Else the Distance is already in world space
+	else
+	{
+		mspTransform->sPosition += _sDistance;
+	}
+}
+
+// Rotates the Object around the given Axis, relative to the given Transform Space
+void CObject::Rotate(Ogre::Vector3 _sAxis, Ogre::Radian _sAngle, Ogre::Node::TransformSpace _RelativeTo)
+{
+	// Build the Rotation and make sure it is normalised so the Orientation does not drift
+	Ogre::Quaternion sRotation(_sAngle, _sAxis);
+	sRotation.normalise();
+
+	// If the Rotation is around the Objects own axes
+	if (_RelativeTo == Ogre::Node::TS_LOCAL)
+	{
+		mspTransform->sOrientation = mspTransform->sOrientation * sRotation;
+	}
+	// Else the Rotation is around the world axes
+	else
+	{
+		mspTransform->sOrientation = sRotation * mspTransform->sOrientation;
+	}
+}
+
+// Rotates the Object around its X axis
+void CObject::Pitch(Ogre::Radian _sAngle, Ogre::Node::TransformSpace _RelativeTo)
+{
+	Rotate(Ogre::Vector3::UNIT_X, _sAngle, _RelativeTo);
+}
+
+// Rotates the Object around its Y axis
+void CObject::Yaw(Ogre::Radian _sAngle, Ogre::Node::TransformSpace _RelativeTo)
+{
+	Rotate(Ogre::Vector3::UNIT_Y, _sAngle, _RelativeTo);
+}
+
+// Rotates the Object around its Z axis
+void CObject::Roll(Ogre::Radian _sAngle, Ogre::Node::TransformSpace _RelativeTo)
+{
+	Rotate(Ogre::Vector3::UNIT_Z, _sAngle, _RelativeTo);
+}
+
+// Copies the Scene Nodes Position and Orientation into the Object
+void CObject::ReadTransformFromSceneNode()
+{
+	// If there is a Scene Node to read from
+	if (mcpSceneNode != NULL)
+	{
+		mspTransform->sPosition = mcpSceneNode->getPosition();
+		mspTransform->sOrientation = mcpSceneNode->getOrientation();
+	}
+}
+
+// Records the Objects current Position and Orientation as where it was before the next Simulation Step
+void CObject::SavePreviousTransform()
+{
+	mspTransform->sPreviousPosition = mspTransform->sPosition;
+	mspTransform->sPreviousOrientation = mspTransform->sOrientation;
+}
+
+// Pushes the Objects Position and Orientation to its Scene Node (if it has one)
+void CObject::SyncSceneNodeWithTransform(float _fInterpolation)
+{
+	// If there is no Scene Node to write to
+	if (mcpSceneNode == NULL)
+	{
+		return;
+	}
+
+	// If the current Transform should be used as is
+	if (_fInterpolation >= 1.0f)
+	{
+		mcpSceneNode->setPosition(mspTransform->sPosition);
+		mcpSceneNode->setOrientation(mspTransform->sOrientation);
+	}
+	// Else blend from the Previous Transform towards the current one
+	else
+	{
+		mcpSceneNode->setPosition(mspTransform->sPreviousPosition + ((mspTransform->sPosition - mspTransform->sPreviousPosition) * _fInterpolation));
+		mcpSceneNode->setOrientation(Ogre::Quaternion::nlerp(_fInterpolation, mspTransform->sPreviousOrientation, mspTransform->sOrientation, true));
+	}
+}
+
+// Sets the Objects Bounding Radius
+void CObject::SetBoundingRadius(float _fBoundingRadius)
+{
+	mspTransform->fBoundingRadius = _fBoundingRadius;
+}
+
+// Returns the Objects Bounding Radius
+float CObject::GetBoundingRadius() const
+{
+	return mspTransform->fBoundingRadius;
+}
+
+
+
 // ---------- Easy Rotation Functions ----------
 
 // Rotates the Object to face the given Location
 void CObject::PointObjectTowardsLocation(Ogre::Vector3 _sLocation, bool _bImmediately)
 {
 	// Find the Direction of the Location relative to this Object
-	Ogre::Vector3 sDirection = _sLocation - mcpSceneNode->getWorldPosition();
+	Ogre::Vector3 sDirection = _sLocation - mspTransform->sPosition;
 
 	// Point the Object in the Direction of the Location
 	PointObjectInDirection(sDirection, _bImmediately);
@@ -1125,7 +1225,7 @@ void CObject::PointObjectInDirection(Ogre::Vector3 _sDirection, bool _bImmediate
 	float fRatioToRotate = 1.0f;
 
 	// Specify the Rotation Speed to use (if current rotation speed is zero, use the default rotation speed)
-	float fRotationSpeed = (mfRotationSpeed != 0.0) ? mfRotationSpeed : mfDefaultRotationVelocity;
+	float fRotationSpeed = (mspKinematics->fRotationSpeed != 0.0) ? mspKinematics->fRotationSpeed : mspKinematics->fDefaultRotationVelocity;
 
 	// If we don't need to face the given direction immediately
 	if (!_bImmediately && fRotationSpeed != 0.0)
@@ -1142,7 +1242,7 @@ void CObject::PointObjectInDirection(Ogre::Vector3 _sDirection, bool _bImmediate
 		float fNumberOfSecondsRotationShouldTake = fAngleToTurn / fRotationSpeed;
 
 		// Calculate how much of the rotation should be performed this frame
-		fRatioToRotate = mfDurationSinceLastUpdateInSeconds / fNumberOfSecondsRotationShouldTake;
+		fRatioToRotate = mspKinematics->fDurationSinceLastUpdateInSeconds / fNumberOfSecondsRotationShouldTake;
 
 		// Make sure we do not rotate too far
 		if (fRatioToRotate > 1.0 || fRatioToRotate <= 0.0)
@@ -1152,19 +1252,19 @@ void CObject::PointObjectInDirection(Ogre::Vector3 _sDirection, bool _bImmediate
 	}
 
 	// Get Objects current orientation
-	Ogre::Quaternion sSourceRotation = mcpSceneNode->getOrientation();
+	Ogre::Quaternion sSourceRotation = mspTransform->sOrientation;
 
 	// Get the Rotation that is needed to make the Object face the given direction
 	Ogre::Quaternion sDestinationRotation = GetDirectionObjectIsFacing().getRotationTo(_sDirection) * sSourceRotation;
 
-//	mcpSceneNode->setOrientation(sDestinationRotation);
-	mcpSceneNode->setOrientation(Ogre::Quaternion::Slerp(fRatioToRotate, sSourceRotation, sDestinationRotation, true));
+//	SetOrientation(sDestinationRotation);
+	SetOrientation(Ogre::Quaternion::Slerp(fRatioToRotate, sSourceRotation, sDestinationRotation, true));
 }
 
 // Returns the unit Direction the Object is currently facing
 Ogre::Vector3 CObject::GetDirectionObjectIsFacing() const
 {
-	Ogre::Vector3 sDirection = mcpSceneNode->getOrientation() * msMeshForwardDirection;
+	Ogre::Vector3 sDirection = mspTransform->sOrientation * msMeshForwardDirection;
 	sDirection.normalise();
 	return sDirection;
 }
@@ -1173,22 +1273,6 @@ Ogre::Vector3 CObject::GetDirectionObjectIsFacing() const
 
 // ---------- Automatic Tracking Functions ----------
 
-// Sets the dummy Scene Node to use to track Vectors
-// NOTE: This Scene Node should not be used by anything other than this class and should be a child
-//		  of the root Scene Node
-void CObject::SetExclusiveSceneNodeToUseForAutomaticTracking(Ogre::SceneNode* _cpExclusiveSceneNode)
-{
-	mcpAutoTrackingSceneNode = _cpExclusiveSceneNode;
-}
-
-// Gets the dummy Scene Node to use to track Vectors
-// NOTE: This Scene Node should not be used by anything other than this class and should be a child
-//		  of the root Scene Node
-Ogre::SceneNode* CObject::GetExclusiveSceneNodeUsedForAutomaticTracking() const
-{
-	return mcpAutoTrackingSceneNode;
-}
-
 // Sets if the Object should move towards it's Destinations automatically (true) or if the Object should
 //	have free control to move itself around
 // NOTE: If true, any calls to SetAcceleration/Velocity will be ignored until set back to false
@@ -1211,7 +1295,7 @@ bool CObject::SetIfObjectShouldFaceDestinationAutomatically(bool _bFaceDestinati
 	mbFaceDestinationAutomatically = _bFaceDestination;
 
 	// Return if there is a Destination to face to or not
-	return !mcDestinationList.empty();
+	return !mcDestinationList.ReturnIfEmpty();
 }
 
 // Return if the Object is moving towards it's Destination automatically or not
@@ -1230,41 +1314,25 @@ bool CObject::GetIfObjectShouldFaceDestinationAutomatically() const
 //	the Object face the new Destination if it's supposed to
 bool CObject::GetNextDestination()
 {
-	// If there is another Destination to go to
-	if (mcDestinationList.empty())
+	// Get and Remove the next Destination from the Destination List
+	// If there is not another Destination to go to
+	if (!mcDestinationList.PopFront(msCurrentDestination))
 	{	
 		// Record that we have Reached the Destination (since we don't have one) and exit the function
+		msCurrentDestination = SDestination();
 		mbDestinationReached = true;
 		return false;
 	}
 
-	// Get and Remove the next Destination from the Destination List
-    SDestination* spTemp = mcDestinationList.front();
-    mcDestinationList.pop_front();
-
-	// If a Scene Node was given to track
-	if (spTemp->cpSceneNode != NULL)
-	{
-		// Set to track the Scene Node
-		mcpDestination = spTemp->cpSceneNode;
-	}
-	// Else if a Vector was given to track and we have a dummy Scene Node to use
-	else if (spTemp->cpVector != NULL && mcpAutoTrackingSceneNode != NULL)
-	{
-		// Place our dummy Scene Node at the position of the Vector and set it as the Destination		
-		mcpAutoTrackingSceneNode->setPosition(*spTemp->cpVector);
-		mcpDestination = mcpAutoTrackingSceneNode;
-	}
-	// Else we cannot use this Destination so try getting the next one
-	else
+	// If the Destination is not a Point or an Object which still exists, we cannot use it so try getting the next one
+	// NOTE: The Destinations position is read straight from the Point or the World State (see ReturnCurrentDestinationPosition()),
+	//		 so no Scene Nodes are needed to track it and Objects on different Threads never touch the Scene Graph
+	if (!msCurrentDestination.ReturnIfValid())
 	{
 		// Return after getting the Next Destination
 		return GetNextDestination();
 	}
 
-	// Delete the Destination instance now that we're done with it
-	delete spTemp;
-
 	// Mark that we haven't reached the Destination yet
 	mbDestinationReached = false;
 
@@ -1272,23 +1340,55 @@ bool CObject::GetNextDestination()
     return true;
 }
 
-// Return the current Destination to move to/face
-Ogre::SceneNode* CObject::GetCurrentDestination() const
+// Returns the Handle of the Object currently being moved to/faced
+SObjectHandle CObject::ReturnCurrentDestinationObject() const
+{
+	// If we are not tracking an Object
+	if (mbDestinationReached || msCurrentDestination.iType != GiDESTINATION_TYPE_OBJECT)
+	{
+		return SObjectHandle();
+	}
+
+	return msCurrentDestination.sObjectHandle;
+}
+
+// Returns the Position of the current Destination
+Ogre::Vector3 CObject::ReturnCurrentDestinationPosition() const
+{
+	// If we are tracking an Object, return where it was at the start of this Simulation Step (from the World State snapshot)
+	// NOTE: This way it doesn't matter if the Object has been moved yet this Step (or is being moved by another Thread)
+	if (msCurrentDestination.iType == GiDESTINATION_TYPE_OBJECT)
+	{
+		// If there is no World State (i.e. the Object is not part of a Game), use where the Object was before the last Step
+		if (SmcpWorldState == NULL)
+		{
+			return msCurrentDestination.cpObject->mspTransform->sPreviousPosition;
+		}
+
+		return SmcpWorldState->ReturnPosition(msCurrentDestination.cpObject);
+	}
+
+	// Else return the Point we are tracking (or zero if there is no Destination)
+	return msCurrentDestination.sPoint;
+}
+
+// Sets the World State every Object reads the Objects it is tracking from
+void CObject::SetWorldState(CWorldState const* _cpWorldState)
 {
-	return mcpDestination;
+	SmcpWorldState = _cpWorldState;
 }
 
 // Returns if the Object has reached all of it's Destinations or not
 bool CObject::GetIfObjectHasReachedAllDestinations() const
 {
-	return (mcDestinationList.empty() && mbDestinationReached);
+	return (mcDestinationList.ReturnIfEmpty() && mbDestinationReached);
 }
 
 // Points the Object towards the current Destination if one exists
 bool CObject::PointObjectTowardsDestination()
 {
 	// If there is no Destination to point towards
-	if (mbDestinationReached || mcpDestination == NULL)
+	if (mbDestinationReached)
 	{
 		// Exit the function since there is no Destination to point towards
 		return false;
@@ -1296,7 +1396,7 @@ bool CObject::PointObjectTowardsDestination()
 
 	// Make sure the Object is facing its Destination
 //	mcpSceneNode->setAutoTracking(true, mcpDestination, msObjectForwardDirection);
-	PointObjectTowardsLocation(mcpDestination->getWorldPosition());
+	PointObjectTowardsLocation(ReturnCurrentDestinationPosition());
 
 /*
 		The below code will point the Object towards it's Destination, but the Scene Nodes
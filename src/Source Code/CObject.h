@@ -18,10 +18,13 @@
 
 #include "CAIHelper.h"
 #include "CAttributes.h"
+#include "CDestinationQueue.h"
+#include "SComponents.h"
 #include <Ogre.h>			// Include OGRE
-#include <deque>			// Double-Ended Queue used to hold list of Destinations
 using namespace std;
 
+class CWorldState;		// Forward declaration (CWorldState.h includes this file)
+
 
 // Object States
 const int GiOBJECT_STATE_DEAD				= -1;
@@ -71,64 +74,6 @@ const int GiOBJECT_SPECIFIC_TYPE_DIAMOND			= 101;
 const int GiOBJECT_SPECIFIC_TYPE_ITEM_INDEX_END		= 101;
 
 
-// Structure to hold a Destination to automatically track
-struct SDestination
-{
-public:
-	// Only one of these 2 should ever be set, the other should be NULL
-	Ogre::SceneNode* cpSceneNode;	// If we are tracking a Scene Node, it holds the Scene Node to track
-	Ogre::Vector3* cpVector;		// If we are tracking a point in space, it holds the point to track
-
-	// Explicit Constructor - set just one of the pointers to track
-	SDestination(Ogre::SceneNode* _cpSceneNodeToTrack = NULL, Ogre::Vector3* _cpPointInWorldCoordinatesToTrack = NULL)
-	{
-		// Record the Scene Node to track
-		cpSceneNode = _cpSceneNodeToTrack;
-
-		// If an actual Scene Node was given to track, or no valid Vector was supplied
-		if (cpSceneNode != NULL || _cpPointInWorldCoordinatesToTrack == NULL)
-		{
-			// Make sure Vector is Null
-			cpVector = NULL;
-		}
-		// Else no Scene Node was given to track and Vector supplied is valid
-		else
-		{
-			// So create a copy of the Vector to track
-			cpVector = new Ogre::Vector3(*_cpPointInWorldCoordinatesToTrack);
-		}
-	}
-
-	// Destructor - Destroys the Vector but not the Scene Node (because we don't know what's attached 
-	//	to the Scene Node)
-	~SDestination()
-	{
-		// If we initialized a new Vector
-		if (cpVector != NULL)
-		{
-			delete cpVector;
-			cpVector = NULL;
-		}
-	}
-
-	// Overload the = operator
-	SDestination& operator =(const SDestination& sDestination)
-	{
-		cpSceneNode = sDestination.cpSceneNode;
-
-		// If there is no Vector to copy
-		if (sDestination.cpVector == NULL)
-		{
-			cpVector = NULL;
-		}
-		// Else there is a Vector to copy
-		else
-		{
-			cpVector = new Ogre::Vector3(*sDestination.cpVector);
-		}
-	}
-};
-
 // Structure to hold an external force on the Object
 struct SExternalForce
 {
@@ -382,6 +327,47 @@ public:
 	void Update(float fAmountOfTimeSinceLastUpdateInSeconds);
 
 
+	//---------- Transform Functions ----------
+
+	// NOTE: The Objects Position and Orientation are held in its Transform Component, so the simulation never has to
+	//		 go through the Scene Node. Call SyncSceneNodeWithTransform() once per frame to push them to the Scene Node
+
+	// Set/Get the Objects Position
+	void SetPosition(Ogre::Vector3 _sPosition);
+	Ogre::Vector3 GetPosition() const;
+
+	// Set/Get the Objects Orientation
+	void SetOrientation(Ogre::Quaternion _sOrientation);
+	Ogre::Quaternion GetOrientation() const;
+
+	// Moves the Object by the given Distance, relative to the given Transform Space
+	void Translate(Ogre::Vector3 _sDistance, Ogre::Node::TransformSpace _RelativeTo = Ogre::Node::TS_PARENT);
+
+	// Rotates the Object around the given Axis, relative to the given Transform Space
+	void Rotate(Ogre::Vector3 _sAxis, Ogre::Radian _sAngle, Ogre::Node::TransformSpace _RelativeTo = Ogre::Node::TS_LOCAL);
+
+	// Rotates the Object around its X (Pitch), Y (Yaw), or Z (Roll) axis
+	void Pitch(Ogre::Radian _sAngle, Ogre::Node::TransformSpace _RelativeTo = Ogre::Node::TS_LOCAL);
+	void Yaw(Ogre::Radian _sAngle, Ogre::Node::TransformSpace _RelativeTo = Ogre::Node::TS_LOCAL);
+	void Roll(Ogre::Radian _sAngle, Ogre::Node::TransformSpace _RelativeTo = Ogre::Node::TS_LOCAL);
+
+	// Copies the Scene Nodes Position and Orientation into the Object
+	// NOTE: Only needed if something other than this class moved the Scene Node
+	void ReadTransformFromSceneNode();
+
+	// Records the Objects current Position and Orientation as where it was before the next Simulation Step
+	// NOTE: Should be called before each Simulation Step, and after moving the Object somewhere new (so it doesn't slide there)
+	void SavePreviousTransform();
+
+	// Pushes the Objects Position and Orientation to its Scene Node (if it has one)
+	// _fInterpolation blends between the Previous Transform (0.0) and the current one (1.0)
+	void SyncSceneNodeWithTransform(float _fInterpolation = 1.0f);
+
+	// Set/Get the Objects Bounding Radius (cached when the Object is created so collisions do not query the Entity)
+	void SetBoundingRadius(float _fBoundingRadius);
+	float GetBoundingRadius() const;
+
+
 	// ---------- Easy Rotation Functions ----------
 
 	// Rotates the Object to face the given Location
@@ -396,12 +382,6 @@ public:
 
 	// ---------- Automatic Tracking Functions ----------
 
-	// Set/Get the dummy Scene Node to use to track Vectors (a static position)
-	// NOTE: This Scene Node should not be used by anything other than this class and should be a child
-	//		  of the root Scene Node
-	void SetExclusiveSceneNodeToUseForAutomaticTracking(Ogre::SceneNode* _cpExclusiveSceneNode);
-	Ogre::SceneNode* GetExclusiveSceneNodeUsedForAutomaticTracking() const;
-
 	// Sets if the Object should move towards it's Destinations automatically (true) or if the Object should
 	//	have free control to move itself around
 	// NOTE: If true, any calls to SetAcceleration/Velocity will be ignored until set back to false
@@ -415,8 +395,16 @@ public:
 	// Returns true if another Destination was found, false if not
 	bool GetNextDestination();
 
-	// Return the current Destination to move to/face
-	Ogre::SceneNode* GetCurrentDestination() const;
+	// Returns the Handle of the Object currently being moved to/faced
+	// NOTE: Returns a Null Handle if the Destination is a Point rather than an Object, or it has been reached
+	SObjectHandle ReturnCurrentDestinationObject() const;
+
+	// Returns the Position of the current Destination
+	// NOTE: An Object Destination's Position is read from the World State snapshot (where it was at the start of the Simulation Step)
+	Ogre::Vector3 ReturnCurrentDestinationPosition() const;
+
+	// Sets the World State every Object reads the Objects it is tracking from (see ReturnCurrentDestinationPosition())
+	static void SetWorldState(CWorldState const* _cpWorldState);
 
 	// Returns if the Object has reached all of it's Destinations or not
 	bool GetIfObjectHasReachedAllDestinations() const;
@@ -459,12 +447,26 @@ public:
 	Ogre::SceneNode* mcpSceneNode;	// Holds the Objects Scene Node (position/orientation)
 	Ogre::AnimationState* mcpAnimationState;	// Controls the animation of the Object
 
-	deque<SDestination*> mcDestinationList;		// Holds a list of Destinations the Object should go to
+	CDestinationQueue mcDestinationList;		// Holds a list of Destinations the Object should go to
 	list<SExternalForce> mcExternalForceList;	// Holds a list of External Forces to apply to the Object
 
-	CAttributes mcAttributes;		// Holds an Objects Attributes (health, lives, points, etc)
 	CAIHelper mcAIHelper;			// Holds the AI used to control this Object
 
+	// The Objects Components, which are kept packed together by the Object Pool (NULL if the Object doesn't have the Component)
+	// NOTE: The Pool keeps these pointing at the Objects own Components, so don't set them anywhere else
+	STransform* mspTransform;		// Where the Object is (every pooled Object has one)
+	SKinematics* mspKinematics;		// How the Object moves (every pooled Object has one)
+	SFishBrain* mspFishBrain;		// The Fish's age and Shark sensing (Flocking and Non-Flocking Fish)
+	SFlocking* mspFlocking;			// The Flocking Fish's Flocking values and Neighbor Candidates
+	SSharkBrain* mspSharkBrain;		// The Shark's hunting values
+	SCollectible* mspCollectible;	// The Item's dying state once it has been collected
+	CAttributes* mcpAttributes;		// Holds an Objects Attributes (health, lives, points, etc)
+
+	SObjectHandle msHandle;			// Handle to this Object in the Object Pool (Null if it's not in one)
+
+	// Let the Kinematic Integrator read the Destination data of the Objects it Updates in batches
+	friend class CKinematicIntegrator;
+
 protected:
 
 	//---------- Default Mesh Orientation Data ----------
@@ -474,32 +476,9 @@ protected:
 	Ogre::Vector3 msMeshRightDirection;		// Holds the meshes default Right direction
 
 
-	//---------- Movement Data ----------
-
-	Ogre::Vector3 msUnitVelocity, msUnitAcceleration;
-	float mfSpeed, mfAccelerationRate, mfFriction;
-	float mfMinVelocity, mfMaxVelocity, mfDefaultVelocity;
-	float mfMinAcceleration, mfMaxAcceleration, mfDefaultAcceleration;
-	bool mbUseMovementAcceleration, mbUseMovementFriction;		// Tells if Movement Acceleration/Friction should be calculated in Update()
-
-	Ogre::Vector3 msUnitRotationVelocity, msUnitRotationAcceleration;
-	float mfRotationSpeed, mfRotationAccelerationRate, mfRotationFriction;
-	float mfMinRotationVelocity, mfMaxRotationVelocity, mfDefaultRotationVelocity;
-	float mfMinRotationAcceleration, mfMaxRotationAcceleration, mfDefaultRotationAcceleration;
-	bool mbUseRotationAcceleration, mbUseRotationFriction;		// Tells if Rotation Acceleration/Friction should be calculated in Update()
-
-	// Ogre specific data - tells what this objects movements should be relative to (TS_LOCAL, TS_PARENT, or TS_WORLD)
-	Ogre::Node::TransformSpace mTranslationRelativeTo;	// What the Translation (relative movement) should be Relative To
-	Ogre::Node::TransformSpace mPitchRelativeTo;		// What the X-axis rotations should be Relative To
-	Ogre::Node::TransformSpace mYawRelativeTo;			// What the Y-axis rotations should be Relative To
-	Ogre::Node::TransformSpace mRollRelativeTo;			// What the Z-axis rotations should be Relative To
-
-
 	// ---------- Automatic Tracking Data ----------
 
-	Ogre::SceneNode* mcpAutoTrackingSceneNode;	// A Scene Node used exclusively by this Object to track a given Vector Destination
-
-	Ogre::SceneNode* mcpDestination;		// The Destination the Object is moving to
+	SDestination msCurrentDestination;		// The Destination the Object is moving to (a Point, or an Object's Handle, so no Scene Nodes are needed to track it)
 	float mfDistanceToDestination;			// The Distance between the Object and it's current Destination
 	Ogre::Vector3 msDirectionToDestination;	// The Direction from the Object to the Destination
 
@@ -517,7 +496,7 @@ protected:
 	int miState;					// Holds the current State of the Object
 	bool mbCollision;				// Tells if Object is colliding with other Objects
 
-	float mfDurationSinceLastUpdateInSeconds;	// Holds how much time passed between the 2nd last Update() and the last Update() performed
+	static CWorldState const* SmcpWorldState;	// Holds the World State the Objects being tracked are read from
 };
 
 #endif
@@ -0,0 +1,519 @@
+#include "CObjectPool.h"
+
+//---------- Contructors and Setup Functions ----------
+
+// Default Constructor
+CObjectPool::CObjectPool()
+{
+	Purge();
+}
+
+// Destructor
+CObjectPool::~CObjectPool()
+{
+	Purge();
+}
+
+// Removes all Objects from the Pool, the same as Removing each of them, so Handles from before the Purge become invalid
+void CObjectPool::Purge()
+{
+	// Free every Slot instead of throwing the Slots away, otherwise their Generations would start over and old Handles would become valid again
+	FreeAllSlots();
+
+	mcDenseObjectList.clear();
+	mcDenseSlotList.clear();
+
+	for (int iComponent = 0; iComponent < GiNUMBER_OF_COMPONENTS; iComponent++)
+	{
+		mcaComponentObjectList[iComponent].clear();
+		mcaComponentSlotList[iComponent].clear();
+	}
+
+	mcTransformList.clear();
+	mcKinematicsList.clear();
+	mcAttributesList.clear();
+	mcFishBrainList.clear();
+	mcFlockingList.clear();
+	mcSharkBrainList.clear();
+	mcCollectibleList.clear();
+}
+
+
+
+//---------- Object Functions ----------
+
+// Puts a new Object into a free Slot and returns its Handle
+SObjectHandle CObjectPool::InsertNewObject()
+{
+	int iSlot = 0;
+
+	// If there is a free Slot, reuse it (its Object was Purged when it was Removed, so it is already a new Object)
+	if (!mcFreeSlotList.empty())
+	{
+		iSlot = mcFreeSlotList.back();
+		mcFreeSlotList.pop_back();
+	}
+	// Else create a new Slot with a new Object in it
+	else
+	{
+		iSlot = CreateSlot();
+		mcSlotObjectList.push_back(CObject());
+	}
+
+	SObjectHandle sHandle = ActivateSlot(iSlot);
+
+	// Every Object has a Transform and Kinematics
+	AddComponent(sHandle, GiCOMPONENT_TRANSFORM);
+	AddComponent(sHandle, GiCOMPONENT_KINEMATICS);
+
+	return sHandle;
+}
+
+// Makes room for the given number of Objects so Inserting them does not need to grow the Pool's arrays
+void CObjectPool::ReserveObjects(int _iNumberOfObjects)
+{
+	// If there is already room for that many Objects
+	if (_iNumberOfObjects <= (int)mcDenseObjectList.capacity())
+	{
+		return;
+	}
+
+	mcSlotList.reserve(_iNumberOfObjects);
+	mcFreeSlotList.reserve(_iNumberOfObjects);
+	mcDenseObjectList.reserve(_iNumberOfObjects);
+	mcDenseSlotList.reserve(_iNumberOfObjects);
+
+	// Any of the Objects could be given each Component, so make room for all of them in each Components index list too
+	for (int iComponent = 0; iComponent < GiNUMBER_OF_COMPONENTS; iComponent++)
+	{
+		mcaComponentObjectList[iComponent].reserve(_iNumberOfObjects);
+		mcaComponentSlotList[iComponent].reserve(_iNumberOfObjects);
+	}
+	mcTransformList.reserve(_iNumberOfObjects);
+	mcKinematicsList.reserve(_iNumberOfObjects);
+	mcAttributesList.reserve(_iNumberOfObjects);
+	mcFishBrainList.reserve(_iNumberOfObjects);
+	mcFlockingList.reserve(_iNumberOfObjects);
+	mcSharkBrainList.reserve(_iNumberOfObjects);
+	mcCollectibleList.reserve(_iNumberOfObjects);
+}
+
+// Removes the Object from the Pool, making any Handles to it invalid
+bool CObjectPool::RemoveObject(SObjectHandle _sHandle)
+{
+	// If the Handle is already invalid
+	if (!ReturnIfHandleIsValid(_sHandle))
+	{
+		return false;
+	}
+
+	int iSlot = _sHandle.iSlot;
+	int iDenseIndex = mcSlotList[iSlot].iDenseIndex;
+	int iLastDenseIndex = (int)mcDenseObjectList.size() - 1;
+
+	// Take the Object out of the lists of each Component it has
+	for (int iComponent = 0; iComponent < GiNUMBER_OF_COMPONENTS; iComponent++)
+	{
+		RemoveComponent(_sHandle, iComponent);
+	}
+
+	// Move the last Object in the dense array into the Removed Objects Index so the array stays packed
+	mcDenseObjectList[iDenseIndex] = mcDenseObjectList[iLastDenseIndex];
+	mcDenseSlotList[iDenseIndex] = mcDenseSlotList[iLastDenseIndex];
+	mcSlotList[mcDenseSlotList[iDenseIndex]].iDenseIndex = iDenseIndex;
+	mcDenseObjectList.pop_back();
+	mcDenseSlotList.pop_back();
+
+	// Erase the Object and change the Slot's Generation so any Handles to it become invalid
+	mcSlotObjectList[iSlot].Purge();
+	mcSlotList[iSlot].uiGeneration++;
+	mcSlotList[iSlot].iDenseIndex = -1;
+	mcFreeSlotList.push_back(iSlot);
+
+	return true;
+}
+
+// Returns the Object the Handle refers to, or NULL if it no longer exists
+CObject* CObjectPool::ReturnObject(SObjectHandle _sHandle) const
+{
+	// If the Object no longer exists
+	if (!ReturnIfHandleIsValid(_sHandle))
+	{
+		return NULL;
+	}
+
+	return mcDenseObjectList[mcSlotList[_sHandle.iSlot].iDenseIndex];
+}
+
+// Returns if the Object the Handle refers to still exists
+bool CObjectPool::ReturnIfHandleIsValid(SObjectHandle _sHandle) const
+{
+	return (_sHandle.iSlot >= 0 && _sHandle.iSlot < (int)mcSlotList.size() &&
+			mcSlotList[_sHandle.iSlot].uiGeneration == _sHandle.uiGeneration &&
+			mcSlotList[_sHandle.iSlot].iDenseIndex != -1);
+}
+
+
+
+//---------- Component Functions ----------
+
+// Gives the Object a new copy of the Component. Returns false if the Handle is invalid
+bool CObjectPool::AddComponent(SObjectHandle _sHandle, int _iComponent)
+{
+	// If the Object or Component doesn't exist
+	if (!ReturnIfHandleIsValid(_sHandle) || !ReturnIfComponentIsValid(_iComponent))
+	{
+		return false;
+	}
+
+	// If the Object already has the Component
+	SSlot& sSlot = mcSlotList[_sHandle.iSlot];
+	if (sSlot.iaComponentIndex[_iComponent] != -1)
+	{
+		return true;
+	}
+
+	// Add the Object and a new copy of the Component's data to the end of the Components lists
+	bool bDataMoved = PushComponentData(_iComponent);
+	sSlot.iaComponentIndex[_iComponent] = (int)mcaComponentObjectList[_iComponent].size();
+	mcaComponentObjectList[_iComponent].push_back(&mcSlotObjectList[_sHandle.iSlot]);
+	mcaComponentSlotList[_iComponent].push_back(_sHandle.iSlot);
+
+	// If the Component's array had to grow, every Object with the Component must be pointed at where its copy moved to
+	if (bDataMoved)
+	{
+		vector<int>& cSlotList = mcaComponentSlotList[_iComponent];
+		for (int iIndex = 0; iIndex < (int)cSlotList.size(); iIndex++)
+		{
+			AttachComponent(cSlotList[iIndex], _iComponent);
+		}
+	}
+	// Else only the new Object needs to be pointed at its copy
+	else
+	{
+		AttachComponent(_sHandle.iSlot, _iComponent);
+	}
+	return true;
+}
+
+// Takes the Component away from the Object. Returns false if the Object did not have it
+bool CObjectPool::RemoveComponent(SObjectHandle _sHandle, int _iComponent)
+{
+	// If the Object doesn't have the Component
+	if (!ReturnIfObjectHasComponent(_sHandle, _iComponent))
+	{
+		return false;
+	}
+
+	vector<CObject*>& cObjectList = mcaComponentObjectList[_iComponent];
+	vector<int>& cSlotList = mcaComponentSlotList[_iComponent];
+	int iComponentIndex = mcSlotList[_sHandle.iSlot].iaComponentIndex[_iComponent];
+	int iLastComponentIndex = (int)cObjectList.size() - 1;
+
+	// Move the last Object (and its copy of the Component) in the Components lists into the Removed Objects Index so the arrays stay packed
+	cObjectList[iComponentIndex] = cObjectList[iLastComponentIndex];
+	cSlotList[iComponentIndex] = cSlotList[iLastComponentIndex];
+	mcSlotList[cSlotList[iComponentIndex]].iaComponentIndex[_iComponent] = iComponentIndex;
+	cObjectList.pop_back();
+	cSlotList.pop_back();
+	RemoveComponentData(_iComponent, iComponentIndex);
+
+	// If another Object was moved, point it at where its copy moved to
+	if (iComponentIndex != iLastComponentIndex)
+	{
+		AttachComponent(cSlotList[iComponentIndex], _iComponent);
+	}
+
+	// The Object no longer has the Component
+	mcSlotList[_sHandle.iSlot].iaComponentIndex[_iComponent] = -1;
+	AttachComponent(_sHandle.iSlot, _iComponent);
+	return true;
+}
+
+// Returns if the Object has the Component
+bool CObjectPool::ReturnIfObjectHasComponent(SObjectHandle _sHandle, int _iComponent) const
+{
+	return (ReturnIfHandleIsValid(_sHandle) && ReturnIfComponentIsValid(_iComponent) &&
+			mcSlotList[_sHandle.iSlot].iaComponentIndex[_iComponent] != -1);
+}
+
+// Returns how many Objects have the Component
+int CObjectPool::ReturnNumberOfObjectsWithComponent(int _iComponent) const
+{
+	return ReturnIfComponentIsValid(_iComponent) ? (int)mcaComponentObjectList[_iComponent].size() : 0;
+}
+
+// Returns the Object at the given Index of the Objects with the Component
+CObject& CObjectPool::ReturnObjectWithComponentAtIndex(int _iComponent, int _iIndex) const
+{
+	return *mcaComponentObjectList[_iComponent][_iIndex];
+}
+
+// Returns the Transform at the given Index of the Objects with a Transform
+STransform& CObjectPool::ReturnTransformAtIndex(int _iIndex)
+{
+	return mcTransformList[_iIndex];
+}
+
+// Returns the Kinematics at the given Index of the Objects with Kinematics
+SKinematics& CObjectPool::ReturnKinematicsAtIndex(int _iIndex)
+{
+	return mcKinematicsList[_iIndex];
+}
+
+// Returns the Attributes at the given Index of the Objects with Attributes
+CAttributes& CObjectPool::ReturnAttributesAtIndex(int _iIndex)
+{
+	return mcAttributesList[_iIndex];
+}
+
+// Returns the Fish Brain at the given Index of the Objects with a Fish Brain
+SFishBrain& CObjectPool::ReturnFishBrainAtIndex(int _iIndex)
+{
+	return mcFishBrainList[_iIndex];
+}
+
+// Returns the Flocking at the given Index of the Objects with Flocking
+SFlocking& CObjectPool::ReturnFlockingAtIndex(int _iIndex)
+{
+	return mcFlockingList[_iIndex];
+}
+
+// Returns the Shark Brain at the given Index of the Objects with a Shark Brain
+SSharkBrain& CObjectPool::ReturnSharkBrainAtIndex(int _iIndex)
+{
+	return mcSharkBrainList[_iIndex];
+}
+
+// Returns the Collectible at the given Index of the Objects with a Collectible
+SCollectible& CObjectPool::ReturnCollectibleAtIndex(int _iIndex)
+{
+	return mcCollectibleList[_iIndex];
+}
+
+
+
+//---------- Looping Functions ----------
+
+// Returns how many Objects are in the Pool
+int CObjectPool::ReturnNumberOfObjects() const
+{
+	return (int)mcDenseObjectList.size();
+}
+
+// Returns the Object at the given Index
+CObject& CObjectPool::ReturnObjectAtIndex(int _iIndex) const
+{
+	return *mcDenseObjectList[_iIndex];
+}
+
+
+
+//---------- Private Functions ----------
+
+// Removes every Object, keeping the Slots (used by Purge())
+void CObjectPool::FreeAllSlots()
+{
+	int iSlot = 0;
+
+	// Loop through each Slot
+	for (iSlot = 0; iSlot < (int)mcSlotList.size(); iSlot++)
+	{
+		SSlot& sSlot = mcSlotList[iSlot];
+
+		// If the Slot has an Object in it
+		if (sSlot.iDenseIndex != -1)
+		{
+			// Erase the Object and change the Slot's Generation so any Handles to it become invalid
+			mcSlotObjectList[iSlot].Purge();
+			sSlot.uiGeneration++;
+			sSlot.iDenseIndex = -1;
+		}
+
+		// The Object no longer has any Components
+		for (int iComponent = 0; iComponent < GiNUMBER_OF_COMPONENTS; iComponent++)
+		{
+			sSlot.iaComponentIndex[iComponent] = -1;
+		}
+	}
+
+	// Every Slot is now free (added backwards so the lowest Slots are reused first, same as a new Pool)
+	mcFreeSlotList.clear();
+	for (iSlot = (int)mcSlotList.size() - 1; iSlot >= 0; iSlot--)
+	{
+		mcFreeSlotList.push_back(iSlot);
+	}
+}
+
+// Adds a new (free) Slot and returns it
+// NOTE: The caller must push the Slot's Object onto the end of mcSlotObjectList
+int CObjectPool::CreateSlot()
+{
+	SSlot sSlot;
+	sSlot.uiGeneration = 0;
+	sSlot.iDenseIndex = -1;
+	for (int iComponent = 0; iComponent < GiNUMBER_OF_COMPONENTS; iComponent++)
+	{
+		sSlot.iaComponentIndex[iComponent] = -1;
+	}
+	mcSlotList.push_back(sSlot);
+
+	return ((int)mcSlotList.size() - 1);
+}
+
+// Adds the Object in the Slot to the end of the dense array and returns its Handle (also stored in the Objects msHandle)
+SObjectHandle CObjectPool::ActivateSlot(int _iSlot)
+{
+	// Add the Object to the end of the dense array
+	CObject* cpObject = &mcSlotObjectList[_iSlot];
+	mcSlotList[_iSlot].iDenseIndex = (int)mcDenseObjectList.size();
+	mcDenseObjectList.push_back(cpObject);
+	mcDenseSlotList.push_back(_iSlot);
+
+	// Let the Object know its own Handle
+	cpObject->msHandle = SObjectHandle(_iSlot, mcSlotList[_iSlot].uiGeneration);
+
+	return cpObject->msHandle;
+}
+
+// Returns if the Component is valid
+bool CObjectPool::ReturnIfComponentIsValid(int _iComponent) const
+{
+	return (_iComponent >= 0 && _iComponent < GiNUMBER_OF_COMPONENTS);
+}
+
+// Adds a new copy of the Component's data to the end of its packed array. Returns true if the array had to grow
+bool CObjectPool::PushComponentData(int _iComponent)
+{
+	unsigned int uiCapacity = 0;
+	bool bDataMoved = false;
+
+	switch (_iComponent)
+	{
+		case GiCOMPONENT_TRANSFORM:
+			uiCapacity = (unsigned int)mcTransformList.capacity();
+			mcTransformList.push_back(STransform());
+			bDataMoved = (mcTransformList.capacity() != uiCapacity);
+		break;
+
+		case GiCOMPONENT_KINEMATICS:
+			uiCapacity = (unsigned int)mcKinematicsList.capacity();
+			mcKinematicsList.push_back(SKinematics());
+			bDataMoved = (mcKinematicsList.capacity() != uiCapacity);
+		break;
+
+		case GiCOMPONENT_ATTRIBUTES:
+			uiCapacity = (unsigned int)mcAttributesList.capacity();
+			mcAttributesList.push_back(CAttributes());
+			bDataMoved = (mcAttributesList.capacity() != uiCapacity);
+		break;
+
+		case GiCOMPONENT_FISH_BRAIN:
+			uiCapacity = (unsigned int)mcFishBrainList.capacity();
+			mcFishBrainList.push_back(SFishBrain());
+			bDataMoved = (mcFishBrainList.capacity() != uiCapacity);
+		break;
+
+		case GiCOMPONENT_FLOCKING:
+			uiCapacity = (unsigned int)mcFlockingList.capacity();
+			mcFlockingList.push_back(SFlocking());
+			bDataMoved = (mcFlockingList.capacity() != uiCapacity);
+		break;
+
+		case GiCOMPONENT_SHARK_BRAIN:
+			uiCapacity = (unsigned int)mcSharkBrainList.capacity();
+			mcSharkBrainList.push_back(SSharkBrain());
+			bDataMoved = (mcSharkBrainList.capacity() != uiCapacity);
+		break;
+
+		case GiCOMPONENT_COLLECTIBLE:
+			uiCapacity = (unsigned int)mcCollectibleList.capacity();
+			mcCollectibleList.push_back(SCollectible());
+			bDataMoved = (mcCollectibleList.capacity() != uiCapacity);
+		break;
+
+		default:
+		break;
+	}
+
+	return bDataMoved;
+}
+
+// Moves the last copy of the Component's data into the given Index and removes the last copy
+void CObjectPool::RemoveComponentData(int _iComponent, int _iIndex)
+{
+	switch (_iComponent)
+	{
+		case GiCOMPONENT_TRANSFORM:
+			RemoveFromPackedArray(mcTransformList, _iIndex);
+		break;
+
+		case GiCOMPONENT_KINEMATICS:
+			RemoveFromPackedArray(mcKinematicsList, _iIndex);
+		break;
+
+		case GiCOMPONENT_ATTRIBUTES:
+			RemoveFromPackedArray(mcAttributesList, _iIndex);
+		break;
+
+		case GiCOMPONENT_FISH_BRAIN:
+			RemoveFromPackedArray(mcFishBrainList, _iIndex);
+		break;
+
+		case GiCOMPONENT_FLOCKING:
+			RemoveFromPackedArray(mcFlockingList, _iIndex);
+		break;
+
+		case GiCOMPONENT_SHARK_BRAIN:
+			RemoveFromPackedArray(mcSharkBrainList, _iIndex);
+		break;
+
+		case GiCOMPONENT_COLLECTIBLE:
+			RemoveFromPackedArray(mcCollectibleList, _iIndex);
+		break;
+
+		default:
+		break;
+	}
+}
+
+// Points the Object in the Slot at its copy of the Component (or NULL if it doesn't have the Component)
+void CObjectPool::AttachComponent(int _iSlot, int _iComponent)
+{
+	CObject& cObject = mcSlotObjectList[_iSlot];
+	int iIndex = mcSlotList[_iSlot].iaComponentIndex[_iComponent];
+
+	switch (_iComponent)
+	{
+		case GiCOMPONENT_TRANSFORM:
+			cObject.mspTransform = (iIndex == -1) ? NULL : &mcTransformList[iIndex];
+		break;
+
+		case GiCOMPONENT_KINEMATICS:
+			cObject.mspKinematics = (iIndex == -1) ? NULL : &mcKinematicsList[iIndex];
+		break;
+
+		case GiCOMPONENT_ATTRIBUTES:
+			cObject.mcpAttributes = (iIndex == -1) ? NULL : &mcAttributesList[iIndex];
+		break;
+
+		case GiCOMPONENT_FISH_BRAIN:
+			cObject.mspFishBrain = (iIndex == -1) ? NULL : &mcFishBrainList[iIndex];
+		break;
+
+		case GiCOMPONENT_FLOCKING:
+			cObject.mspFlocking = (iIndex == -1) ? NULL : &mcFlockingList[iIndex];
+		break;
+
+		case GiCOMPONENT_SHARK_BRAIN:
+			cObject.mspSharkBrain = (iIndex == -1) ? NULL : &mcSharkBrainList[iIndex];
+		break;
+
+		case GiCOMPONENT_COLLECTIBLE:
+			cObject.mspCollectible = (iIndex == -1) ? NULL : &mcCollectibleList[iIndex];
+		break;
+
+		default:
+		break;
+	}
+}
@@ -0,0 +1,190 @@
+/////////////////////////////////////////////////////////////////////
+// CObjectPool.h (and CObjectPool.cpp)
+// Written by Daniel Schroeder
+// Created on October 17, 2026
+// Last Updated October 17, 2026
+//-------------------------------------------------------------------
+//   The CObjectPool class holds all of the Objects in the level. Each
+// Object is put in a Slot and referred to by an SObjectHandle; when an
+// Object is Removed its Slot's Generation changes, so any Handles still
+// referring to it become invalid (ReturnObject() returns NULL) and the
+// Slot can be reused right away.
+//   Objects never move once they are Inserted, so a CObject* stays valid
+// until the Object is Removed. The living Objects are also kept in a
+// dense array so they can be looped through quickly by Index (it holds
+// pointers to the Objects rather than the Objects themselves, since
+// packing the Objects would move them whenever one was Removed and break
+// the CObject*s kept by the Grids, Scheduler, and Events):
+//		for (int i = 0; i < cPool.ReturnNumberOfObjects(); i++)
+//			cPool.ReturnObjectAtIndex(i).Update(...);
+// NOTE: Removing an Object moves the last Object into its Index, so when
+//		 Removing while looping through the Objects do not move to the next
+//		 Index, and reduce the number of Objects being looped through by one.
+//   Objects are also given Components (see SComponents.h), which hold the
+// data each of CGame's update loops (Systems) works on. The Pool keeps
+// every Object's copy of a Component packed together in one array per
+// Component, next to an index list of the Objects with it, so a System
+// loops straight through the data it needs instead of through every
+// Object in the Level, and doesn't need to check each Objects type:
+//		for (int i = 0; i < cPool.ReturnNumberOfObjectsWithComponent(GiCOMPONENT_FLOCKING); i++)
+//			cPool.ReturnFlockingAtIndex(i) ... cPool.ReturnObjectWithComponentAtIndex(GiCOMPONENT_FLOCKING, i) ...
+//   Every Object gets a Transform and Kinematics when it is Inserted; the
+// rest are Added as needed. An Object reaches its own Components through
+// its Component pointers (e.g. CObject::mspFlocking), which the Pool keeps
+// up to date, and which are NULL for Components the Object doesn't have.
+// Removing an Object also removes its Components.
+// NOTE: Adding or Removing a Component moves the Component data around
+//		 (the same as the dense array above), so don't hold on to a pointer
+//		 or reference to a Component across an Add or Remove.
+/////////////////////////////////////////////////////////////////////
+
+#ifndef COBJECT_POOL_H
+#define COBJECT_POOL_H
+
+#include "CObject.h"
+#include "SComponents.h"
+#include "SObjectHandle.h"
+#include <deque>			// Objects are held in a deque so they never move
+#include <vector>
+using namespace std;
+
+// The Components an Object can have
+const int GiCOMPONENT_TRANSFORM			= 0;	// Every Object (Position, Orientation, Bounding Radius)
+const int GiCOMPONENT_KINEMATICS		= 1;	// Every Object (Velocities, Accelerations, Frictions)
+const int GiCOMPONENT_ATTRIBUTES		= 2;	// Objects with Health or Points (the Player, Fish, Sharks, and Items)
+const int GiCOMPONENT_FISH_BRAIN		= 3;	// Fish which Perform their own AI (Flocking and Non-Flocking Fish)
+const int GiCOMPONENT_FLOCKING			= 4;	// Fish which Flock (are in the Spatial Grid and Flocking Kernel, and can form Schools)
+const int GiCOMPONENT_SHARK_BRAIN		= 5;	// Sharks
+const int GiCOMPONENT_COLLECTIBLE		= 6;	// Items the Player can collect
+const int GiNUMBER_OF_COMPONENTS		= 7;
+
+class CObjectPool
+{
+public:
+
+	//---------- Contructors and Setup Functions ----------
+
+	CObjectPool();										// Default Constructor
+	~CObjectPool();										// Destructor
+
+	// Removes all Objects from the Pool, the same as Removing each of them, so Handles from before the Purge become invalid
+	// NOTE: The Slots are kept (and reused by the next Objects Inserted), so their Generations keep counting up
+	void Purge();
+
+
+	//---------- Object Functions ----------
+
+	// Puts a new (Purged) Object with a new Transform and Kinematics into a free Slot and returns its Handle (also stored in the new Objects msHandle)
+	// NOTE: The Object is set up in place (through ReturnObject()), since its Components live in the Pool
+	SObjectHandle InsertNewObject();
+
+	// Makes room for the given number of Objects so Inserting them does not need to grow the Pool's arrays
+	void ReserveObjects(int _iNumberOfObjects);
+
+	// Removes the Object from the Pool, making any Handles to it invalid. Returns false if the Handle was already invalid
+	bool RemoveObject(SObjectHandle _sHandle);
+
+	// Returns the Object the Handle refers to, or NULL if it no longer exists
+	CObject* ReturnObject(SObjectHandle _sHandle) const;
+
+	// Returns if the Object the Handle refers to still exists
+	bool ReturnIfHandleIsValid(SObjectHandle _sHandle) const;
+
+
+	//---------- Component Functions ----------
+
+	// Gives the Object a new (Purged) copy of the Component. Returns false if the Handle is invalid
+	bool AddComponent(SObjectHandle _sHandle, int _iComponent);
+
+	// Takes the Component away from the Object. Returns false if the Object did not have it
+	bool RemoveComponent(SObjectHandle _sHandle, int _iComponent);
+
+	// Returns if the Object has the Component
+	bool ReturnIfObjectHasComponent(SObjectHandle _sHandle, int _iComponent) const;
+
+	// Returns how many Objects have the Component
+	int ReturnNumberOfObjectsWithComponent(int _iComponent) const;
+
+	// Returns the Object at the given Index (0 to ReturnNumberOfObjectsWithComponent() - 1) of the Objects with the Component
+	CObject& ReturnObjectWithComponentAtIndex(int _iComponent, int _iIndex) const;
+
+	// Returns the Component data at the given Index of the Objects with the Component (the same Index as ReturnObjectWithComponentAtIndex())
+	STransform& ReturnTransformAtIndex(int _iIndex);
+	SKinematics& ReturnKinematicsAtIndex(int _iIndex);
+	CAttributes& ReturnAttributesAtIndex(int _iIndex);
+	SFishBrain& ReturnFishBrainAtIndex(int _iIndex);
+	SFlocking& ReturnFlockingAtIndex(int _iIndex);
+	SSharkBrain& ReturnSharkBrainAtIndex(int _iIndex);
+	SCollectible& ReturnCollectibleAtIndex(int _iIndex);
+
+
+	//---------- Looping Functions ----------
+
+	// Returns how many Objects are in the Pool
+	int ReturnNumberOfObjects() const;
+
+	// Returns the Object at the given Index (0 to ReturnNumberOfObjects() - 1)
+	CObject& ReturnObjectAtIndex(int _iIndex) const;
+
+private:
+
+	// Holds the information about one Slot
+	struct SSlot
+	{
+		unsigned int uiGeneration;		// Changes every time the Slot's Object is Removed
+		int iDenseIndex;				// Where the Slot's Object is in the dense array (-1 if the Slot is free)
+		int iaComponentIndex[GiNUMBER_OF_COMPONENTS];	// Where the Slot's Object is in each Components index list (-1 if it doesn't have the Component)
+	};
+
+	// Removes every Object, keeping the Slots (used by Purge())
+	void FreeAllSlots();
+
+	// Adds a new (free) Slot and returns it
+	// NOTE: The caller must push the Slot's Object onto the end of mcSlotObjectList
+	int CreateSlot();
+
+	// Adds the Object in the Slot to the end of the dense array and returns its Handle
+	SObjectHandle ActivateSlot(int _iSlot);
+
+	// Returns if the Component is valid
+	bool ReturnIfComponentIsValid(int _iComponent) const;
+
+	// Adds a new copy of the Component's data to the end of its packed array (the caller adds the Object to the index list)
+	// Returns true if the array had to grow, which moved every copy of the Component
+	bool PushComponentData(int _iComponent);
+
+	// Moves the last copy of the Component's data into the given Index and removes the last copy (same as the index lists)
+	void RemoveComponentData(int _iComponent, int _iIndex);
+
+	// Points the Object in the Slot at its copy of the Component (or NULL if it doesn't have the Component)
+	void AttachComponent(int _iSlot, int _iComponent);
+
+	// Moves the last entry of the packed array into the given Index so the array stays packed
+	template <class TComponent>
+	static void RemoveFromPackedArray(vector<TComponent>& _cArray, int _iIndex)
+	{
+		_cArray[_iIndex] = _cArray.back();
+		_cArray.pop_back();
+	}
+
+	deque<CObject> mcSlotObjectList;	// Holds the Object in each Slot (never moves, so pointers stay valid)
+	vector<SSlot> mcSlotList;			// Holds the information about each Slot
+	vector<int> mcFreeSlotList;			// Holds the Slots which are not being used
+
+	vector<CObject*> mcDenseObjectList;	// Holds the living Objects, packed together for looping through
+	vector<int> mcDenseSlotList;		// Holds the Slot of each Object in the dense array
+
+	vector<CObject*> mcaComponentObjectList[GiNUMBER_OF_COMPONENTS];	// Index list of the Objects with each Component, packed together for looping through
+	vector<int> mcaComponentSlotList[GiNUMBER_OF_COMPONENTS];		// Holds the Slot of each Object in the Components index lists
+
+	// The Components data, packed together in the same order as the Components index lists
+	vector<STransform> mcTransformList;
+	vector<SKinematics> mcKinematicsList;
+	vector<CAttributes> mcAttributesList;
+	vector<SFishBrain> mcFishBrainList;
+	vector<SFlocking> mcFlockingList;
+	vector<SSharkBrain> mcSharkBrainList;
+	vector<SCollectible> mcCollectibleList;
+};
+
+#endif
@@ -0,0 +1,197 @@
+#include "CPopulationController.h"
+
+//---------- Contructors and Setup Functions ----------
+
+// Default Constructor
+CPopulationController::CPopulationController()
+{
+	// Start each Population with no Target
+	for (int iPopulation = 0; iPopulation < GiNUMBER_OF_POPULATIONS; iPopulation++)
+	{
+		miaTargetCount[iPopulation] = 0;
+		mfaSpawnRate[iPopulation] = 1.0f;
+	}
+	miMaxSpawnsPerStep = 1;
+
+	Reset();
+}
+
+// Destructor
+CPopulationController::~CPopulationController()
+{
+	Reset();
+}
+
+// Removes all Spawn Credit and resets the Statistics
+void CPopulationController::Reset()
+{
+	for (int iPopulation = 0; iPopulation < GiNUMBER_OF_POPULATIONS; iPopulation++)
+	{
+		mfaSpawnCredit[iPopulation] = 0.0f;
+		miaNumberOfSpawnsDue[iPopulation] = 0;
+		miaNumberOfSpawnsThisStep[iPopulation] = 0;
+	}
+
+	mulNumberOfSpawns = 0;
+	miMostSpawnsInAStep = 0;
+}
+
+// Sets how many Objects the Population should have
+void CPopulationController::SetTargetCount(int _iPopulation, int _iTargetCount)
+{
+	if (ReturnIfPopulationIsValid(_iPopulation))
+	{
+		miaTargetCount[_iPopulation] = (_iTargetCount > 0) ? _iTargetCount : 0;
+	}
+}
+
+// Returns how many Objects the Population should have
+int CPopulationController::GetTargetCount(int _iPopulation) const
+{
+	return ReturnIfPopulationIsValid(_iPopulation) ? miaTargetCount[_iPopulation] : 0;
+}
+
+// Sets how many Objects per second the Population may spawn while it is below its Target
+void CPopulationController::SetSpawnRate(int _iPopulation, float _fObjectsPerSecond)
+{
+	if (ReturnIfPopulationIsValid(_iPopulation))
+	{
+		mfaSpawnRate[_iPopulation] = (_fObjectsPerSecond > 0.0f) ? _fObjectsPerSecond : 0.0f;
+	}
+}
+
+// Returns how many Objects per second the Population may spawn while it is below its Target
+float CPopulationController::GetSpawnRate(int _iPopulation) const
+{
+	return ReturnIfPopulationIsValid(_iPopulation) ? mfaSpawnRate[_iPopulation] : 0.0f;
+}
+
+// Sets the most Objects each Population may spawn in one Step
+void CPopulationController::SetMaxSpawnsPerStep(int _iMaxSpawnsPerStep)
+{
+	miMaxSpawnsPerStep = (_iMaxSpawnsPerStep > 0) ? _iMaxSpawnsPerStep : 0;
+}
+
+// Returns the most Objects each Population may spawn in one Step
+int CPopulationController::GetMaxSpawnsPerStep() const
+{
+	return miMaxSpawnsPerStep;
+}
+
+
+
+//---------- Update Functions ----------
+
+// Adds the Spawn Credit earned over the Time Step, and works out how many Objects the Population may spawn this Step
+void CPopulationController::Update(int _iPopulation, int _iCurrentCount, float _fTimeStep)
+{
+	if (!ReturnIfPopulationIsValid(_iPopulation))
+	{
+		return;
+	}
+
+	// Record how many Objects the Population spawned last Step
+	if (miaNumberOfSpawnsThisStep[_iPopulation] > miMostSpawnsInAStep)
+	{
+		miMostSpawnsInAStep = miaNumberOfSpawnsThisStep[_iPopulation];
+	}
+	miaNumberOfSpawnsThisStep[_iPopulation] = 0;
+
+	// If the Population is not below its Target
+	int iDeficit = miaTargetCount[_iPopulation] - _iCurrentCount;
+	if (iDeficit <= 0)
+	{
+		// Don't save up Credit while there is nothing to replace
+		mfaSpawnCredit[_iPopulation] = 0.0f;
+		miaNumberOfSpawnsDue[_iPopulation] = 0;
+		return;
+	}
+
+	// If there is no Spawn Rate, all of the missing Objects may be spawned
+	if (mfaSpawnRate[_iPopulation] <= 0.0f)
+	{
+		mfaSpawnCredit[_iPopulation] = (float)iDeficit;
+	}
+	// Else earn Credit for the time which has passed
+	else if (_fTimeStep > 0.0f)
+	{
+		mfaSpawnCredit[_iPopulation] += mfaSpawnRate[_iPopulation] * _fTimeStep;
+	}
+
+	// Never save up more Credit than there are Objects missing (so a long Step doesn't cause a burst of spawns later)
+	if (mfaSpawnCredit[_iPopulation] > (float)iDeficit)
+	{
+		mfaSpawnCredit[_iPopulation] = (float)iDeficit;
+	}
+
+	// Spawn as many whole Objects as there is Credit for, up to the Max Spawns Per Step
+	int iNumberOfSpawnsDue = (int)mfaSpawnCredit[_iPopulation];
+	if (miMaxSpawnsPerStep > 0 && iNumberOfSpawnsDue > miMaxSpawnsPerStep)
+	{
+		iNumberOfSpawnsDue = miMaxSpawnsPerStep;
+	}
+	miaNumberOfSpawnsDue[_iPopulation] = iNumberOfSpawnsDue;
+}
+
+// Returns how many more Objects the Population may spawn this Step
+int CPopulationController::ReturnNumberOfSpawnsDue(int _iPopulation) const
+{
+	return ReturnIfPopulationIsValid(_iPopulation) ? miaNumberOfSpawnsDue[_iPopulation] : 0;
+}
+
+// Records that one of the Population's due Spawns was made
+void CPopulationController::SpawnCommitted(int _iPopulation)
+{
+	// If the Population has no Spawns due there is nothing to record
+	if (!ReturnIfPopulationIsValid(_iPopulation) || miaNumberOfSpawnsDue[_iPopulation] <= 0)
+	{
+		return;
+	}
+
+	// Use up the Credit for this Spawn
+	miaNumberOfSpawnsDue[_iPopulation]--;
+	mfaSpawnCredit[_iPopulation] -= 1.0f;
+	if (mfaSpawnCredit[_iPopulation] < 0.0f)
+	{
+		mfaSpawnCredit[_iPopulation] = 0.0f;
+	}
+
+	// Update the Statistics
+	mulNumberOfSpawns++;
+	miaNumberOfSpawnsThisStep[_iPopulation]++;
+}
+
+
+
+//---------- Statistics Functions ----------
+
+// Returns how many Objects have been spawned since the last Reset
+unsigned long CPopulationController::ReturnNumberOfSpawns() const
+{
+	return mulNumberOfSpawns;
+}
+
+// Returns the most Objects one Population spawned in one Step since the last Reset
+int CPopulationController::ReturnMostSpawnsInAStep() const
+{
+	// Include the Spawns made since the last Update
+	int iMostSpawnsInAStep = miMostSpawnsInAStep;
+	for (int iPopulation = 0; iPopulation < GiNUMBER_OF_POPULATIONS; iPopulation++)
+	{
+		if (miaNumberOfSpawnsThisStep[iPopulation] > iMostSpawnsInAStep)
+		{
+			iMostSpawnsInAStep = miaNumberOfSpawnsThisStep[iPopulation];
+		}
+	}
+	return iMostSpawnsInAStep;
+}
+
+
+
+//---------- Private Functions ----------
+
+// Returns if the Population is valid
+bool CPopulationController::ReturnIfPopulationIsValid(int _iPopulation) const
+{
+	return (_iPopulation >= 0 && _iPopulation < GiNUMBER_OF_POPULATIONS);
+}
@@ -0,0 +1,91 @@
+/////////////////////////////////////////////////////////////////////
+// CPopulationController.h (and CPopulationController.cpp)
+// Written by Daniel Schroeder
+// Created on October 17, 2026
+// Last Updated October 17, 2026
+//-------------------------------------------------------------------
+//   The CPopulationController class decides how many Fish may be spawned
+// each Step to bring each Population (e.g. the Flocking Fish) back up to
+// its Target Count. Each Population earns Spawn Credit at its Spawn Rate
+// (Fish per second) while it is below its Target, so Fish are replaced at
+// the same speed no matter how fast the game is running or how many Fish
+// there are, and no more than the Max Spawns Per Step are allowed in any
+// one Step (so spawning is spread out instead of causing a frame spike).
+//   Example:
+//		cPopulationController.Update(iPopulation, iCurrentCount, fTimeStep);
+//		... Pick up to ReturnNumberOfSpawnsDue(iPopulation) of the Fish which can spawn ...
+//		... For each Fish actually spawned ...
+//			cPopulationController.SpawnCommitted(iPopulation);
+/////////////////////////////////////////////////////////////////////
+
+#ifndef CPOPULATION_CONTROLLER_H
+#define CPOPULATION_CONTROLLER_H
+
+// The Populations which are controlled
+const int GiPOPULATION_FLOCKING_FISH		= 0;
+const int GiPOPULATION_NON_FLOCKING_FISH	= 1;
+const int GiNUMBER_OF_POPULATIONS			= 2;
+
+class CPopulationController
+{
+public:
+
+	//---------- Contructors and Setup Functions ----------
+
+	CPopulationController();								// Default Constructor
+	~CPopulationController();								// Destructor
+
+	// Removes all Spawn Credit and resets the Statistics (the Targets, Spawn Rates, and Max Spawns Per Step are kept)
+	void Reset();
+
+	// Set/Get how many Objects the Population should have
+	void SetTargetCount(int _iPopulation, int _iTargetCount);
+	int GetTargetCount(int _iPopulation) const;
+
+	// Set/Get how many Objects per second the Population may spawn while it is below its Target (0 means as fast as the Max Spawns Per Step allows)
+	void SetSpawnRate(int _iPopulation, float _fObjectsPerSecond);
+	float GetSpawnRate(int _iPopulation) const;
+
+	// Set/Get the most Objects each Population may spawn in one Step (0 means there is no limit)
+	void SetMaxSpawnsPerStep(int _iMaxSpawnsPerStep);
+	int GetMaxSpawnsPerStep() const;
+
+
+	//---------- Update Functions ----------
+
+	// Adds the Spawn Credit earned over the Time Step, and works out how many Objects the Population may spawn this Step
+	// NOTE: Should be called once per Step for each Population, before any Spawns are Committed
+	void Update(int _iPopulation, int _iCurrentCount, float _fTimeStep);
+
+	// Returns how many more Objects the Population may spawn this Step
+	int ReturnNumberOfSpawnsDue(int _iPopulation) const;
+
+	// Records that one of the Population's due Spawns was made
+	void SpawnCommitted(int _iPopulation);
+
+
+	//---------- Statistics Functions ----------
+
+	// Returns how many Objects have been spawned since the last Reset
+	unsigned long ReturnNumberOfSpawns() const;
+
+	// Returns the most Objects one Population spawned in one Step since the last Reset
+	int ReturnMostSpawnsInAStep() const;
+
+private:
+
+	// Returns if the Population is valid
+	bool ReturnIfPopulationIsValid(int _iPopulation) const;
+
+	int miaTargetCount[GiNUMBER_OF_POPULATIONS];		// How many Objects each Population should have
+	float mfaSpawnRate[GiNUMBER_OF_POPULATIONS];		// How many Objects per second each Population may spawn
+	float mfaSpawnCredit[GiNUMBER_OF_POPULATIONS];		// How many Spawns each Population has earned but not made yet
+	int miaNumberOfSpawnsDue[GiNUMBER_OF_POPULATIONS];	// How many more Objects each Population may spawn this Step
+	int miMaxSpawnsPerStep;								// Most Objects each Population may spawn in one Step
+
+	unsigned long mulNumberOfSpawns;					// Objects spawned since the last Reset
+	int miaNumberOfSpawnsThisStep[GiNUMBER_OF_POPULATIONS];	// Objects each Population has spawned since its last Update
+	int miMostSpawnsInAStep;							// Most Objects one Population spawned in one Step since the last Reset
+};
+
+#endif
@@ -0,0 +1,247 @@
+#include "CProfiler.h"
+#include <fstream>
+
+#ifndef _WIN32
+	#include <sys/time.h>	// Needed for gettimeofday() function when not running on Windows
+#endif
+
+// Each Thread keeps a pointer to its own Samples, so recording a Zone never needs a lock
+#ifdef _WIN32
+	static __declspec(thread) void* SvpThreadSamples = NULL;
+#else
+	static __thread void* SvpThreadSamples = NULL;
+#endif
+
+// Initialize the private data
+CProfiler* CProfiler::SmcpProfilerInstance = NULL;
+
+
+//---------- CProfiler Functions ----------
+
+// Constructor
+CProfiler::CProfiler()
+{
+	// Find out how many Ticks there are in a second
+	#ifdef _WIN32
+		LARGE_INTEGER sFrequency;
+		QueryPerformanceFrequency(&sFrequency);
+		mllTicksPerSecond = sFrequency.QuadPart;
+
+		InitializeCriticalSection(&mcThreadSamplesLock);
+	#else
+		mllTicksPerSecond = 1000000;
+
+		pthread_mutex_init(&mcThreadSamplesLock, NULL);
+	#endif
+
+	// Give the Thread creating the Profiler (the main Thread) the first Samples, so it is always Thread 0
+	#ifdef OCEAN_EXPLORER_PROFILER
+		ReturnThreadSamples();
+	#endif
+}
+
+// Destructor
+CProfiler::~CProfiler()
+{
+	// Delete every Threads Samples
+	for (int iIndex = 0; iIndex < (int)mcThreadSamplesList.size(); iIndex++)
+	{
+		delete mcThreadSamplesList[iIndex];
+	}
+	mcThreadSamplesList.clear();
+
+	#ifdef _WIN32
+		DeleteCriticalSection(&mcThreadSamplesLock);
+	#else
+		pthread_mutex_destroy(&mcThreadSamplesLock);
+	#endif
+}
+
+// Returns a pointer to the class's Instance
+CProfiler* CProfiler::ReturnSingletonInstance()
+{
+	// If class has been Instanced already
+	if (SmcpProfilerInstance != NULL)
+	{
+		// Return pointer to class Instance
+		return SmcpProfilerInstance;
+	}
+
+	// Else class has not been Instanced yet so Instance it and return it
+	SmcpProfilerInstance = new CProfiler();
+	return SmcpProfilerInstance;
+}
+
+// Returns if the Zones were compiled in (OCEAN_EXPLORER_PROFILER was defined)
+bool CProfiler::ReturnIfCompiledIn()
+{
+	#ifdef OCEAN_EXPLORER_PROFILER
+		return true;
+	#else
+		return false;
+	#endif
+}
+
+// Returns the current time in Ticks
+long long CProfiler::ReturnCurrentTicks()
+{
+	#ifdef _WIN32
+		LARGE_INTEGER sTicks;
+		QueryPerformanceCounter(&sTicks);
+		return sTicks.QuadPart;
+	#else
+		struct timeval sTime;
+		gettimeofday(&sTime, NULL);
+		return ((long long)sTime.tv_sec * 1000000) + sTime.tv_usec;
+	#endif
+}
+
+// Returns how many Ticks there are in a second
+long long CProfiler::ReturnTicksPerSecond() const
+{
+	return mllTicksPerSecond;
+}
+
+// Records that the Zone ran from _llStartTicks to _llEndTicks on the calling Thread
+void CProfiler::RecordZone(const char* _cpZoneName, long long _llStartTicks, long long _llEndTicks)
+{
+	SThreadSamples* spThreadSamples = ReturnThreadSamples();
+
+	// Write the Zone over the oldest Sample in the ring
+	SProfileSample& sSample = spThreadSamples->saSamples[spThreadSamples->ulNumberOfSamplesRecorded & (GiPROFILER_SAMPLES_PER_THREAD - 1)];
+	sSample.cpZoneName = _cpZoneName;
+	sSample.llStartTicks = _llStartTicks;
+	sSample.llEndTicks = _llEndTicks;
+	spThreadSamples->ulNumberOfSamplesRecorded++;
+}
+
+// Writes every recorded Zone to the file in Chrome's Trace Event format
+bool CProfiler::WriteChromeTrace(string _sFileName)
+{
+	// Temp local variables
+	int iThread = 0;
+	unsigned long ulSample = 0;
+	unsigned long ulFirstSample = 0;
+	bool bFirstEvent = true;
+	long long llBaseTicks = 0;
+	bool bBaseTicksFound = false;
+
+	// Open the file
+	ofstream fOutFile(_sFileName.c_str(), ios_base::out | ios_base::trunc);
+	if (!fOutFile.is_open())
+	{
+		return false;
+	}
+
+	// Find the earliest Zone so the times in the file start at zero
+	for (iThread = 0; iThread < (int)mcThreadSamplesList.size(); iThread++)
+	{
+		SThreadSamples* spThreadSamples = mcThreadSamplesList[iThread];
+		ulFirstSample = (spThreadSamples->ulNumberOfSamplesRecorded > (unsigned long)GiPROFILER_SAMPLES_PER_THREAD) ? (spThreadSamples->ulNumberOfSamplesRecorded - GiPROFILER_SAMPLES_PER_THREAD) : 0;
+		for (ulSample = ulFirstSample; ulSample < spThreadSamples->ulNumberOfSamplesRecorded; ulSample++)
+		{
+			SProfileSample& sSample = spThreadSamples->saSamples[ulSample & (GiPROFILER_SAMPLES_PER_THREAD - 1)];
+			if (!bBaseTicksFound || sSample.llStartTicks < llBaseTicks)
+			{
+				llBaseTicks = sSample.llStartTicks;
+				bBaseTicksFound = true;
+			}
+		}
+	}
+
+	// Chrome expects the times in microseconds
+	double dMicrosecondsPerTick = 1000000.0 / (double)mllTicksPerSecond;
+	fOutFile.setf(ios_base::fixed);
+	fOutFile.precision(3);
+
+	fOutFile << "{\"traceEvents\":[" << endl;
+
+	// Loop through each Threads Samples
+	for (iThread = 0; iThread < (int)mcThreadSamplesList.size(); iThread++)
+	{
+		SThreadSamples* spThreadSamples = mcThreadSamplesList[iThread];
+
+		// Name the Thread
+		fOutFile << (bFirstEvent ? "" : ",\n") << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << spThreadSamples->iThreadIndex <<
+			",\"args\":{\"name\":\"" << ((spThreadSamples->iThreadIndex == 0) ? "Main Thread" : "Worker Thread") << " " << spThreadSamples->iThreadIndex << "\"}}";
+		bFirstEvent = false;
+
+		// Write each Zone the ring still holds as a Complete Event
+		ulFirstSample = (spThreadSamples->ulNumberOfSamplesRecorded > (unsigned long)GiPROFILER_SAMPLES_PER_THREAD) ? (spThreadSamples->ulNumberOfSamplesRecorded - GiPROFILER_SAMPLES_PER_THREAD) : 0;
+		for (ulSample = ulFirstSample; ulSample < spThreadSamples->ulNumberOfSamplesRecorded; ulSample++)
+		{
+			SProfileSample& sSample = spThreadSamples->saSamples[ulSample & (GiPROFILER_SAMPLES_PER_THREAD - 1)];
+			fOutFile << ",\n{\"name\":\"" << sSample.cpZoneName << "\",\"ph\":\"X\",\"pid\":1,\"tid\":" << spThreadSamples->iThreadIndex <<
+				",\"ts\":" << (double)(sSample.llStartTicks - llBaseTicks) * dMicrosecondsPerTick <<
+				",\"dur\":" << (double)(sSample.llEndTicks - sSample.llStartTicks) * dMicrosecondsPerTick << "}";
+		}
+	}
+
+	fOutFile << endl << "],\"displayTimeUnit\":\"ms\"}" << endl;
+
+	// Close the file
+	bool bWritten = !fOutFile.fail();
+	fOutFile.close();
+
+	return bWritten;
+}
+
+// Erases every recorded Zone
+void CProfiler::Purge()
+{
+	// Empty every Threads ring (the Threads keep their Samples, so they don't need to be re-created)
+	for (int iIndex = 0; iIndex < (int)mcThreadSamplesList.size(); iIndex++)
+	{
+		mcThreadSamplesList[iIndex]->ulNumberOfSamplesRecorded = 0;
+	}
+}
+
+// Returns the calling Threads Samples, creating them the first time the Thread records a Zone
+CProfiler::SThreadSamples* CProfiler::ReturnThreadSamples()
+{
+	// If this Thread has already recorded a Zone
+	if (SvpThreadSamples != NULL)
+	{
+		return (SThreadSamples*)SvpThreadSamples;
+	}
+
+	// Create this Threads Samples
+	SThreadSamples* spThreadSamples = new SThreadSamples;
+	spThreadSamples->ulNumberOfSamplesRecorded = 0;
+
+	// Add them to the list (other Threads may be doing the same)
+	#ifdef _WIN32
+		EnterCriticalSection(&mcThreadSamplesLock);
+	#else
+		pthread_mutex_lock(&mcThreadSamplesLock);
+	#endif
+
+	spThreadSamples->iThreadIndex = (int)mcThreadSamplesList.size();
+	mcThreadSamplesList.push_back(spThreadSamples);
+
+	#ifdef _WIN32
+		LeaveCriticalSection(&mcThreadSamplesLock);
+	#else
+		pthread_mutex_unlock(&mcThreadSamplesLock);
+	#endif
+
+	SvpThreadSamples = spThreadSamples;
+	return spThreadSamples;
+}
+
+
+
+//---------- CProfileZone Functions ----------
+
+// Starts timing the Zone
+CProfileZone::CProfileZone(const char* _cpZoneName)
+{
+	mcpZoneName = _cpZoneName;
+	mllStartTicks = CProfiler::ReturnCurrentTicks();
+}
+
+// Stops timing the Zone and records it
+CProfileZone::~CProfileZone()
+{
+	CProfiler::ReturnSingletonInstance()->RecordZone(mcpZoneName, mllStartTicks, CProfiler::ReturnCurrentTicks());
+}
@@ -0,0 +1,133 @@
+/////////////////////////////////////////////////////////////////////
+// CProfiler.h (and CProfiler.cpp)
+// Written by Daniel Schroeder
+// Created on October 17, 2026
+// Last Updated October 17, 2026
+//-------------------------------------------------------------------
+//   The CProfiler class records how long named Zones of code take to
+// run. A Zone is timed from where PROFILE_ZONE() is placed until the end
+// of the enclosing scope. Each Thread records its Zones into its own
+// ring buffer (so Threads never wait on each other, and only the most
+// recent Zones are kept), and WriteChromeTrace() writes all of them to a
+// file which can be opened in Chrome's about:tracing page.
+//   Example:
+//		void CGame::UpdateObjects()
+//		{
+//			PROFILE_ZONE("UpdateObjects");
+//			...
+//		}
+//   The Zones are only compiled in when OCEAN_EXPLORER_PROFILER is
+// defined (e.g. in the Project's Preprocessor Definitions); otherwise
+// PROFILE_ZONE() expands to nothing, so the Zones can be left in
+// Release builds.
+// NOTE: Only one PROFILE_ZONE() can be used per scope.
+// NOTE: Zone names must be string literals (only the pointer is kept).
+// NOTE: WriteChromeTrace() must not be called while other Threads are
+//		 recording Zones (e.g. during a ParallelFor()).
+/////////////////////////////////////////////////////////////////////
+
+#ifndef CPROFILER_H
+#define CPROFILER_H
+
+#ifdef _WIN32
+	#include <windows.h>	// Needed for QueryPerformanceCounter() and Critical Sections
+#else
+	#include <pthread.h>	// Needed for Mutexes when not running on Windows
+#endif
+#include <string>
+#include <vector>
+using namespace std;
+
+// Number of Zones each Thread keeps (older Zones are overwritten); must be a power of 2
+const int GiPROFILER_SAMPLES_PER_THREAD = 65536;
+
+// Times a Zone from where it is placed until the end of the enclosing scope (if the Profiler is compiled in)
+#ifdef OCEAN_EXPLORER_PROFILER
+	#define PROFILE_ZONE(sZoneName)	CProfileZone cProfileZone(sZoneName)
+#else
+	#define PROFILE_ZONE(sZoneName)
+#endif
+
+// Singleton Class
+class CProfiler
+{
+public:
+
+	// Destructor
+	~CProfiler();
+
+	// Returns a pointer to the class's Instance
+	// NOTE: Should be called once from the main Thread before any other Threads record Zones
+	static CProfiler* ReturnSingletonInstance();
+
+	// Returns if the Zones were compiled in (OCEAN_EXPLORER_PROFILER was defined)
+	static bool ReturnIfCompiledIn();
+
+	// Returns the current time in Ticks (see ReturnTicksPerSecond())
+	static long long ReturnCurrentTicks();
+
+	// Returns how many Ticks there are in a second
+	long long ReturnTicksPerSecond() const;
+
+	// Records that the Zone ran from _llStartTicks to _llEndTicks on the calling Thread
+	void RecordZone(const char* _cpZoneName, long long _llStartTicks, long long _llEndTicks);
+
+	// Writes every recorded Zone to the file in Chrome's Trace Event format
+	// Returns false if the file could not be written
+	bool WriteChromeTrace(string _sFileName);
+
+	// Erases every recorded Zone
+	void Purge();
+
+private:
+
+	CProfiler();								// Constructor (Private because this is a Singleton class)
+	static CProfiler* SmcpProfilerInstance;		// Holds a pointer to the Class Instance
+
+	// Holds one recorded Zone
+	struct SProfileSample
+	{
+		const char* cpZoneName;		// Name of the Zone
+		long long llStartTicks;		// When the Zone started
+		long long llEndTicks;		// When the Zone ended
+	};
+
+	// Holds the Zones recorded by one Thread
+	struct SThreadSamples
+	{
+		int iThreadIndex;										// Order the Thread first recorded a Zone in (the first is the main Thread)
+		unsigned long ulNumberOfSamplesRecorded;				// Total Zones recorded (the ring holds the most recent ones)
+		SProfileSample saSamples[GiPROFILER_SAMPLES_PER_THREAD];	// Ring of recorded Zones
+	};
+
+	// Returns the calling Threads Samples, creating them the first time the Thread records a Zone
+	SThreadSamples* ReturnThreadSamples();
+
+	vector<SThreadSamples*> mcThreadSamplesList;	// Every Threads Samples
+	long long mllTicksPerSecond;					// How many Ticks there are in a second
+
+	#ifdef _WIN32
+		CRITICAL_SECTION mcThreadSamplesLock;		// Lock used when a Thread adds its Samples to the list
+	#else
+		pthread_mutex_t mcThreadSamplesLock;		// Lock used when a Thread adds its Samples to the list
+	#endif
+};
+
+// Times a Zone for as long as it is in scope (use PROFILE_ZONE() instead of creating these directly)
+class CProfileZone
+{
+public:
+
+	// Starts timing the Zone
+	CProfileZone(const char* _cpZoneName);
+
+	// Stops timing the Zone and records it
+	~CProfileZone();
+
+private:
+
+	const char* mcpZoneName;		// Name of the Zone
+	long long mllStartTicks;		// When the Zone started
+};
+
+#endif
@@ -0,0 +1,515 @@
+#include "CSpatialHashGrid.h"
+#include "CObject.h"
+#include <cmath>		// Needed for floorf() function
+#include <cstdlib>		// Needed for abs() function
+
+//---------- Contructors and Setup Functions ----------
+
+// Default Constructor
+CSpatialHashGrid::CSpatialHashGrid()
+{
+	// Start with a reasonable Cell Size and number of Buckets
+	mfCellSize = 100.0f;
+	mfInverseCellSize = 1.0f / mfCellSize;
+	mcBucketList.resize(4096);
+
+	Purge();
+}
+
+// Destructor
+CSpatialHashGrid::~CSpatialHashGrid()
+{
+	Purge();
+}
+
+// Removes all Objects from the Grid and resets the Statistics
+void CSpatialHashGrid::Purge()
+{
+	// Empty all of the Buckets (but keep the number of Buckets)
+	for (unsigned int uiIndex = 0; uiIndex < mcBucketList.size(); uiIndex++)
+	{
+		mcBucketList[uiIndex].clear();
+	}
+
+	// Remove all Entries
+	mcEntryList.clear();
+	mcFreeEntryList.clear();
+	miNumberOfObjects = 0;
+
+	ResetStatistics();
+}
+
+// Sets the size of each Cell
+void CSpatialHashGrid::SetCellSize(float _fCellSize)
+{
+	// Make sure the Cell Size is valid
+	if (_fCellSize <= 0.0f)
+	{
+		return;
+	}
+
+	mfCellSize = _fCellSize;
+	mfInverseCellSize = 1.0f / mfCellSize;
+
+	// Move all Objects into their new Cells
+	RehashAllEntries();
+}
+
+// Returns the size of each Cell
+float CSpatialHashGrid::GetCellSize() const
+{
+	return mfCellSize;
+}
+
+// Sets the number of Buckets the Cells are hashed into (rounded up to a power of 2)
+void CSpatialHashGrid::SetNumberOfBuckets(int _iNumberOfBuckets)
+{
+	int iNumberOfBuckets = 1;
+
+	// Round up to the next power of 2 so the Hash can be masked instead of divided
+	while (iNumberOfBuckets < _iNumberOfBuckets)
+	{
+		iNumberOfBuckets *= 2;
+	}
+
+	mcBucketList.clear();
+	mcBucketList.resize(iNumberOfBuckets);
+
+	// Move all Objects into their new Buckets
+	RehashAllEntries();
+}
+
+// Returns the number of Buckets the Cells are hashed into
+int CSpatialHashGrid::GetNumberOfBuckets() const
+{
+	return (int)mcBucketList.size();
+}
+
+
+
+//---------- Object Functions ----------
+
+// Inserts the Object into the Grid and returns its Handle
+int CSpatialHashGrid::InsertObject(CObject* _cpObject, Ogre::Vector3 _sPosition, int _iSpecificType)
+{
+	int iHandle = 0;
+
+	// If there is a free Entry, reuse it
+	if (!mcFreeEntryList.empty())
+	{
+		iHandle = mcFreeEntryList.back();
+		mcFreeEntryList.pop_back();
+	}
+	// Else add a new Entry
+	else
+	{
+		iHandle = (int)mcEntryList.size();
+		mcEntryList.push_back(SGridEntry());
+	}
+
+	// Fill in the Entry
+	SGridEntry& sEntry = mcEntryList[iHandle];
+	sEntry.cpObject = _cpObject;
+	sEntry.sPosition = _sPosition;
+	sEntry.iSpecificType = _iSpecificType;
+	sEntry.bInUse = true;
+	CalculateCell(_sPosition, sEntry.iCellX, sEntry.iCellY, sEntry.iCellZ);
+
+	// Put the Entry into its Bucket
+	AddEntryToBucket(iHandle);
+	miNumberOfObjects++;
+
+	return iHandle;
+}
+
+// Removes the Object with the given Handle from the Grid
+void CSpatialHashGrid::RemoveObject(int _iHandle)
+{
+	// If this is not a valid Handle
+	if (_iHandle < 0 || _iHandle >= (int)mcEntryList.size() || !mcEntryList[_iHandle].bInUse)
+	{
+		return;
+	}
+
+	// Take the Entry out of its Bucket and mark it as free
+	RemoveEntryFromBucket(_iHandle);
+	mcEntryList[_iHandle].bInUse = false;
+	mcEntryList[_iHandle].cpObject = NULL;
+	mcFreeEntryList.push_back(_iHandle);
+	miNumberOfObjects--;
+}
+
+// Updates the Objects Position, moving it into a new Cell if needed
+void CSpatialHashGrid::UpdateObjectsPosition(int _iHandle, Ogre::Vector3 _sPosition)
+{
+	// If this is not a valid Handle
+	if (_iHandle < 0 || _iHandle >= (int)mcEntryList.size() || !mcEntryList[_iHandle].bInUse)
+	{
+		return;
+	}
+
+	SGridEntry& sEntry = mcEntryList[_iHandle];
+	sEntry.sPosition = _sPosition;
+
+	// Find which Cell the Object is in now
+	int iCellX, iCellY, iCellZ;
+	CalculateCell(_sPosition, iCellX, iCellY, iCellZ);
+
+	// If the Object has moved into a different Cell
+	if (iCellX != sEntry.iCellX || iCellY != sEntry.iCellY || iCellZ != sEntry.iCellZ)
+	{
+		// Move it into the new Cells Bucket
+		RemoveEntryFromBucket(_iHandle);
+		sEntry.iCellX = iCellX;
+		sEntry.iCellY = iCellY;
+		sEntry.iCellZ = iCellZ;
+		AddEntryToBucket(_iHandle);
+	}
+}
+
+// Returns how many Objects are in the Grid
+int CSpatialHashGrid::ReturnNumberOfObjects() const
+{
+	return miNumberOfObjects;
+}
+
+
+
+//---------- Query Functions ----------
+
+// Finds the closest Objects within range of the Position, sorted from closest to farthest
+int CSpatialHashGrid::FindNearestNeighbors(Ogre::Vector3 _sPosition, float _fMaxRange, int _iMaxNeighbors, int _iSpecificTypeFilter,
+											CObject* _cpObjectToIgnore, SObjectHandle* _saNeighbors, int* _ipNumberOfCandidatesExamined) const
+{
+	// Make sure we don't find more Neighbors than we can hold the distances of
+	if (_iMaxNeighbors > GiMAX_SPATIAL_GRID_QUERY_NEIGHBORS)
+	{
+		_iMaxNeighbors = GiMAX_SPATIAL_GRID_QUERY_NEIGHBORS;
+	}
+
+	// Setup the query
+	SQuery sQuery;
+	sQuery.sPosition = _sPosition;
+	sQuery.fRangeSquared = _fMaxRange * _fMaxRange;
+	sQuery.iMaxNeighbors = _iMaxNeighbors;
+	sQuery.iSpecificTypeFilter = _iSpecificTypeFilter;
+	sQuery.cpObjectToIgnore = _cpObjectToIgnore;
+	sQuery.saNeighbors = _saNeighbors;
+	sQuery.iNumberOfNeighbors = 0;
+	sQuery.iNumberOfCandidates = 0;
+
+	// If there is nothing to find
+	if (_iMaxNeighbors <= 0 || _fMaxRange <= 0.0f || miNumberOfObjects == 0)
+	{
+		if (_ipNumberOfCandidatesExamined != NULL)
+		{
+			*_ipNumberOfCandidatesExamined = 0;
+		}
+		return 0;
+	}
+
+	// Find the Cell the Position is in
+	int iCenterX, iCenterY, iCenterZ;
+	CalculateCell(_sPosition, iCenterX, iCenterY, iCenterZ);
+
+	// Search the Cells in growing Shells around the Position
+	int iMaxShell = (int)(_fMaxRange * mfInverseCellSize) + 1;
+	int iNumberOfCellsExamined = 0;
+	for (int iShell = 0; iShell <= iMaxShell; iShell++)
+	{
+		// If this is not the Center Cell
+		if (iShell > 0)
+		{
+			// Calculate the closest any Object in this Shell could be to the Position
+			float fShellDistanceSquared = (iShell - 1) * mfCellSize;
+			fShellDistanceSquared *= fShellDistanceSquared;
+
+			// If nothing in this Shell can be in range, or closer than the Neighbors already found, we are done
+			if (fShellDistanceSquared > sQuery.fRangeSquared ||
+				(sQuery.iNumberOfNeighbors == sQuery.iMaxNeighbors && fShellDistanceSquared >= sQuery.faDistances[sQuery.iNumberOfNeighbors - 1]))
+			{
+				break;
+			}
+		}
+
+		// Calculate how many Cells are in this Shell
+		int iSide = (2 * iShell) + 1;
+		int iInnerSide = iSide - 2;
+		int iNumberOfCellsInShell = (iShell == 0) ? 1 : ((iSide * iSide * iSide) - (iInnerSide * iInnerSide * iInnerSide));
+
+		// If checking this Shells Cells would take longer than checking the Objects directly (the Grid is sparse here)
+		if ((iNumberOfCellsExamined + iNumberOfCellsInShell) > miNumberOfObjects)
+		{
+			// Check every Object which is not in a Shell that was already searched
+			for (unsigned int uiIndex = 0; uiIndex < mcEntryList.size(); uiIndex++)
+			{
+				const SGridEntry& sEntry = mcEntryList[uiIndex];
+				if (sEntry.bInUse &&
+					(abs(sEntry.iCellX - iCenterX) >= iShell || abs(sEntry.iCellY - iCenterY) >= iShell || abs(sEntry.iCellZ - iCenterZ) >= iShell))
+				{
+					ExamineCandidate(sEntry, sQuery);
+				}
+			}
+			break;
+		}
+
+		// Loop through every Cell on the surface of this Shell
+		for (int iX = -iShell; iX <= iShell; iX++)
+		{
+			for (int iY = -iShell; iY <= iShell; iY++)
+			{
+				// If this column is on the side of the Shell, every Cell in it is on the Shell
+				if (abs(iX) == iShell || abs(iY) == iShell)
+				{
+					for (int iZ = -iShell; iZ <= iShell; iZ++)
+					{
+						ExamineCell(iCenterX + iX, iCenterY + iY, iCenterZ + iZ, sQuery);
+					}
+				}
+				// Else only the front and back Cells of this column are on the Shell
+				else
+				{
+					ExamineCell(iCenterX + iX, iCenterY + iY, iCenterZ - iShell, sQuery);
+					ExamineCell(iCenterX + iX, iCenterY + iY, iCenterZ + iShell, sQuery);
+				}
+			}
+		}
+
+		iNumberOfCellsExamined += iNumberOfCellsInShell;
+	}
+
+	// Return how many Candidates were examined
+	if (_ipNumberOfCandidatesExamined != NULL)
+	{
+		*_ipNumberOfCandidatesExamined = sQuery.iNumberOfCandidates;
+	}
+
+	return sQuery.iNumberOfNeighbors;
+}
+
+// Finds every Object within range of the Position
+int CSpatialHashGrid::FindObjectsInRange(Ogre::Vector3 _sPosition, float _fMaxRange, vector<CObject*>& _cObjectList) const
+{
+	float fRangeSquared = _fMaxRange * _fMaxRange;
+
+	// Empty the list
+	_cObjectList.clear();
+
+	// If there is nothing to find
+	if (_fMaxRange <= 0.0f || miNumberOfObjects == 0)
+	{
+		return 0;
+	}
+
+	// Find the Cells at the corners of the box around the range
+	int iMinX, iMinY, iMinZ, iMaxX, iMaxY, iMaxZ;
+	CalculateCell(_sPosition - Ogre::Vector3(_fMaxRange, _fMaxRange, _fMaxRange), iMinX, iMinY, iMinZ);
+	CalculateCell(_sPosition + Ogre::Vector3(_fMaxRange, _fMaxRange, _fMaxRange), iMaxX, iMaxY, iMaxZ);
+
+	// If checking the Cells would take longer than checking the Objects directly (the range is large compared to the Cells)
+	float fNumberOfCells = (float)(iMaxX - iMinX + 1) * (float)(iMaxY - iMinY + 1) * (float)(iMaxZ - iMinZ + 1);
+	if (fNumberOfCells > (float)miNumberOfObjects)
+	{
+		// Check every Object
+		for (unsigned int uiIndex = 0; uiIndex < mcEntryList.size(); uiIndex++)
+		{
+			const SGridEntry& sEntry = mcEntryList[uiIndex];
+			if (sEntry.bInUse && sEntry.sPosition.squaredDistance(_sPosition) <= fRangeSquared)
+			{
+				_cObjectList.push_back(sEntry.cpObject);
+			}
+		}
+		return (int)_cObjectList.size();
+	}
+
+	// Loop through every Cell in the box
+	for (int iX = iMinX; iX <= iMaxX; iX++)
+	{
+		for (int iY = iMinY; iY <= iMaxY; iY++)
+		{
+			for (int iZ = iMinZ; iZ <= iMaxZ; iZ++)
+			{
+				const vector<int>& cBucket = mcBucketList[ReturnBucket(iX, iY, iZ)];
+
+				// Loop through the Entries in this Cells Bucket
+				for (unsigned int uiIndex = 0; uiIndex < cBucket.size(); uiIndex++)
+				{
+					const SGridEntry& sEntry = mcEntryList[cBucket[uiIndex]];
+
+					// If this Entry is actually in this Cell (other Cells may hash into the same Bucket) and is in range
+					if (sEntry.iCellX == iX && sEntry.iCellY == iY && sEntry.iCellZ == iZ &&
+						sEntry.sPosition.squaredDistance(_sPosition) <= fRangeSquared)
+					{
+						_cObjectList.push_back(sEntry.cpObject);
+					}
+				}
+			}
+		}
+	}
+
+	return (int)_cObjectList.size();
+}
+
+// Adds the queries and the number of Candidates they examined to the Statistics
+void CSpatialHashGrid::RecordQueryStatistics(unsigned long _ulNumberOfQueries, unsigned long _ulNumberOfCandidatesExamined)
+{
+	mulNumberOfQueries += _ulNumberOfQueries;
+	mulTotalCandidatesExamined += _ulNumberOfCandidatesExamined;
+}
+
+// Returns how many queries have been done since the last Reset
+unsigned long CSpatialHashGrid::ReturnNumberOfQueries() const
+{
+	return mulNumberOfQueries;
+}
+
+// Returns how many Candidates have been examined since the last Reset
+unsigned long CSpatialHashGrid::ReturnTotalNumberOfCandidatesExamined() const
+{
+	return mulTotalCandidatesExamined;
+}
+
+// Returns the average number of Candidates examined by each query since the last Reset
+float CSpatialHashGrid::ReturnAverageNumberOfCandidatesExamined() const
+{
+	// Make sure no Divide by Zero
+	if (mulNumberOfQueries == 0)
+	{
+		return 0.0f;
+	}
+
+	return ((float)mulTotalCandidatesExamined / (float)mulNumberOfQueries);
+}
+
+// Resets the query Statistics
+void CSpatialHashGrid::ResetStatistics()
+{
+	mulNumberOfQueries = 0;
+	mulTotalCandidatesExamined = 0;
+}
+
+
+
+//---------- Private Functions ----------
+
+// Calculates which Cell the Position is in
+void CSpatialHashGrid::CalculateCell(const Ogre::Vector3& _sPosition, int& _iCellX, int& _iCellY, int& _iCellZ) const
+{
+	_iCellX = (int)floorf(_sPosition.x * mfInverseCellSize);
+	_iCellY = (int)floorf(_sPosition.y * mfInverseCellSize);
+	_iCellZ = (int)floorf(_sPosition.z * mfInverseCellSize);
+}
+
+// Returns which Bucket the Cell hashes into
+int CSpatialHashGrid::ReturnBucket(int _iCellX, int _iCellY, int _iCellZ) const
+{
+	// Multiply each coordinate by a large prime and mix them together
+	unsigned int uiHash = ((unsigned int)_iCellX * 73856093u) ^ ((unsigned int)_iCellY * 19349663u) ^ ((unsigned int)_iCellZ * 83492791u);
+
+	// Number of Buckets is a power of 2, so mask instead of using modulus
+	return (int)(uiHash & (unsigned int)(mcBucketList.size() - 1));
+}
+
+// Adds the Entry to the Bucket its Cell hashes into
+void CSpatialHashGrid::AddEntryToBucket(int _iHandle)
+{
+	SGridEntry& sEntry = mcEntryList[_iHandle];
+	sEntry.iBucket = ReturnBucket(sEntry.iCellX, sEntry.iCellY, sEntry.iCellZ);
+	sEntry.iIndexInBucket = (int)mcBucketList[sEntry.iBucket].size();
+	mcBucketList[sEntry.iBucket].push_back(_iHandle);
+}
+
+// Removes the Entry from its Bucket
+void CSpatialHashGrid::RemoveEntryFromBucket(int _iHandle)
+{
+	SGridEntry& sEntry = mcEntryList[_iHandle];
+	vector<int>& cBucket = mcBucketList[sEntry.iBucket];
+
+	// Move the last Entry in the Bucket into this Entries spot so the Bucket stays packed
+	int iLastHandle = cBucket.back();
+	cBucket[sEntry.iIndexInBucket] = iLastHandle;
+	mcEntryList[iLastHandle].iIndexInBucket = sEntry.iIndexInBucket;
+	cBucket.pop_back();
+
+	sEntry.iBucket = sEntry.iIndexInBucket = -1;
+}
+
+// Moves every Entry into the Bucket it should be in
+void CSpatialHashGrid::RehashAllEntries()
+{
+	// Empty all of the Buckets
+	for (unsigned int uiIndex = 0; uiIndex < mcBucketList.size(); uiIndex++)
+	{
+		mcBucketList[uiIndex].clear();
+	}
+
+	// Put each Entry back into the correct Bucket
+	for (unsigned int uiIndex = 0; uiIndex < mcEntryList.size(); uiIndex++)
+	{
+		// If this Entry holds an Object
+		if (mcEntryList[uiIndex].bInUse)
+		{
+			SGridEntry& sEntry = mcEntryList[uiIndex];
+			CalculateCell(sEntry.sPosition, sEntry.iCellX, sEntry.iCellY, sEntry.iCellZ);
+			AddEntryToBucket((int)uiIndex);
+		}
+	}
+}
+
+// Checks the Entry against the query, inserting it into the Neighbors if it is close enough
+void CSpatialHashGrid::ExamineCandidate(const SGridEntry& _sEntry, SQuery& _sQuery) const
+{
+	// Record that another Candidate was examined
+	_sQuery.iNumberOfCandidates++;
+
+	// If this is the Object doing the query, is the wrong type, or is Dead
+	if (_sEntry.cpObject == _sQuery.cpObjectToIgnore ||
+		(_sQuery.iSpecificTypeFilter != -1 && _sEntry.iSpecificType != _sQuery.iSpecificTypeFilter) ||
+		_sEntry.cpObject->GetState() == GiOBJECT_STATE_DEAD)
+	{
+		return;
+	}
+
+	// If the Candidate is out of range
+	float fDistanceSquared = _sEntry.sPosition.squaredDistance(_sQuery.sPosition);
+	if (fDistanceSquared > _sQuery.fRangeSquared)
+	{
+		return;
+	}
+
+	// If we already have enough Neighbors and this one is not closer than the farthest
+	bool bNeighborsAreFull = (_sQuery.iNumberOfNeighbors == _sQuery.iMaxNeighbors);
+	if (bNeighborsAreFull && fDistanceSquared >= _sQuery.faDistances[_sQuery.iNumberOfNeighbors - 1])
+	{
+		return;
+	}
+
+	// Use insertion-sort to put the Candidate into the Neighbors (drops the farthest if full)
+	int iPosition = bNeighborsAreFull ? (_sQuery.iNumberOfNeighbors - 1) : _sQuery.iNumberOfNeighbors++;
+	while (iPosition > 0 && _sQuery.faDistances[iPosition - 1] > fDistanceSquared)
+	{
+		_sQuery.faDistances[iPosition] = _sQuery.faDistances[iPosition - 1];
+		_sQuery.saNeighbors[iPosition] = _sQuery.saNeighbors[iPosition - 1];
+		iPosition--;
+	}
+	_sQuery.faDistances[iPosition] = fDistanceSquared;
+	_sQuery.saNeighbors[iPosition] = _sEntry.cpObject->msHandle;
+}
+
+// Checks every Entry in the given Cell against the query
+void CSpatialHashGrid::ExamineCell(int _iCellX, int _iCellY, int _iCellZ, SQuery& _sQuery) const
+{
+	const vector<int>& cBucket = mcBucketList[ReturnBucket(_iCellX, _iCellY, _iCellZ)];
+
+	// Loop through the Entries in this Cells Bucket
+	for (unsigned int uiIndex = 0; uiIndex < cBucket.size(); uiIndex++)
+	{
+		const SGridEntry& sEntry = mcEntryList[cBucket[uiIndex]];
+
+		// If this Entry is actually in this Cell (other Cells may hash into the same Bucket)
+		if (sEntry.iCellX == _iCellX && sEntry.iCellY == _iCellY && sEntry.iCellZ == _iCellZ)
+		{
+			ExamineCandidate(sEntry, _sQuery);
+		}
+	}
+}
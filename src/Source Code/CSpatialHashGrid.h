@@ -0,0 +1,162 @@
+/////////////////////////////////////////////////////////////////////
+// CSpatialHashGrid.h (and CSpatialHashGrid.cpp)
+// Written by Daniel Schroeder
+// Created on October 17, 2026
+// Last Updated October 17, 2026
+//-------------------------------------------------------------------
+//   The CSpatialHashGrid class is used to quickly find the Objects
+// closest to a position without checking every Object in the level.
+// Space is divided into cube Cells of equal size, and each Cell is
+// hashed into a Bucket holding the Objects inside of it. When an
+// Object moves, call UpdateObjectsPosition() and it will be moved to
+// its new Cell if needed. Queries search the Cells in growing shells
+// around the position and stop as soon as no closer Object can exist.
+//   Choose a Cell Size close to the range most queries care about; the
+// number of Candidates examined by each query is recorded so the Cell
+// Size can be tuned.
+//   Queries do not change the Grid, so several Threads can query it at
+// the same time (as long as no Objects are being Inserted, Removed, or
+// Updated while they do).
+/////////////////////////////////////////////////////////////////////
+
+#ifndef CSPATIAL_HASH_GRID_H
+#define CSPATIAL_HASH_GRID_H
+
+class CObject;			// Only pointers to Objects are stored
+#include "SObjectHandle.h"
+#include <Ogre.h>		// Include OGRE
+#include <vector>
+using namespace std;
+
+// Most Neighbors a single query can return
+const int GiMAX_SPATIAL_GRID_QUERY_NEIGHBORS = 64;
+
+class CSpatialHashGrid
+{
+public:
+
+	//---------- Contructors and Setup Functions ----------
+
+	CSpatialHashGrid();									// Default Constructor
+	~CSpatialHashGrid();								// Destructor
+
+	// Removes all Objects from the Grid and resets the Statistics
+	void Purge();
+
+	// Set/Get the size of each Cell
+	// NOTE: Changing the Cell Size moves all Objects into their new Cells
+	void SetCellSize(float _fCellSize);
+	float GetCellSize() const;
+
+	// Set/Get the number of Buckets the Cells are hashed into
+	// NOTE: Should be a power of 2; changing it moves all Objects into their new Buckets
+	void SetNumberOfBuckets(int _iNumberOfBuckets);
+	int GetNumberOfBuckets() const;
+
+
+	//---------- Object Functions ----------
+
+	// Inserts the Object into the Grid and returns its Handle (used to Update or Remove it later)
+	int InsertObject(CObject* _cpObject, Ogre::Vector3 _sPosition, int _iSpecificType);
+
+	// Removes the Object with the given Handle from the Grid
+	void RemoveObject(int _iHandle);
+
+	// Updates the Objects Position, moving it into a new Cell if needed
+	void UpdateObjectsPosition(int _iHandle, Ogre::Vector3 _sPosition);
+
+	// Returns how many Objects are in the Grid
+	int ReturnNumberOfObjects() const;
+
+
+	//---------- Query Functions ----------
+
+	// Finds the closest (up to _iMaxNeighbors) Objects within _fMaxRange of the Position and writes their Handles
+	// into _saNeighbors, sorted from closest to farthest. Returns how many Neighbors were found
+	// If _ipNumberOfCandidatesExamined is given, it is set to how many Candidates the query examined
+	// NOTE: Use -1 for _iSpecificTypeFilter to accept any type of Object. Dead Objects and _cpObjectToIgnore
+	//		 (usually the Object doing the query) are never returned
+	// NOTE: Queries are not added to the Statistics automatically (so they are safe to do from several Threads);
+	//		 pass the number of Candidates examined to RecordQueryStatistics() afterwards
+	int FindNearestNeighbors(Ogre::Vector3 _sPosition, float _fMaxRange, int _iMaxNeighbors, int _iSpecificTypeFilter,
+							 CObject* _cpObjectToIgnore, SObjectHandle* _saNeighbors, int* _ipNumberOfCandidatesExamined = NULL) const;
+
+	// Finds every Object within _fMaxRange of the Position (in no particular order) and puts them in _cObjectList
+	// Returns how many Objects were found
+	// NOTE: Unlike FindNearestNeighbors(), Dead Objects are returned too, and the query is not added to the Statistics
+	int FindObjectsInRange(Ogre::Vector3 _sPosition, float _fMaxRange, vector<CObject*>& _cObjectList) const;
+
+	// Adds the queries and the number of Candidates they examined to the Statistics
+	void RecordQueryStatistics(unsigned long _ulNumberOfQueries, unsigned long _ulNumberOfCandidatesExamined);
+
+	// Returns how many queries have been done, and how many Candidates they examined in total, since the last Reset
+	unsigned long ReturnNumberOfQueries() const;
+	unsigned long ReturnTotalNumberOfCandidatesExamined() const;
+
+	// Returns the average number of Candidates examined by each query since the last Reset
+	float ReturnAverageNumberOfCandidatesExamined() const;
+
+	// Resets the query Statistics
+	void ResetStatistics();
+
+private:
+
+	// Holds one Object in the Grid
+	struct SGridEntry
+	{
+		CObject* cpObject;			// The Object
+		Ogre::Vector3 sPosition;	// The Objects Position last time it was Updated
+		int iSpecificType;			// The Objects Specific Type (used to filter queries)
+		int iCellX, iCellY, iCellZ;	// The Cell the Object is in
+		int iBucket;				// The Bucket the Cell hashes into
+		int iIndexInBucket;			// Where the Object is in the Bucket
+		bool bInUse;				// Tells if this Entry holds an Object or is free
+	};
+
+	// Calculates which Cell the Position is in
+	void CalculateCell(const Ogre::Vector3& _sPosition, int& _iCellX, int& _iCellY, int& _iCellZ) const;
+
+	// Returns which Bucket the Cell hashes into
+	int ReturnBucket(int _iCellX, int _iCellY, int _iCellZ) const;
+
+	// Adds/Removes the Entry to/from the Bucket its Cell hashes into
+	void AddEntryToBucket(int _iHandle);
+	void RemoveEntryFromBucket(int _iHandle);
+
+	// Moves every Entry into the Bucket it should be in (after the Cell Size or number of Buckets changes)
+	void RehashAllEntries();
+
+	// Holds the data for one query (kept on the stack so several Threads can query at the same time)
+	struct SQuery
+	{
+		Ogre::Vector3 sPosition;			// Position being queried
+		float fRangeSquared;				// Squared max range of the query
+		int iMaxNeighbors;					// Max number of Neighbors to find
+		int iSpecificTypeFilter;			// Specific Type to accept (-1 for all)
+		CObject* cpObjectToIgnore;			// Object to not return
+		SObjectHandle* saNeighbors;			// Where to write the Neighbors Handles
+		float faDistances[GiMAX_SPATIAL_GRID_QUERY_NEIGHBORS];	// Squared Distance to each Neighbor found
+		int iNumberOfNeighbors;				// How many Neighbors have been found
+		int iNumberOfCandidates;			// How many Candidates have been examined
+	};
+
+	// Checks the Entry against the query, inserting it into the Neighbors if it is close enough
+	void ExamineCandidate(const SGridEntry& _sEntry, SQuery& _sQuery) const;
+
+	// Checks every Entry in the given Cell against the query
+	void ExamineCell(int _iCellX, int _iCellY, int _iCellZ, SQuery& _sQuery) const;
+
+	vector<SGridEntry> mcEntryList;			// Holds all Entries (indexed by Handle)
+	vector<int> mcFreeEntryList;			// Holds the Handles of Entries which are not in use
+	vector< vector<int> > mcBucketList;		// Holds the Handles of the Entries in each Bucket
+
+	float mfCellSize;						// Size of each Cell
+	float mfInverseCellSize;				// 1 / Cell Size
+	int miNumberOfObjects;					// How many Objects are in the Grid
+
+	// Statistics
+	unsigned long mulNumberOfQueries;		// Queries done since last Reset
+	unsigned long mulTotalCandidatesExamined;	// Candidates examined since last Reset
+};
+
+#endif
@@ -0,0 +1,316 @@
+#include "CSpeciesList.h"
+#include <cstdlib>		// Needed for atoi() and atof() functions
+
+//---------- SSpecies Functions ----------
+
+// Default Constructor
+SSpecies::SSpecies()
+{
+	Purge();
+}
+
+// Sets the Species back to its default values
+void SSpecies::Purge()
+{
+	bDefined = false;
+
+	sName = "";
+	sMesh = "";
+	bUseRandomColoredMaterial = false;
+
+	fLengthInMeters = 1.0f;
+	sMinDimensionsScale = Ogre::Vector3::UNIT_SCALE;
+	sMaxDimensionsScale = Ogre::Vector3::UNIT_SCALE;
+
+	bMoves = true;
+	fMinSpeedAboveFriction = 0.0f;
+	fMaxSpeedAboveFriction = 0.0f;
+
+	fMinRotationSpeed = 0.0f;
+	fMaxRotationSpeed = 0.0f;
+	sRotationAxis = Ogre::Vector3::UNIT_X;
+
+	sForwardDirection = Ogre::Vector3::UNIT_Z;
+	sUpDirection = Ogre::Vector3::UNIT_Y;
+	sRightDirection = Ogre::Vector3::UNIT_X;
+	fInitialPitch = 0.0f;
+
+	iNumberOfPoints = 0;
+	bRandomlyOrient = true;
+	bUseAutoTracking = true;
+
+	bMeshMetricsMeasured = false;
+	fLengthToMeterRatio = 1.0f;
+}
+
+
+
+//---------- Contructors and Setup Functions ----------
+
+// Default Constructor
+CSpeciesList::CSpeciesList()
+{
+	Purge();
+}
+
+// Destructor
+CSpeciesList::~CSpeciesList()
+{
+	Purge();
+}
+
+// Removes all Species
+void CSpeciesList::Purge()
+{
+	mcSpeciesList.clear();
+	mbLoaded = false;
+	msLastError = "";
+}
+
+// Reads in the Species from the Species File
+bool CSpeciesList::ReadInSpeciesFile(string _sFileName)
+{
+	ifstream fInFile(_sFileName.c_str());
+	string sBuffer;
+	const int iJUNK_BUFFER_SIZE = 500;
+	char caJunkBuffer[iJUNK_BUFFER_SIZE];
+	int iLineNumber = 0;
+	SSpecies* spSpecies = NULL;				// The Species currently being read in
+	bool bNoErrors = true;
+
+	// Start with no Species
+	Purge();
+
+	// If the File couldn't be opened
+	if (!fInFile.is_open())
+	{
+		msLastError = "Could not open " + _sFileName;
+		return false;
+	}
+
+	// Loop until the entire file has been read
+	while (!fInFile.eof())
+	{
+		// Read in the first word of the line
+		sBuffer = "";
+		fInFile >> sBuffer;
+
+		// Increment the Line Number we are on
+		iLineNumber++;
+
+		// If this is a blank or comment line
+		if (sBuffer.empty() || sBuffer.substr(0, 2) == "//")
+		{
+			// Do nothing
+		}
+		// If we are starting a new Species
+		else if (sBuffer == "Species:")
+		{
+			fInFile >> sBuffer;
+			int iSpecificObjectType = atoi(sBuffer.c_str());
+
+			// If the Specific Object Type is not valid
+			if (iSpecificObjectType < 0)
+			{
+				msLastError = "Invalid Species (" + sBuffer + ") in " + _sFileName + " at line number " + Ogre::StringConverter::toString(iLineNumber);
+				bNoErrors = false;
+				spSpecies = NULL;
+			}
+			else
+			{
+				// Make room for the Species if needed (the Specific Object Types are used as Indices so looking them up is fast)
+				if (iSpecificObjectType >= (int)mcSpeciesList.size())
+				{
+					mcSpeciesList.resize(iSpecificObjectType + 1);
+				}
+
+				// Start the Species from the default values
+				spSpecies = &mcSpeciesList[iSpecificObjectType];
+				spSpecies->Purge();
+				spSpecies->bDefined = true;
+			}
+		}
+		// Else if no Species has been started yet
+		else if (spSpecies == NULL)
+		{
+			msLastError = "Value (" + sBuffer + ") given before a Species in " + _sFileName + " at line number " + Ogre::StringConverter::toString(iLineNumber);
+			bNoErrors = false;
+		}
+		else if (sBuffer == "Name:")
+		{
+			fInFile >> spSpecies->sName;
+		}
+		else if (sBuffer == "Mesh:")
+		{
+			fInFile >> spSpecies->sMesh;
+		}
+		else if (sBuffer == "RandomColoredMaterial:")
+		{
+			fInFile >> sBuffer;
+			spSpecies->bUseRandomColoredMaterial = (sBuffer == "true") ? true : false;
+		}
+		else if (sBuffer == "LengthInMeters:")
+		{
+			fInFile >> sBuffer;
+			spSpecies->fLengthInMeters = (float)atof(sBuffer.c_str());
+		}
+		else if (sBuffer == "DimensionsScaleX:")
+		{
+			fInFile >> spSpecies->sMinDimensionsScale.x >> spSpecies->sMaxDimensionsScale.x;
+		}
+		else if (sBuffer == "DimensionsScaleY:")
+		{
+			fInFile >> spSpecies->sMinDimensionsScale.y >> spSpecies->sMaxDimensionsScale.y;
+		}
+		else if (sBuffer == "DimensionsScaleZ:")
+		{
+			fInFile >> spSpecies->sMinDimensionsScale.z >> spSpecies->sMaxDimensionsScale.z;
+		}
+		else if (sBuffer == "Moves:")
+		{
+			fInFile >> sBuffer;
+			spSpecies->bMoves = (sBuffer == "true") ? true : false;
+		}
+		else if (sBuffer == "SpeedAboveFriction:")
+		{
+			fInFile >> spSpecies->fMinSpeedAboveFriction >> spSpecies->fMaxSpeedAboveFriction;
+		}
+		else if (sBuffer == "RotationSpeed:")
+		{
+			fInFile >> spSpecies->fMinRotationSpeed >> spSpecies->fMaxRotationSpeed;
+		}
+		else if (sBuffer == "RotationAxis:")
+		{
+			spSpecies->sRotationAxis = ReadInVector(fInFile);
+		}
+		else if (sBuffer == "ForwardDirection:")
+		{
+			spSpecies->sForwardDirection = ReadInVector(fInFile);
+		}
+		else if (sBuffer == "UpDirection:")
+		{
+			spSpecies->sUpDirection = ReadInVector(fInFile);
+		}
+		else if (sBuffer == "RightDirection:")
+		{
+			spSpecies->sRightDirection = ReadInVector(fInFile);
+		}
+		else if (sBuffer == "InitialPitch:")
+		{
+			fInFile >> sBuffer;
+			spSpecies->fInitialPitch = (float)atof(sBuffer.c_str());
+		}
+		else if (sBuffer == "Points:")
+		{
+			fInFile >> sBuffer;
+			spSpecies->iNumberOfPoints = atoi(sBuffer.c_str());
+		}
+		else if (sBuffer == "RandomlyOrient:")
+		{
+			fInFile >> sBuffer;
+			spSpecies->bRandomlyOrient = (sBuffer == "true") ? true : false;
+		}
+		else if (sBuffer == "AutoTracking:")
+		{
+			fInFile >> sBuffer;
+			spSpecies->bUseAutoTracking = (sBuffer == "true") ? true : false;
+		}
+		else
+		{
+			msLastError = "Unrecognized command (" + sBuffer + ") in " + _sFileName + " at line number " + Ogre::StringConverter::toString(iLineNumber);
+			bNoErrors = false;
+		}
+
+		// If a number could not be read in, clear the error so the rest of the file can still be read
+		if (fInFile.fail() && !fInFile.eof())
+		{
+			msLastError = "Invalid value in " + _sFileName + " at line number " + Ogre::StringConverter::toString(iLineNumber);
+			bNoErrors = false;
+			fInFile.clear();
+		}
+
+		// Read in and ignore the rest of the line
+		fInFile.getline(caJunkBuffer, iJUNK_BUFFER_SIZE, '\n');
+	}
+
+	// Close the File now that we're done reading it
+	fInFile.close();
+
+	// Record that the Species have been read in (even if there was a mistake, the rest of the Species are still usable)
+	mbLoaded = true;
+	return bNoErrors;
+}
+
+// Returns if the Species File has been read in
+bool CSpeciesList::ReturnIfLoaded() const
+{
+	return mbLoaded;
+}
+
+// Returns the last error found when reading in the Species File
+string CSpeciesList::ReturnLastError() const
+{
+	return msLastError;
+}
+
+
+
+//---------- Species Functions ----------
+
+// Returns if there is a Species for the Specific Object Type
+bool CSpeciesList::ReturnIfSpeciesIsDefined(int _iSpecificObjectType) const
+{
+	return (_iSpecificObjectType >= 0 && _iSpecificObjectType < (int)mcSpeciesList.size() &&
+			mcSpeciesList[_iSpecificObjectType].bDefined);
+}
+
+// Returns the Species for the Specific Object Type
+SSpecies const& CSpeciesList::ReturnSpecies(int _iSpecificObjectType) const
+{
+	// If the Species doesn't exist
+	if (!ReturnIfSpeciesIsDefined(_iSpecificObjectType))
+	{
+		return msUndefinedSpecies;
+	}
+
+	return mcSpeciesList[_iSpecificObjectType];
+}
+
+// Saves the Mesh Metrics of the Species so they don't need to be measured again
+void CSpeciesList::SetMeshMetrics(int _iSpecificObjectType, float _fLengthToMeterRatio)
+{
+	// If the Species doesn't exist
+	if (!ReturnIfSpeciesIsDefined(_iSpecificObjectType))
+	{
+		return;
+	}
+
+	mcSpeciesList[_iSpecificObjectType].fLengthToMeterRatio = _fLengthToMeterRatio;
+	mcSpeciesList[_iSpecificObjectType].bMeshMetricsMeasured = true;
+}
+
+// Returns how many Species are defined
+int CSpeciesList::ReturnNumberOfSpecies() const
+{
+	int iNumberOfSpecies = 0;
+	for (int iIndex = 0; iIndex < (int)mcSpeciesList.size(); iIndex++)
+	{
+		if (mcSpeciesList[iIndex].bDefined)
+		{
+			iNumberOfSpecies++;
+		}
+	}
+	return iNumberOfSpecies;
+}
+
+
+
+//---------- Private Functions ----------
+
+// Reads in a Vector3 (three floats) from the file
+Ogre::Vector3 CSpeciesList::ReadInVector(ifstream& _fInFile) const
+{
+	Ogre::Vector3 sVector = Ogre::Vector3::ZERO;
+	_fInFile >> sVector.x >> sVector.y >> sVector.z;
+	return sVector;
+}
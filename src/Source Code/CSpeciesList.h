@@ -0,0 +1,122 @@
+/////////////////////////////////////////////////////////////////////
+// CSpeciesList.h (and CSpeciesList.cpp)
+// Written by Daniel Schroeder
+// Created on October 17, 2026
+// Last Updated October 17, 2026
+//-------------------------------------------------------------------
+//   The CSpeciesList class holds the Species (the Mesh, size, speeds,
+// Mesh directions, Points, etc.) of each Specific Object Type, which
+// CGame::CreateObject() uses to create the Shark, Fish, and Items. The
+// Species are read in once from the Species File instead of being written
+// into the code, so a new kind of Fish only needs a new entry in the file.
+//   Each Species also saves how big its Mesh is compared to a Meter the
+// first time it is measured, so it only needs to be found from the Mesh
+// once instead of every time an Object of that Species is created.
+//   Species File format (one value per line, lines starting with // are
+// comments, and anything after the value on a line is ignored):
+//		Species: 2				// Starts a Species (its Specific Object Type)
+//		Mesh: DansFish.mesh
+//		LengthInMeters: 1.5
+//		SpeedAboveFriction: 0.5 2.0	// Min and Max, in Meters per second
+//		... (see ReadInSpeciesFile() for all of the values)
+/////////////////////////////////////////////////////////////////////
+
+#ifndef CSPECIES_LIST_H
+#define CSPECIES_LIST_H
+
+#include <Ogre.h>		// Include OGRE
+#include <fstream>
+#include <string>
+#include <vector>
+using namespace std;
+
+// Holds everything needed to create an Object of one Specific Object Type
+struct SSpecies
+{
+	bool bDefined;								// Tells if the Species was read in from the Species File
+
+	string sName;								// Name of the Species (only used to make the file easier to read)
+	string sMesh;								// Name of the Mesh the Objects use
+	bool bUseRandomColoredMaterial;				// Tells if the Objects should be given a randomly colored Material
+
+	float fLengthInMeters;						// How long the Objects are in Meters
+	Ogre::Vector3 sMinDimensionsScale;			// Smallest and largest amount to randomly scale the Objects Dimensions by
+	Ogre::Vector3 sMaxDimensionsScale;
+
+	bool bMoves;								// Tells if the Objects move (if not their Speed is zero)
+	float fMinSpeedAboveFriction;				// Slowest and fastest the Objects can move, in Meters per second faster than the Level Friction
+	float fMaxSpeedAboveFriction;
+
+	float fMinRotationSpeed;					// Slowest and fastest the Objects can rotate (in degrees per second)
+	float fMaxRotationSpeed;
+	Ogre::Vector3 sRotationAxis;				// Axis the Objects start rotating around (ZERO if they don't start rotating)
+
+	Ogre::Vector3 sForwardDirection;			// Directions the Mesh faces by default
+	Ogre::Vector3 sUpDirection;
+	Ogre::Vector3 sRightDirection;
+	float fInitialPitch;						// How many degrees to Pitch the Objects by when they are created
+
+	int iNumberOfPoints;						// How many Points the Objects are worth
+	bool bRandomlyOrient;						// Tells if the Objects should be given a random Yaw when they are created
+	bool bUseAutoTracking;						// Tells if the Objects should use Auto Tracking
+
+	bool bMeshMetricsMeasured;					// Tells if the Mesh Metrics below have been measured yet
+	float fLengthToMeterRatio;					// How big the Meshes Length is compared to a Meter
+
+	// Default Constructor
+	SSpecies();
+
+	// Sets the Species back to its default values
+	void Purge();
+};
+
+class CSpeciesList
+{
+public:
+
+	//---------- Contructors and Setup Functions ----------
+
+	CSpeciesList();								// Default Constructor
+	~CSpeciesList();							// Destructor
+
+	// Removes all Species
+	void Purge();
+
+	// Reads in the Species from the Species File
+	// NOTE: Returns false if the file could not be opened or had a mistake in it (use ReturnLastError() to find out what it was)
+	bool ReadInSpeciesFile(string _sFileName);
+
+	// Returns if the Species File has been read in
+	bool ReturnIfLoaded() const;
+
+	// Returns the last error found when reading in the Species File
+	string ReturnLastError() const;
+
+
+	//---------- Species Functions ----------
+
+	// Returns if there is a Species for the Specific Object Type
+	bool ReturnIfSpeciesIsDefined(int _iSpecificObjectType) const;
+
+	// Returns the Species for the Specific Object Type
+	// NOTE: If the Species is not defined a Species with only the default values (and no Mesh) is returned
+	SSpecies const& ReturnSpecies(int _iSpecificObjectType) const;
+
+	// Saves the Mesh Metrics of the Species so they don't need to be measured again
+	void SetMeshMetrics(int _iSpecificObjectType, float _fLengthToMeterRatio);
+
+	// Returns how many Species are defined
+	int ReturnNumberOfSpecies() const;
+
+private:
+
+	// Reads in a Vector3 (three floats) from the file
+	Ogre::Vector3 ReadInVector(ifstream& _fInFile) const;
+
+	vector<SSpecies> mcSpeciesList;				// Holds the Species (indexed by their Specific Object Type)
+	SSpecies msUndefinedSpecies;				// Returned for Specific Object Types which have no Species
+	bool mbLoaded;								// Tells if the Species File has been read in
+	string msLastError;							// The last error found when reading in the Species File
+};
+
+#endif
@@ -2,16 +2,32 @@
 
 #include "CTimer.h"
 
+// Returns the system Time in milliseconds (1000ms = 1s)
+static unsigned long ReturnSystemTimeInMilliseconds()
+{
+	// If we are running on Windows
+	#ifdef _WIN32
+		return timeGetTime();
+	// Else use the POSIX time instead
+	#else
+		timeval sTime;
+		gettimeofday(&sTime, NULL);
+		return (unsigned long)((sTime.tv_sec * 1000) + (sTime.tv_usec / 1000));
+	#endif
+}
+
 /////////////////////////////////////////////////////////////////////
 // CClock Functions
 
 // Initialize the private data
 CClock* CClock::SmcpClockInstance						= NULL;
-unsigned long CClock::SmulSavedTime						= timeGetTime();
+unsigned long CClock::SmulSavedTime						= ReturnSystemTimeInMilliseconds();
 float CClock::SmfScaleFactor							= 1.0f;	// Initialize to Normal speed
 float CClock::SmfNextScaleFactor						= 1.0f; // Initialize to Normal speed
 unsigned long CClock::SmulScaleFactorDuration			= 0;
 unsigned long CClock::SmulScaleFactorDurationStartTime	= 0;
+bool CClock::SmbUseSimulatedTime						= false;
+unsigned long CClock::SmulSimulatedTime					= 0;
 
 
 // Constructor - Does nothing
@@ -128,7 +144,44 @@ unsigned long CClock::ReturnCurrentTime()
 	// Restores the Clocks Scale Factor if it should no longer be used
 	RestoreScaleFactorIfExpired();
 
-	return timeGetTime();
+	return ReturnClockTime();
+}
+
+// Sets if the Clock should use Simulated Time instead of the system Time
+void CClock::SetIfSimulatedTimeShouldBeUsed(bool bUseSimulatedTime)
+{
+	// If we are switching to Simulated Time
+	if (bUseSimulatedTime && !SmbUseSimulatedTime)
+	{
+		// Start the Simulated Time from the current system Time so Timers do not jump
+		SmulSimulatedTime = ReturnSystemTimeInMilliseconds();
+	}
+
+	SmbUseSimulatedTime = bUseSimulatedTime;
+}
+
+// Returns if the Clock is using Simulated Time
+bool CClock::ReturnIfSimulatedTimeIsBeingUsed() const
+{
+	return SmbUseSimulatedTime;
+}
+
+// Moves the Simulated Time forward by the given amount
+void CClock::AdvanceSimulatedTime(unsigned long ulTimeInMilliseconds)
+{
+	SmulSimulatedTime += ulTimeInMilliseconds;
+}
+
+// Returns the actual system Time in milliseconds, even if Simulated Time is being used
+unsigned long CClock::ReturnSystemTime()
+{
+	return ReturnSystemTimeInMilliseconds();
+}
+
+// Returns the Simulated Time or system Time, whichever is being used
+unsigned long CClock::ReturnClockTime()
+{
+	return (SmbUseSimulatedTime) ? SmulSimulatedTime : ReturnSystemTimeInMilliseconds();
 }
 
 // Resets the Clock
@@ -145,7 +198,7 @@ void CClock::RestoreScaleFactorIfExpired()
 	if (SmulScaleFactorDurationStartTime != 0)
 	{
 		// If this Timer has expired
-		if ((timeGetTime() - SmulScaleFactorDurationStartTime) > SmulScaleFactorDuration)
+		if ((ReturnClockTime() - SmulScaleFactorDurationStartTime) > SmulScaleFactorDuration)
 		{
 			// Change to use the new specified Scale Factor
 			SmfScaleFactor = SmfNextScaleFactor;
@@ -375,7 +428,7 @@ void CTimer::RestoreTimerScaleFactorIfExpired()
 	if (mulTimerScaleDurationStartTime != 0)
 	{
 		// If this Timer has expired
-		if ((timeGetTime() - mulTimerScaleDurationStartTime) > mulTimerScaleDuration)
+		if ((mcpClock->ReturnCurrentTime() - mulTimerScaleDurationStartTime) > mulTimerScaleDuration)
 		{
 			// Restore the original Scale Factor
 			mfTimerScaleFactor = 1.0f;
@@ -393,18 +446,22 @@ void CTimer::RestoreTimerScaleFactorIfExpired()
 
 // Initialize the private data
 CScheduler* CScheduler::SmcpSchedulerInstance	= NULL;
-list<SEvent> CScheduler::SmcEventList;
-int CScheduler::SmiEventIDCounter				= 0;
 
 
-// Constructor - Does nothing
+// Constructor
 CScheduler::CScheduler()
-{}
+{
+	// The Unscaled Timeline should not be effected by Clock Scaling
+	mcaTimelineTimers[eScaledTimeline].TimerIsAffectedByClockScaleFactor(true);
+	mcaTimelineTimers[eUnscaledTimeline].TimerIsAffectedByClockScaleFactor(false);
 
-// Destructor - Removes all Events from the list
+	RemoveAllScheduledEvents();
+}
+
+// Destructor - Removes all Events
 CScheduler::~CScheduler()
 {
-	// Remove all Events from the list
+	// Remove all Events
 	RemoveAllScheduledEvents();
 }
 
@@ -423,118 +480,308 @@ CScheduler* CScheduler::ReturnSingletonInstance()
 	return SmcpSchedulerInstance;
 }
 
-// Schedule a new Event and return its unique ID
+// Schedule a new Event and return its Handle
 // _vpFunctionToCall is the global or static Function to call when the event fires
 // _ulDurationBeforeCallingFunction is how long to wait before firing the event (calling the Function)
-// _bRepeatUntilStopped should be set to true if you want the same Function to be called at an interval of _ulDurationBeforeCallingFunction, false if it should be called only once
 // _bDurationEffectedByClockScale should be set to true if you want Clock Scaling to effect the time before the Event is fired
-//	NOTE: If _vpFunctionToCall returns false and _bRepeatUntilStopped == true, the Event will be deleted and will not be repeated anymore
-int CScheduler::ScheduleNewEvent(bool (*Function)(void* vpOptionalData), unsigned long _ulDurationBeforeCallingFunction, void* _vpOptionalDataToPass, int _iNumberOfTimesToCallFunction, unsigned long _ulDurationInBetweenCalls, bool _bDurationEffectedByClockScale)
+//	NOTE: If _vpFunctionToCall returns false the Event will be deleted and will not be repeated anymore
+SEventHandle CScheduler::ScheduleNewEvent(bool (*Function)(void* vpOptionalData), unsigned long _ulDurationBeforeCallingFunction, void* _vpOptionalDataToPass, int _iNumberOfTimesToCallFunction, unsigned long _ulDurationInBetweenCalls, bool _bDurationEffectedByClockScale)
 {
 	// Create the Event with the specified attributes
-	SEvent sNewEvent;
-	sNewEvent.iEventID = SmiEventIDCounter++;
-	sNewEvent.Function = Function;
-	sNewEvent.vpOptionalDataToPass = _vpOptionalDataToPass;
-	sNewEvent.ulDurationRemaining = _ulDurationBeforeCallingFunction;
-	sNewEvent.iNumberOfTimesToCallFunction = _iNumberOfTimesToCallFunction;
-	sNewEvent.ulDurationBetweenCalls = _ulDurationInBetweenCalls;
-	sNewEvent.cEventTimer.TimerIsAffectedByClockScaleFactor(_bDurationEffectedByClockScale);
+	SEventHandle sEventHandle = CreateNewEvent(Function, _ulDurationBeforeCallingFunction, _vpOptionalDataToPass, _iNumberOfTimesToCallFunction, _ulDurationInBetweenCalls, _bDurationEffectedByClockScale);
 
-	// Record if the event should keep firing until explicitly stopped or not
-	sNewEvent.bKeepFiringEventUntilStopped = (_iNumberOfTimesToCallFunction == 0) ? true : false;
-	
-	// Add the new Event to the Event list
-	SmcEventList.push_front(sNewEvent);
+	// Add the Event to its Timelines heap
+	vector<SEventQueueEntry>& cEventQueue = mcaEventQueues[mcEventList[sEventHandle.iSlot].iTimeline];
+	cEventQueue.push_back(ReturnQueueEntry(sEventHandle));
+	push_heap(cEventQueue.begin(), cEventQueue.end());
 
-	// Return the ID of this Event
-	return sNewEvent.iEventID;
+	// Return the Handle of this Event
+	return sEventHandle;
 }
 
-// Removes a Scheduled Event from the list so it is not fired
+// Schedules _iNumberOfEvents Events at once which all call the same Function, each with its own Optional Data
+void CScheduler::ScheduleNewEvents(bool (*Function)(void* vpOptionalData), void** _vpaOptionalDataToPass, int _iNumberOfEvents, unsigned long _ulDurationBeforeCallingFunction, int _iNumberOfTimesToCallFunction, unsigned long _ulDurationInBetweenCalls, bool _bDurationEffectedByClockScale, SEventHandle* _saEventHandles)
+{
+	// Temp local variables
+	int iIndex = 0;
+	SEventHandle sEventHandle;
+
+	// If there are no Events to Schedule
+	if (_iNumberOfEvents <= 0)
+	{
+		return;
+	}
+
+	// All of the Events go on the same Timeline
+	vector<SEventQueueEntry>& cEventQueue = mcaEventQueues[_bDurationEffectedByClockScale ? eScaledTimeline : eUnscaledTimeline];
+	int iOldQueueSize = (int)cEventQueue.size();
+	cEventQueue.reserve(iOldQueueSize + _iNumberOfEvents);
+
+	// Create the Events and add them to the end of the heap
+	for (iIndex = 0; iIndex < _iNumberOfEvents; iIndex++)
+	{
+		sEventHandle = CreateNewEvent(Function, _ulDurationBeforeCallingFunction, _vpaOptionalDataToPass[iIndex], _iNumberOfTimesToCallFunction, _ulDurationInBetweenCalls, _bDurationEffectedByClockScale);
+		cEventQueue.push_back(ReturnQueueEntry(sEventHandle));
+
+		// If the Handles should be returned
+		if (_saEventHandles != NULL)
+		{
+			_saEventHandles[iIndex] = sEventHandle;
+		}
+	}
+
+	// If more Events were added than were already in the heap, rebuilding the whole heap at once is faster
+	if (_iNumberOfEvents > iOldQueueSize)
+	{
+		make_heap(cEventQueue.begin(), cEventQueue.end());
+	}
+	// Else just sift each new Event into the heap
+	else
+	{
+		for (iIndex = iOldQueueSize; iIndex < (int)cEventQueue.size(); iIndex++)
+		{
+			push_heap(cEventQueue.begin(), cEventQueue.begin() + iIndex + 1);
+		}
+	}
+}
+
+// Removes a Scheduled Event so it is not fired
 // Returns true if the Event was found, false if not
-bool CScheduler::RemoveScheduledEvent(int _iEventID)
+bool CScheduler::RemoveScheduledEvent(SEventHandle _sEventHandle)
 {
-	// Backup size of list before attempting remove
-	int iOldListSize = (int)SmcEventList.size();
+	// If the Event already finished, or was already Removed
+	if (!ReturnIfEventIsScheduled(_sEventHandle))
+	{
+		return false;
+	}
 
-	// Create Dummy Event with the ID we want to remove
-	SEvent sDummyEvent;
-	sDummyEvent.iEventID = _iEventID;
-	
-	// Try removing the Event with specified ID
-	SmcEventList.remove(sDummyEvent);
+	// Free the Event (its heap Entry is skipped once it reaches the top of the heap)
+	FreeEvent(_sEventHandle.iSlot);
+
+	// If the heaps are mostly made up of Removed Events, get rid of them so they don't keep building up
+	int iNumberOfQueueEntries = (int)(mcaEventQueues[eScaledTimeline].size() + mcaEventQueues[eUnscaledTimeline].size());
+	if (iNumberOfQueueEntries > 64 && iNumberOfQueueEntries > (miNumberOfScheduledEvents * 2))
+	{
+		RemoveFinishedEntriesFromQueues();
+	}
 
-	// Return if an Event was removed or not
-	return (iOldListSize > (int)SmcEventList.size());
+	return true;
 }
 
-// Purges all Events from the list
+// Purges all Events
 void CScheduler::RemoveAllScheduledEvents()
 {
-	// While there are still Events in the list
-	while (!SmcEventList.empty())
+	// Temp local variables
+	int iIndex = 0;
+
+	// Free every Event which is still Scheduled, so any Handles to them become invalid
+	for (iIndex = 0; iIndex < (int)mcEventList.size(); iIndex++)
 	{
-		// Remove the first Event in the list
-		SmcEventList.pop_front();
+		if (mcEventList[iIndex].bScheduled)
+		{
+			FreeEvent(iIndex);
+		}
 	}
+
+	// Empty the heaps and restart the Timelines
+	for (iIndex = 0; iIndex < eNumberOfTimelines; iIndex++)
+	{
+		mcaEventQueues[iIndex].clear();
+		mulaTime[iIndex] = 0;
+		mcaTimelineTimers[iIndex].RestartTimerUsingSavedTime();
+	}
+
+	miNumberOfScheduledEvents = 0;
+	mulNextOrder = 0;
 }
 
 // Updates all Events and Fires the Events which should be fired (should be called once per frame)
 void CScheduler::ProcessAllEvents()
 {
 	// Temp local variables
+	int iTimeline = 0;
 	int iIndex = 0;
-	unsigned long ulTimeElapsed = 0;
 	bool bContinueRepeating = false;
+	SEventQueueEntry sEntry;
 
-	// Store the Number of Events in the list
-	int iNumberOfEvents = (int)SmcEventList.size();
+	// Events Scheduled while processing (by the Functions being called) are not fired until the next frame
+	unsigned long ulFirstNewOrder = mulNextOrder;
 
-	// Loop through all Events and update their Remaining Durations
-	list<SEvent>::iterator sIterator = SmcEventList.begin(); // Get a pointer to the first Event in the list
-	for (iIndex = 0; iIndex < iNumberOfEvents; iIndex++)
+	// Loop through each Timeline
+	for (iTimeline = 0; iTimeline < eNumberOfTimelines; iTimeline++)
 	{
-		// Get how much time has elapsed since the last check
-		ulTimeElapsed = sIterator->cEventTimer.ReturnTimePassedSinceLastRestartUsingSavedTimeAndRestartTimer();
-		
-		// Update this Events DurationRemaining
-		sIterator->ulDurationRemaining = (ulTimeElapsed > sIterator->ulDurationRemaining) ? 0 : (sIterator->ulDurationRemaining - ulTimeElapsed);
-		
-		// If this Event should fire
-		if (sIterator->ulDurationRemaining == 0)
+		vector<SEventQueueEntry>& cEventQueue = mcaEventQueues[iTimeline];
+
+		// Move this Timeline forward by how much time has elapsed since the last check
+		mulaTime[iTimeline] += mcaTimelineTimers[iTimeline].ReturnTimePassedSinceLastRestartUsingSavedTimeAndRestartTimer();
+
+		// While the Event at the top of the heap should fire
+		while (!cEventQueue.empty() && cEventQueue.front().ulFireTime <= mulaTime[iTimeline])
 		{
+			// Take the Event off the heap
+			pop_heap(cEventQueue.begin(), cEventQueue.end());
+			sEntry = cEventQueue.back();
+			cEventQueue.pop_back();
+
+			// If the Event was Removed, skip it
+			if (!ReturnIfEventIsScheduled(sEntry.sEventHandle))
+			{
+				continue;
+			}
+
+			// If the Event was Scheduled during this call, put it back once we're done
+			if (sEntry.ulOrder >= ulFirstNewOrder)
+			{
+				mcDeferredEntryList.push_back(sEntry);
+				continue;
+			}
+
 			// Call the global or static Function with the Optional Data as a parameter
-			bContinueRepeating = sIterator->Function(sIterator->vpOptionalDataToPass);
+			// NOTE: The Function may Schedule or Remove Events, so the Event is looked up again afterwards
+			bContinueRepeating = mcEventList[sEntry.sEventHandle.iSlot].Function(mcEventList[sEntry.sEventHandle.iSlot].vpOptionalDataToPass);
+
+			// If the Function Removed its own Event
+			if (!ReturnIfEventIsScheduled(sEntry.sEventHandle))
+			{
+				continue;
+			}
+
+			SEvent& sEvent = mcEventList[sEntry.sEventHandle.iSlot];
 
 			// Decrement the number of times this function has been called
-			sIterator->iNumberOfTimesToCallFunction--;
+			sEvent.iNumberOfTimesToCallFunction--;
 
 			// If the Event should continue to repeat
-			if ((sIterator->bKeepFiringEventUntilStopped || sIterator->iNumberOfTimesToCallFunction > 0) 
-				&& bContinueRepeating)
+			if ((sEvent.bKeepFiringEventUntilStopped || sEvent.iNumberOfTimesToCallFunction > 0) 
+				&& bContinueRepeating && sEvent.ulDurationBetweenCalls > 0)
+			{
+				// Put the Event back on the heap to fire again after the waiting Duration
+				sEvent.ulFireTime = mulaTime[iTimeline] + sEvent.ulDurationBetweenCalls;
+				cEventQueue.push_back(ReturnQueueEntry(sEntry.sEventHandle));
+				push_heap(cEventQueue.begin(), cEventQueue.end());
+			}
+			// Else the Event is done firing (not going to repeat)
+			else
 			{
-				// Reset the waiting Duration before firing again
-				sIterator->ulDurationRemaining = sIterator->ulDurationBetweenCalls;
+				FreeEvent(sEntry.sEventHandle.iSlot);
 			}
 		}
 
-		// If this Event should be removed from the list now that it's done firing (not going to repeat)
-		if (sIterator->ulDurationRemaining == 0)
-		{
-			// Delete this Event from the list (and move to the next Event)
-			sIterator = SmcEventList.erase(sIterator);
-		}
-		else
+		// Put back the Events which were Scheduled during this call
+		for (iIndex = 0; iIndex < (int)mcDeferredEntryList.size(); iIndex++)
 		{
-			// Move to the next Event in the list
-			sIterator++;
+			cEventQueue.push_back(mcDeferredEntryList[iIndex]);
+			push_heap(cEventQueue.begin(), cEventQueue.end());
 		}
+		mcDeferredEntryList.clear();
 	}
 }
 
 // Returns there are any Event Scheduled or not
 bool CScheduler::IsEmpty() const
 {
-	return SmcEventList.empty();
-}
\ No newline at end of file
+	return (miNumberOfScheduledEvents == 0);
+}
+
+// Returns if the Event is still Scheduled to fire
+bool CScheduler::ReturnIfEventIsScheduled(SEventHandle _sEventHandle) const
+{
+	return (_sEventHandle.iSlot >= 0 && _sEventHandle.iSlot < (int)mcEventList.size() &&
+			mcEventList[_sEventHandle.iSlot].uiGeneration == _sEventHandle.uiGeneration &&
+			mcEventList[_sEventHandle.iSlot].bScheduled);
+}
+
+// Returns how many Events are Scheduled
+int CScheduler::ReturnNumberOfScheduledEvents() const
+{
+	return miNumberOfScheduledEvents;
+}
+
+// Creates the Event in a free Slot (without adding it to the heap) and returns its Handle
+SEventHandle CScheduler::CreateNewEvent(bool (*Function)(void* vpOptionalData), unsigned long _ulDurationBeforeCallingFunction, void* _vpOptionalDataToPass, int _iNumberOfTimesToCallFunction, unsigned long _ulDurationInBetweenCalls, bool _bDurationEffectedByClockScale)
+{
+	SEventHandle sEventHandle;
+
+	// If there is a free Slot, reuse it
+	if (!mcFreeEventSlotList.empty())
+	{
+		sEventHandle.iSlot = mcFreeEventSlotList.back();
+		mcFreeEventSlotList.pop_back();
+	}
+	// Else create a new Slot
+	else
+	{
+		SEvent sNewEvent;
+		sNewEvent.uiGeneration = 0;
+		sNewEvent.bScheduled = false;
+
+		sEventHandle.iSlot = (int)mcEventList.size();
+		mcEventList.push_back(sNewEvent);
+	}
+
+	// Fill in the Event with the specified attributes
+	SEvent& sEvent = mcEventList[sEventHandle.iSlot];
+	sEvent.Function = Function;
+	sEvent.vpOptionalDataToPass = _vpOptionalDataToPass;
+	sEvent.iTimeline = _bDurationEffectedByClockScale ? eScaledTimeline : eUnscaledTimeline;
+	sEvent.ulFireTime = mulaTime[sEvent.iTimeline] + _ulDurationBeforeCallingFunction;
+	sEvent.iNumberOfTimesToCallFunction = _iNumberOfTimesToCallFunction;
+	sEvent.ulDurationBetweenCalls = _ulDurationInBetweenCalls;
+	sEvent.bScheduled = true;
+
+	// Record if the event should keep firing until explicitly stopped or not
+	sEvent.bKeepFiringEventUntilStopped = (_iNumberOfTimesToCallFunction == 0) ? true : false;
+
+	miNumberOfScheduledEvents++;
+
+	sEventHandle.uiGeneration = sEvent.uiGeneration;
+	return sEventHandle;
+}
+
+// Returns the heap Entry for the Event, to be added to its Timelines heap
+SEventQueueEntry CScheduler::ReturnQueueEntry(SEventHandle _sEventHandle)
+{
+	SEventQueueEntry sEntry;
+	sEntry.ulFireTime = mcEventList[_sEventHandle.iSlot].ulFireTime;
+	sEntry.ulOrder = mulNextOrder++;
+	sEntry.sEventHandle = _sEventHandle;
+	return sEntry;
+}
+
+// Marks the Events Slot as free, making any Handles to it invalid
+void CScheduler::FreeEvent(int _iSlot)
+{
+	mcEventList[_iSlot].bScheduled = false;
+	mcEventList[_iSlot].uiGeneration++;
+	mcFreeEventSlotList.push_back(_iSlot);
+	miNumberOfScheduledEvents--;
+}
+
+// Rebuilds the heaps without the Entries of Events which were Removed (so they don't build up)
+void CScheduler::RemoveFinishedEntriesFromQueues()
+{
+	// Temp local variables
+	int iTimeline = 0;
+	int iIndex = 0;
+	int iNumberOfEntriesKept = 0;
+
+	// Loop through each Timeline
+	for (iTimeline = 0; iTimeline < eNumberOfTimelines; iTimeline++)
+	{
+		vector<SEventQueueEntry>& cEventQueue = mcaEventQueues[iTimeline];
+
+		// Move the Entries of Events which are still Scheduled to the front
+		iNumberOfEntriesKept = 0;
+		for (iIndex = 0; iIndex < (int)cEventQueue.size(); iIndex++)
+		{
+			if (ReturnIfEventIsScheduled(cEventQueue[iIndex].sEventHandle))
+			{
+				cEventQueue[iNumberOfEntriesKept++] = cEventQueue[iIndex];
+			}
+		}
+
+		// Drop the rest and rebuild the heap
+		cEventQueue.resize(iNumberOfEntriesKept);
+		make_heap(cEventQueue.begin(), cEventQueue.end());
+	}
+}
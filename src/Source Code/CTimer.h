@@ -2,7 +2,7 @@
 /* CTimer.h (and CTimer.cpp)                                                 */
 /* Written by Daniel Schroeder                                               */
 /* Created in 2004                                                           */
-/* Last Updated October 29, 2007                                             */
+/* Last Updated October 17, 2026                                             */
 /*---------------------------------------------------------------------------*/
 /*   The CClock class is a singleton class so only one object of it can be   */
 /* created, and this is done auotmatically. It is used to get the current    */
@@ -27,6 +27,13 @@
 /* Time (which will be the same for all Timers until the Clock is reset      */
 /* again), instead of from their Start Time to the Current Time, which will  */
 /* be different for every timer.											 */
+/*   The CScheduler class is a singleton class used to call a function after */
+/* a specified amount of time has passed (and optionally keep calling it at  */
+/* an interval). Events are kept in a heap ordered by when they fire, so     */
+/* only the Events which are firing are looked at each frame. Scheduling an  */
+/* Event returns a Handle which can be used to Remove it; a Handle stays     */
+/* safe to use after its Event has finished. ScheduleNewEvents() Schedules   */
+/* an Event for each of a group of Objects at once.                          */
 /*   NOTE: 1000 milliseconds = 1 second                                      */
 /*   -NOTE: Must have winmm.lib included in project to work-                 */
 /*****************************************************************************/
@@ -34,8 +41,14 @@
 #ifndef CTIMER_H
 #define CTIMER_H
 
-#include <windows.h>	// Needed for timeGetTime() function
-#include <list>			// Used to hold the Schedulers list of Events
+#ifdef _WIN32
+	#include <windows.h>	// Needed for timeGetTime() function
+#else
+	#include <sys/time.h>	// Needed for gettimeofday() function when not running on Windows
+#endif
+#include <cstddef>		// Needed for NULL (windows.h defines it, but sys/time.h does not have to)
+#include <vector>		// Used to hold the Schedulers Events
+#include <algorithm>	// Used for the heap functions the Scheduler orders its Events with
 // NOTE: Must also include winmm.lib in project for timeGetTime() to work
 
 using namespace std;
@@ -74,6 +87,16 @@ public:
 	unsigned long ReturnSavedTime();	// Returns the Saved Time
 	unsigned long ReturnCurrentTime();	// Returns the Current Time
 
+	// Set and Return if the Clock should use Simulated Time instead of the system Time
+	// NOTE: Simulated Time only moves forward when AdvanceSimulatedTime() is called, which allows the game
+	//		 to be stepped faster (or slower) than real time, such as when running Headless
+	void SetIfSimulatedTimeShouldBeUsed(bool bUseSimulatedTime = true);
+	bool ReturnIfSimulatedTimeIsBeingUsed() const;
+	void AdvanceSimulatedTime(unsigned long ulTimeInMilliseconds);
+
+	// Returns the actual system Time, even if Simulated Time is being used
+	unsigned long ReturnSystemTime();
+
 private:
 
 	CClock();			// Constructor (Private because this is a Singleton class)
@@ -87,7 +110,11 @@ private:
 	static unsigned long SmulScaleFactorDuration;			// Holds how long to use the Scale Factor
 	static unsigned long SmulScaleFactorDurationStartTime;	// Holds what time the Scale Factor started
 
+	static bool SmbUseSimulatedTime;			// Tells if Simulated Time should be used instead of the system Time
+	static unsigned long SmulSimulatedTime;		// Holds the current Simulated Time
+
 	void RestoreScaleFactorIfExpired();	// Restores the Scale Factor to 1.0 if it should no longer be used
+	unsigned long ReturnClockTime();	// Returns the Simulated Time or system Time, whichever is being used
 };
 
 
@@ -152,39 +179,74 @@ private:
 
 
 
+// Handle to an Event in the CScheduler
+// Once the Event has fired for the last time or been Removed, its Handle is no longer valid (even if the
+//	Schedulers storage for the Event is reused by a new Event), so holding on to an old Handle is always safe
+struct SEventHandle
+{
+	int iSlot;						// Index of the Event in the Schedulers storage
+	unsigned int uiGeneration;		// Which Event using this Slot the Handle refers to
+
+	// Default Constructor - creates a Null Handle
+	SEventHandle()
+	{
+		iSlot = -1;
+		uiGeneration = 0;
+	}
+
+	// Returns if this Handle does not refer to any Event
+	bool IsNull() const
+	{
+		return (iSlot == -1);
+	}
+
+	// Overload the == and != operators to compare Handles
+	bool operator==(const SEventHandle& _sHandle) const
+	{
+		return (iSlot == _sHandle.iSlot && uiGeneration == _sHandle.uiGeneration);
+	}
+	bool operator!=(const SEventHandle& _sHandle) const
+	{
+		return !(*this == _sHandle);
+	}
+};
+
 // Used by the CScheduler class to hold a Scheduled Events information
 struct SEvent
 {
-	int iEventID;							// Unique ID of this Event
 	bool (*Function)(void* vpOptionalData);	// Function to call once the Event should fire
 	void* vpOptionalDataToPass;				// Optional data to pass into the Function being called
 
-	unsigned long ulDurationRemaining;		// How long to wait before firing the Event
+	unsigned long ulFireTime;				// Scheduler Time at which to fire the Event next
 
 	int iNumberOfTimesToCallFunction;		// Holds how many times this Event should fire
 	unsigned long ulDurationBetweenCalls;	// Holds how long to wait before firing the Event again
 	bool bKeepFiringEventUntilStopped;		// Holds if this Event should keep firing until explicity stopped or not
+	int iTimeline;							// Which of the Schedulers Timelines the Event is on (Clock Scaled or not)
 
-	CTimer cEventTimer;						// Holds a Timer used to check when to fire the Event
+	unsigned int uiGeneration;				// Changed every time the Event is finished, so old Handles to it become invalid
+	bool bScheduled;						// Tells if this Slot holds an Event which is still scheduled to fire
+};
 
-	// Operator Overload Functions
-	// Overload the == operator to compare against the IDs
-	bool operator==(const SEvent& _sEvent) const
-	{
-		// Return if the Event has the specified ID or not
-		return (this->iEventID == _sEvent.iEventID);
-	}
+// Used by the CScheduler class to order the Events by when they should fire
+struct SEventQueueEntry
+{
+	unsigned long ulFireTime;				// Scheduler Time at which the Event should fire
+	unsigned long ulOrder;					// Order the Entry was added in (Events due at the same time fire in the order they were Scheduled)
+	SEventHandle sEventHandle;				// The Event to fire (it is skipped if the Handle is no longer valid)
 
-	// Overload the != operator to compare against the IDs
-	bool operator!=(const SEvent& _sEvent) const
+	// Overload the < operator so the STL heap functions (which keep the largest Entry on top) keep the Entry which should fire first on top
+	bool operator<(const SEventQueueEntry& _sEntry) const
 	{
-		// Return if the Event has the specified ID or not
-		return !(this->iEventID == _sEvent.iEventID);
+		return (ulFireTime > _sEntry.ulFireTime || (ulFireTime == _sEntry.ulFireTime && ulOrder > _sEntry.ulOrder));
 	}
 };
 
 // Singleton Class
 // Class to be used as a Scheduler to call functions after a specified amount of time has elapsed
+// The Events are kept in a heap ordered by when they fire, so Scheduling an Event takes O(log n) time, Removing
+//	one takes O(1) time (it is just marked as finished, and skipped when it reaches the top of the heap), and
+//	ProcessAllEvents() only looks at the Events which are firing
 class CScheduler
 {
 public:
@@ -195,7 +257,7 @@ public:
 	// Returns a pointer to the class's Instance
 	static CScheduler* ReturnSingletonInstance();
 
-	// Schedule a new Event and return its unique ID
+	// Schedule a new Event and return its Handle
 	// _vpFunctionToCall is the global or static Function to call when the Event fires
 	//	_vpFunctionToCall should be of the form: bool FunctionName(void* vpOptionalData)
 	// _ulDurationBeforeCallingFunction is how long to wait before firing the event (calling the Function) for the first time
@@ -204,11 +266,17 @@ public:
 	// _ulDurationInBetweenCalls is how long to wait between firing the Event, when it is set to be fired more than once
 	// _bDurationEffectedByClockScale should be set to true if you want Clock Scaling to effect the time before the Event is fired
 	//	NOTE: If _vpFunctionToCall returns false, the Event will be deleted and will not be repeated anymore, regardless of if it's supposed to keep repeating or not
-	int ScheduleNewEvent(bool (*Function)(void* vpOptionalData), unsigned long _ulDurationBeforeCallingFunction, void* _vpOptionalDataToPass = NULL, int _iNumberOfTimesToCallFunction = 1, unsigned long _ulDurationInBetweenCalls = 0, bool _bDurationEffectedByClockScale = true);
+	SEventHandle ScheduleNewEvent(bool (*Function)(void* vpOptionalData), unsigned long _ulDurationBeforeCallingFunction, void* _vpOptionalDataToPass = NULL, int _iNumberOfTimesToCallFunction = 1, unsigned long _ulDurationInBetweenCalls = 0, bool _bDurationEffectedByClockScale = true);
 
-	// Removes a Scheduled Event from the list so it is not fired
-	// Returns true if the Event was found, false if not
-	bool RemoveScheduledEvent(int _iEventID);
+	// Schedules _iNumberOfEvents Events at once which all call the same Function, each with its own Optional Data
+	//	(_vpaOptionalDataToPass[i]), such as a repeating Event for each of a group of Objects. The Events Handles are
+	//	written into _saEventHandles if it is given. The other parameters are the same as ScheduleNewEvent()
+	// NOTE: Faster than calling ScheduleNewEvent() for each Event when Scheduling a lot of Events
+	void ScheduleNewEvents(bool (*Function)(void* vpOptionalData), void** _vpaOptionalDataToPass, int _iNumberOfEvents, unsigned long _ulDurationBeforeCallingFunction, int _iNumberOfTimesToCallFunction = 1, unsigned long _ulDurationInBetweenCalls = 0, bool _bDurationEffectedByClockScale = true, SEventHandle* _saEventHandles = NULL);
+
+	// Removes a Scheduled Event so it is not fired
+	// Returns true if the Event was found, false if not (it already finished, or was already Removed)
+	bool RemoveScheduledEvent(SEventHandle _sEventHandle);
 
 	// Purges all Events from the list
 	void RemoveAllScheduledEvents();
@@ -219,13 +287,41 @@ public:
 	// Returns there are any Event Scheduled or not
 	bool IsEmpty() const;
 
+	// Returns if the Event is still Scheduled to fire
+	bool ReturnIfEventIsScheduled(SEventHandle _sEventHandle) const;
+
+	// Returns how many Events are Scheduled
+	int ReturnNumberOfScheduledEvents() const;
+
 private:
 
 	CScheduler();								// Constructor (Private because this is a Singleton class)
 	static CScheduler* SmcpSchedulerInstance;	// Holds a pointer to the Class Instance
 
-	static list<SEvent> SmcEventList;	// Holds a list of all the Events which are still scheduled to fire
-	static int SmiEventIDCounter;		// Holds the next unique Event ID to be used
+	// Creates the Event in a free Slot (without adding it to the heap) and returns its Handle
+	SEventHandle CreateNewEvent(bool (*Function)(void* vpOptionalData), unsigned long _ulDurationBeforeCallingFunction, void* _vpOptionalDataToPass, int _iNumberOfTimesToCallFunction, unsigned long _ulDurationInBetweenCalls, bool _bDurationEffectedByClockScale);
+
+	// Returns the heap Entry for the Event, to be added to its Timelines heap
+	SEventQueueEntry ReturnQueueEntry(SEventHandle _sEventHandle);
+
+	// Marks the Events Slot as free, making any Handles to it invalid
+	void FreeEvent(int _iSlot);
+
+	// Rebuilds the heaps without the Entries of Events which were Removed (so they don't build up)
+	void RemoveFinishedEntriesFromQueues();
+
+	// Timelines (Events which are effected by Clock Scaling go by their own Timeline)
+	enum { eScaledTimeline = 0, eUnscaledTimeline = 1, eNumberOfTimelines = 2 };
+
+	vector<SEvent> mcEventList;					// Holds the Events (indexed by their Handles Slot)
+	vector<int> mcFreeEventSlotList;			// Holds the Slots which are not being used
+	int miNumberOfScheduledEvents;				// How many Events are still scheduled to fire
+
+	vector<SEventQueueEntry> mcaEventQueues[eNumberOfTimelines];	// Heap of each Timelines Events, ordered by when they fire
+	unsigned long mulaTime[eNumberOfTimelines];	// How much time each Timeline has moved forward
+	CTimer mcaTimelineTimers[eNumberOfTimelines];	// Used to move each Timeline forward every frame
+	unsigned long mulNextOrder;					// Order to give the next heap Entry
+	vector<SEventQueueEntry> mcDeferredEntryList;	// Holds Events Scheduled while ProcessAllEvents() is firing Events
 };
 
 #endif
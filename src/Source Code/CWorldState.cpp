@@ -0,0 +1,126 @@
+#include "CWorldState.h"
+
+//---------- SObjectState Functions ----------
+
+// Default Constructor
+SObjectState::SObjectState()
+{
+	sHandle = SObjectHandle();
+	sPosition = Ogre::Vector3::ZERO;
+	sOrientation = Ogre::Quaternion::IDENTITY;
+	sVelocity = Ogre::Vector3::ZERO;
+	fBoundingRadius = 0.0f;
+	iState = 0;
+}
+
+
+
+//---------- Contructors and Setup Functions ----------
+
+// Default Constructor
+CWorldState::CWorldState()
+{
+	Purge();
+}
+
+// Destructor
+CWorldState::~CWorldState()
+{
+	Purge();
+}
+
+// Removes all Objects from both buffers
+void CWorldState::Purge()
+{
+	mcaStateList[0].clear();
+	mcaStateList[1].clear();
+	miSnapshotBuffer = 0;
+	mulNumberOfSwaps = 0;
+}
+
+
+
+//---------- Buffer Functions ----------
+
+// Copies the Objects current State into the buffer being written to
+void CWorldState::WriteObjectState(CObject const* _cpObject)
+{
+	vector<SObjectState>& cWriteList = mcaStateList[1 - miSnapshotBuffer];
+	int iSlot = _cpObject->msHandle.iSlot;
+
+	// If the Object is not in the Object Pool
+	if (iSlot < 0)
+	{
+		return;
+	}
+
+	// Make room for the Objects Slot if needed
+	if (iSlot >= (int)cWriteList.size())
+	{
+		cWriteList.resize(iSlot + 1);
+	}
+
+	// Record the Objects State
+	SObjectState& sState = cWriteList[iSlot];
+	sState.sHandle = _cpObject->msHandle;
+	sState.sPosition = _cpObject->GetPosition();
+	sState.sOrientation = _cpObject->GetOrientation();
+	sState.sVelocity = _cpObject->GetVelocity();
+	sState.fBoundingRadius = _cpObject->GetBoundingRadius();
+	sState.iState = _cpObject->GetState();
+}
+
+// Makes the buffer which was written to the new snapshot, and empties the other buffer so it can be written to next
+void CWorldState::Swap()
+{
+	// Make the written buffer the snapshot
+	miSnapshotBuffer = 1 - miSnapshotBuffer;
+	mulNumberOfSwaps++;
+
+	// Forget the Objects in the old snapshot, so Objects which are not written again (i.e. were Removed) aren't kept around
+	// NOTE: The entries are kept (instead of cleared) so the buffer doesn't need to grow again next Step
+	vector<SObjectState>& cWriteList = mcaStateList[1 - miSnapshotBuffer];
+	for (int iSlot = 0; iSlot < (int)cWriteList.size(); iSlot++)
+	{
+		cWriteList[iSlot].sHandle = SObjectHandle();
+	}
+}
+
+// Returns how many times the buffers have been Swapped since the last Purge
+unsigned long CWorldState::ReturnNumberOfSwaps() const
+{
+	return mulNumberOfSwaps;
+}
+
+
+
+//---------- Snapshot Functions ----------
+
+// Returns the Objects State from the snapshot, or NULL if it was not in it
+SObjectState const* CWorldState::ReturnObjectState(SObjectHandle _sHandle) const
+{
+	vector<SObjectState> const& cSnapshotList = mcaStateList[miSnapshotBuffer];
+
+	// If the Handle's Slot is not in the snapshot, or a different Object was in the Slot
+	if (_sHandle.iSlot < 0 || _sHandle.iSlot >= (int)cSnapshotList.size() ||
+		cSnapshotList[_sHandle.iSlot].sHandle != _sHandle)
+	{
+		return NULL;
+	}
+
+	return &cSnapshotList[_sHandle.iSlot];
+}
+
+// Returns the Objects Position from the snapshot
+Ogre::Vector3 CWorldState::ReturnPosition(CObject const* _cpObject) const
+{
+	SObjectState const* spState = ReturnObjectState(_cpObject->msHandle);
+
+	// If the Object was not in the snapshot (i.e. it was just created), use where it is now
+	if (spState == NULL)
+	{
+		return _cpObject->GetPosition();
+	}
+
+	return spState->sPosition;
+}
@@ -0,0 +1,91 @@
+/////////////////////////////////////////////////////////////////////
+// CWorldState.h (and CWorldState.cpp)
+// Written by Daniel Schroeder
+// Created on October 17, 2026
+// Last Updated October 17, 2026
+//-------------------------------------------------------------------
+//   The CWorldState class holds two copies (buffers) of the State of every
+// Object in the level (its Position, Orientation, Velocity, etc.). One
+// buffer is a snapshot of how every Object was at the end of the last
+// Simulation Step and is never changed during a Step, so the AI can look
+// at the other Objects without caring if they have been moved yet (or if
+// another Thread is moving them). The other buffer is written to as the
+// Objects are Published at the end of the Step, and then the two buffers
+// are Swapped so it becomes the snapshot for the next Step.
+//   Each Objects State is kept at its Object Pool Slot, along with its
+// Handle, so an Object which has been Removed (or whose Slot was reused)
+// is not found in the snapshot.
+//   Example (each Step):
+//		... AI reads the other Objects with cWorldState.ReturnPosition(cpOtherObject)
+//		... Move the Objects
+//		... For each Object, cWorldState.WriteObjectState(cpObject);
+//		cWorldState.Swap();
+/////////////////////////////////////////////////////////////////////
+
+#ifndef CWORLD_STATE_H
+#define CWORLD_STATE_H
+
+#include "CObject.h"
+#include "SObjectHandle.h"
+#include <Ogre.h>		// Include OGRE
+#include <vector>
+using namespace std;
+
+// Holds the State of one Object at the end of a Simulation Step
+struct SObjectState
+{
+	SObjectHandle sHandle;				// Handle of the Object (a Null Handle if there was no Object in this Slot)
+	Ogre::Vector3 sPosition;			// Objects Position
+	Ogre::Quaternion sOrientation;		// Objects Orientation
+	Ogre::Vector3 sVelocity;			// Objects Velocity
+	float fBoundingRadius;				// Objects Bounding Radius
+	int iState;							// Objects State (e.g. GiOBJECT_STATE_DEAD)
+
+	// Default Constructor
+	SObjectState();
+};
+
+class CWorldState
+{
+public:
+
+	//---------- Contructors and Setup Functions ----------
+
+	CWorldState();								// Default Constructor
+	~CWorldState();								// Destructor
+
+	// Removes all Objects from both buffers (should be done whenever the Object Pool is Purged)
+	void Purge();
+
+
+	//---------- Buffer Functions ----------
+
+	// Copies the Objects current State into the buffer being written to
+	// NOTE: Only one Thread should call this at a time, since the buffer may need to grow
+	void WriteObjectState(CObject const* _cpObject);
+
+	// Makes the buffer which was written to the new snapshot, and empties the other buffer so it can be written to next
+	// NOTE: Every Object should be written to the buffer before this is called, or it won't be in the new snapshot
+	void Swap();
+
+	// Returns how many times the buffers have been Swapped since the last Purge
+	unsigned long ReturnNumberOfSwaps() const;
+
+
+	//---------- Snapshot Functions ----------
+
+	// Returns the Objects State from the snapshot, or NULL if it was not in it (i.e. it was created after the last Swap)
+	SObjectState const* ReturnObjectState(SObjectHandle _sHandle) const;
+
+	// Returns the Objects Position from the snapshot
+	// NOTE: If the Object was not in the snapshot its current Position is returned instead
+	Ogre::Vector3 ReturnPosition(CObject const* _cpObject) const;
+
+private:
+
+	vector<SObjectState> mcaStateList[2];		// The two buffers of Object States (indexed by the Objects Slot)
+	int miSnapshotBuffer;						// Which buffer is the snapshot (the other is being written to)
+	unsigned long mulNumberOfSwaps;				// How many times the buffers have been Swapped since the last Purge
+};
+
+#endif
@@ -17,11 +17,50 @@
 	int main(int argc, char **argv)
 #endif
 {
+	// Put the Command Line arguments into a single string
+	#if OGRE_PLATFORM == PLATFORM_WIN32 || OGRE_PLATFORM == OGRE_PLATFORM_WIN32
+		String sCommandLine = strCmdLine;
+	#else
+		String sCommandLine = "";
+		for (int iIndex = 1; iIndex < argc; iIndex++)
+		{
+			sCommandLine += String(argv[iIndex]) + " ";
+		}
+	#endif
+
     try
     {
-		// Create the Game object and start running the Game
+		// Create the Game object
 		CGame cApp;
-        cApp.Go();		// Start running the Game
+
+		// If what the Profiler recorded should be written out when the Game exits
+		// Usage: add -profile to the end of the Command Line
+		StringVector cArguments = StringUtil::split(sCommandLine);
+		bool bWriteProfileTrace = (!cArguments.empty() && cArguments.back() == "-profile");
+		if (bWriteProfileTrace)
+		{
+			cArguments.pop_back();
+		}
+
+		// If the Game should be run Headless (no window, Render System, or input) to benchmark the AI and physics
+		// Usage: -headless [Level] [SecondsToSimulate]
+		if (!cArguments.empty() && cArguments[0] == "-headless")
+		{
+			int iLevel = (cArguments.size() > 1) ? StringConverter::parseInt(cArguments[1]) : 0;
+			float fSecondsToSimulate = (cArguments.size() > 2) ? StringConverter::parseReal(cArguments[2]) : 60.0f;
+			cApp.RunHeadless(iLevel, fSecondsToSimulate);
+		}
+		// Else start running the Game normally
+		else
+		{
+			cApp.Go();
+		}
+
+		// Write out what the Profiler recorded
+		if (bWriteProfileTrace)
+		{
+			cApp.WriteProfileTrace();
+		}
     }
 	// If there was a problem
     catch(Exception& e)
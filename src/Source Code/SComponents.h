@@ -0,0 +1,220 @@
+/////////////////////////////////////////////////////////////////////
+// SComponents.h
+// Written by Daniel Schroeder
+// Created on October 17, 2026
+// Last Updated October 17, 2026
+//-------------------------------------------------------------------
+//   The Component structures hold the data of each part of an Object
+// which only some Objects have, or which CGame's update loops (Systems)
+// work on for many Objects at once. The CObjectPool keeps every
+// Object's copy of a Component packed together in one array (one array
+// per Component), so a System loops straight through the data it needs
+// instead of jumping from Object to Object, and an Object only takes up
+// room for the Components it was given (a Ring has no Flocking data).
+//   An Object finds its own Components through the pointers the Pool
+// gives it (e.g. CObject::mspTransform), which are NULL for Components
+// it doesn't have.
+// NOTE: Adding or Removing a Component can move the other Objects'
+//		 copies of it, so don't hold on to a pointer or reference to one
+//		 across an Add or Remove (the Objects' own pointers are kept up
+//		 to date by the Pool).
+/////////////////////////////////////////////////////////////////////
+
+#ifndef SCOMPONENTS_H
+#define SCOMPONENTS_H
+
+#include "CAIHelper.h"		// Needed for the Neighbor and AI Level Of Detail constants
+#include "CTimer.h"
+#include "SObjectHandle.h"
+#include <Ogre.h>			// Include OGRE
+
+// Where an Object is in the world (every Object has one)
+struct STransform
+{
+	Ogre::Vector3 sPosition;				// The Objects Position in the world
+	Ogre::Quaternion sOrientation;			// The Objects Orientation in the world
+	Ogre::Vector3 sPreviousPosition;		// The Objects Position before the last Simulation Step
+	Ogre::Quaternion sPreviousOrientation;	// The Objects Orientation before the last Simulation Step
+	float fBoundingRadius;					// The Objects Bounding Radius
+
+	// Default Constructor
+	STransform()
+	{
+		Purge();
+	}
+
+	// Erase all data as if the Transform was just created
+	void Purge()
+	{
+		sPosition = sPreviousPosition = Ogre::Vector3::ZERO;
+		sOrientation = sPreviousOrientation = Ogre::Quaternion::IDENTITY;
+		fBoundingRadius = 0.0f;
+	}
+};
+
+// How an Object moves and rotates each Update (every Object has one)
+struct SKinematics
+{
+	Ogre::Vector3 sUnitVelocity, sUnitAcceleration;
+	float fSpeed, fAccelerationRate, fFriction;
+	float fMinVelocity, fMaxVelocity, fDefaultVelocity;
+	float fMinAcceleration, fMaxAcceleration, fDefaultAcceleration;
+	bool bUseMovementAcceleration, bUseMovementFriction;		// Tells if Movement Acceleration/Friction should be calculated in Update()
+
+	Ogre::Vector3 sUnitRotationVelocity, sUnitRotationAcceleration;
+	float fRotationSpeed, fRotationAccelerationRate, fRotationFriction;
+	float fMinRotationVelocity, fMaxRotationVelocity, fDefaultRotationVelocity;
+	float fMinRotationAcceleration, fMaxRotationAcceleration, fDefaultRotationAcceleration;
+	bool bUseRotationAcceleration, bUseRotationFriction;		// Tells if Rotation Acceleration/Friction should be calculated in Update()
+
+	// Tells what the Objects movements should be relative to (TS_LOCAL, TS_PARENT, or TS_WORLD)
+	Ogre::Node::TransformSpace sTranslationRelativeTo;	// What the Translation (relative movement) should be Relative To
+	Ogre::Node::TransformSpace sPitchRelativeTo;		// What the X-axis rotations should be Relative To
+	Ogre::Node::TransformSpace sYawRelativeTo;			// What the Y-axis rotations should be Relative To
+	Ogre::Node::TransformSpace sRollRelativeTo;			// What the Z-axis rotations should be Relative To
+
+	float fDurationSinceLastUpdateInSeconds;	// How much time passed between the 2nd last Update() and the last Update()
+
+	// Default Constructor
+	SKinematics()
+	{
+		Purge();
+	}
+
+	// Erase all data as if the Kinematics were just created
+	void Purge()
+	{
+		sUnitVelocity = sUnitAcceleration = Ogre::Vector3::ZERO;
+		fSpeed = fAccelerationRate = fFriction = 0.0f;
+		fMinVelocity = fMaxVelocity = fDefaultVelocity = 0.0f;
+		fMinAcceleration = fMaxAcceleration = fDefaultAcceleration = 0.0f;
+		bUseMovementAcceleration = bUseMovementFriction = true;
+
+		sUnitRotationVelocity = sUnitRotationAcceleration = Ogre::Vector3::ZERO;
+		fRotationSpeed = fRotationAccelerationRate = fRotationFriction = 0.0f;
+		fMinRotationVelocity = fMaxRotationVelocity = fDefaultRotationVelocity = 0.0f;
+		fMinRotationAcceleration = fMaxRotationAcceleration = fDefaultRotationAcceleration = 0.0f;
+		bUseRotationAcceleration = bUseRotationFriction = true;
+
+		sTranslationRelativeTo = sPitchRelativeTo = sYawRelativeTo = sRollRelativeTo = Ogre::Node::TS_LOCAL;
+
+		fDurationSinceLastUpdateInSeconds = 0.0f;
+	}
+};
+
+// What every Fish (Flocking and Non-Flocking) needs to Perform its own AI
+struct SFishBrain
+{
+	float fAge;							// The age of the Fish
+	float fSpawnAge;					// The age at which the Fish will spawn into two Fish
+	float fSenseSharkRange;				// The distance at which the Shark can be detected
+
+	// Default Constructor
+	SFishBrain()
+	{
+		Purge();
+	}
+
+	// Erase all data as if the Brain was just created
+	void Purge()
+	{
+		fAge = fSpawnAge = fSenseSharkRange = 0.0f;
+	}
+};
+
+// What a Flocking Fish needs to Flock, find its Neighbor Candidates, and be put in a School
+struct SFlocking
+{
+	// NOTE: The Separation, Alignment, Cohesion, and PreditorAvoidance Coefficients should sum up to one
+	float fSeparationCoefficient;
+	float fAlignmentCoefficient;
+	float fCohesionCoefficient;
+	float fPreditorAvoidanceCoefficient;
+	float fSenseNeighborRange;			// Maximum distance between 2 Fish to consider them Neighbors
+
+	// Verlet Neighbor List - the Fish within the Sense Neighbor Range plus the Neighbor Skin when the list was built.
+	//	The Neighbors are picked from these every Step until some Fish moves more than half the Skin from where it was
+	SObjectHandle saNeighborCandidates[GiMAX_NUMBER_OF_NEIGHBOR_CANDIDATES];	// Holds Handles to this Fish's Neighbor Candidates
+	int iNumberOfNeighborCandidates;	// How many Neighbor Candidates are being held
+	bool bNeighborCandidatesFound;		// Tells if this Fish's Neighbor Candidates have been found yet
+	Ogre::Vector3 sNeighborListsPosition;	// Where this Fish was when the Neighbor Lists were last rebuilt
+	bool bInNeighborLists;				// Tells if this Fish was in the Spatial Grid when the Neighbor Lists were last rebuilt
+
+	int iSpatialGridHandle;				// Handle to this Fish in the Spatial Grid (-1 if not in it)
+	int iFlockingKernelIndex;			// Index of this Fish in the Flocking Kernel this frame (-1 if not in it)
+	int iAILevelOfDetail;				// How much AI this Fish does (GiAI_LEVEL_OF_DETAIL_...)
+	int iSchoolIndex;					// Index of the School this Fish is being simulated as part of (-1 if not in one)
+	Ogre::Vector3 sSchoolOffset;		// Where this Fish is in its School, relative to the School's Centre
+
+	// Default Constructor
+	SFlocking()
+	{
+		Purge();
+	}
+
+	// Erase all data as if the Flocking was just created
+	void Purge()
+	{
+		fSeparationCoefficient = fAlignmentCoefficient = fCohesionCoefficient = fPreditorAvoidanceCoefficient = 0.0f;
+		fSenseNeighborRange = -1.0f;
+
+		iNumberOfNeighborCandidates = 0;
+		bNeighborCandidatesFound = false;
+		sNeighborListsPosition = Ogre::Vector3::ZERO;
+		bInNeighborLists = false;
+
+		iSpatialGridHandle = -1;
+		iFlockingKernelIndex = -1;
+
+		// Do the full AI until we know how far away the Player and Shark are
+		iAILevelOfDetail = GiAI_LEVEL_OF_DETAIL_NEAR;
+
+		iSchoolIndex = -1;
+		sSchoolOffset = Ogre::Vector3::ZERO;
+	}
+};
+
+// What a Shark needs to hunt the Fish and the Player
+struct SSharkBrain
+{
+	int iNourishedHealth;				// How much Health the Shark must have to be considered Nourished
+	int iFullHealth;					// How much Health the Shark must have to be considered Full
+	float fFeedRange;					// How close the Shark must be to a Fish to eat it
+	float fAttackRange;					// How close the Shark must be to the Submarine to attack it
+	unsigned long ulHitDelay;			// How long the Shark should keep swimming away from the Submarine after attacking it (in milliseconds)
+	unsigned long ulHealthDegradeDelay;	// How often the Shark should lose a Health point (in milliseconds)
+	float fVelocityCoefficient;			// Used to help determine the Sharks Velocity (Health * VelocityCoefficient)
+
+	SEventHandle sHitDelayEvent;		// Handle to the Scheduled Event which ends the Hit Delay (the Shark avoids the Player while it is Scheduled)
+
+	// Default Constructor
+	SSharkBrain()
+	{
+		Purge();
+	}
+
+	// Erase all data as if the Brain was just created
+	void Purge()
+	{
+		iNourishedHealth = iFullHealth = 0;
+		fFeedRange = fAttackRange = 0.0f;
+		ulHitDelay = ulHealthDegradeDelay = 0;
+		fVelocityCoefficient = 1.0f;
+		sHitDelayEvent = SEventHandle();
+	}
+};
+
+// What an Item the Player can collect needs once it has been collected
+struct SCollectible
+{
+	bool bDying;						// Tells if the Item was collected and is dying (a Ring expands for a second before it is Removed)
+	CTimer cDyingTimer;					// Keeps track of how long the Item has been dying
+
+	// Default Constructor
+	SCollectible()
+	{
+		bDying = false;
+	}
+};
+
+#endif
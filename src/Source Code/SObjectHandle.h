@@ -0,0 +1,54 @@
+/////////////////////////////////////////////////////////////////////
+// SObjectHandle.h
+// Written by Daniel Schroeder
+// Created on October 17, 2026
+// Last Updated October 17, 2026
+//-------------------------------------------------------------------
+//   The SObjectHandle structure is used to refer to an Object in a
+// CObjectPool. Along with the Slot the Object is in, it holds the
+// Generation of the Slot when the Object was put in it; since a Slot's
+// Generation changes every time its Object is Removed, a Handle to an
+// Object which no longer exists can be detected right away instead of
+// pointing to whatever Object is now using the Slot.
+/////////////////////////////////////////////////////////////////////
+
+#ifndef SOBJECT_HANDLE_H
+#define SOBJECT_HANDLE_H
+
+struct SObjectHandle
+{
+	int iSlot;					// The Slot the Object is in (-1 if this is a Null Handle)
+	unsigned int uiGeneration;	// The Generation of the Slot when the Object was put in it
+
+	// Default Constructor - creates a Null Handle
+	SObjectHandle()
+	{
+		iSlot = -1;
+		uiGeneration = 0;
+	}
+
+	// Explicit Constructor
+	SObjectHandle(int _iSlot, unsigned int _uiGeneration)
+	{
+		iSlot = _iSlot;
+		uiGeneration = _uiGeneration;
+	}
+
+	// Returns if this is a Null Handle (doesn't refer to any Object)
+	bool IsNull() const
+	{
+		return (iSlot == -1);
+	}
+
+	// Overload the == and != operators
+	bool operator ==(const SObjectHandle& _sHandle) const
+	{
+		return (iSlot == _sHandle.iSlot && uiGeneration == _sHandle.uiGeneration);
+	}
+	bool operator !=(const SObjectHandle& _sHandle) const
+	{
+		return !(*this == _sHandle);
+	}
+};
+
+#endif
@@ -0,0 +1,65 @@
+/////////////////////////////////////////////////////////////////////
+// SRandomNumberGenerator.h
+// Written by Daniel Schroeder
+// Created on October 17, 2026
+// Last Updated October 17, 2026
+//-------------------------------------------------------------------
+//   The SRandomNumberGenerator structure makes a sequence of random
+// numbers from a Seed, without using rand() (which every Thread shares
+// on most C libraries, so the numbers each Thread gets would depend on
+// the order the Threads happen to run in). Giving each Object its own
+// Generator, Seeded from something like its Handle and the Step number,
+// means it gets the same random numbers no matter which Thread runs it.
+/////////////////////////////////////////////////////////////////////
+
+#ifndef SRANDOM_NUMBER_GENERATOR_H
+#define SRANDOM_NUMBER_GENERATOR_H
+
+struct SRandomNumberGenerator
+{
+	unsigned int uiState;		// The current State of the Generator (never zero)
+
+	// Explicit Constructor
+	SRandomNumberGenerator(unsigned int _uiSeed)
+	{
+		Seed(_uiSeed);
+	}
+
+	// Starts the sequence of random numbers over from the given Seed
+	void Seed(unsigned int _uiSeed)
+	{
+		// Mix up the Seed so Seeds which are close together (e.g. Handles next to each other) give very different sequences
+		_uiSeed ^= _uiSeed >> 16;
+		_uiSeed *= 0x7FEB352DU;
+		_uiSeed ^= _uiSeed >> 15;
+		_uiSeed *= 0x846CA68BU;
+		_uiSeed ^= _uiSeed >> 16;
+
+		// A State of zero would only ever return zero
+		uiState = (_uiSeed != 0) ? _uiSeed : 0x9E3779B9U;
+	}
+
+	// Returns the next random number in the sequence (Xorshift)
+	unsigned int ReturnNextNumber()
+	{
+		uiState ^= uiState << 13;
+		uiState ^= uiState >> 17;
+		uiState ^= uiState << 5;
+		return uiState;
+	}
+
+	// Returns a random number between 0.0 and 1.0
+	float ReturnUnitRandom()
+	{
+		// Use the top 24 bits, since that is all a float can hold exactly
+		return (float)(ReturnNextNumber() >> 8) / 16777215.0f;
+	}
+
+	// Returns a random number between _fLow and _fHigh
+	float ReturnRangeRandom(float _fLow, float _fHigh)
+	{
+		return _fLow + ((_fHigh - _fLow) * ReturnUnitRandom());
+	}
+};
+
+#endif